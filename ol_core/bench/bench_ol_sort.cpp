@@ -0,0 +1,635 @@
+/****************************************************************************************/
+/*
+ * 程序名：bench_ol_sort.cpp
+ * 功能描述：ol_sort.h排序算法性能基准，特性包括：
+ *          - 输入分布：随机、有序、逆序、管风琴、少量不同值、Zipf、接近有序
+ *          - 元素类型：int、double、string（16字节定长）、64字节记录（按uint64_t键比较）
+ *          - 规模：默认1e2~1e6，可通过--sizes指定到1e8；O(n²)算法只在不超过--quadratic-max的规模上运行
+ *          - 指标：每元素耗时（中位数/最小值，纳秒）；比较型排序另做一次插桩运行，统计每元素比较次数与元素移动次数
+ *          - 输出：table（终端阅读）、csv/json（行顺序固定，便于跨版本diff）
+ * 用法：bench_ol_sort [--sizes=100,1e4,1e6] [--types=int,double,string,record]
+ *                     [--dists=random,sorted,...] [--algos=intro_sort,tim_sort,...]
+ *                     [--format=table|csv|json] [--output=文件名] [--min-time=秒] [--max-reps=次数]
+ *                     [--quadratic-max=规模] [--no-counts] [--seed=种子]
+ * 作者：ol
+ * 适用标准：C++17及以上
+ */
+/****************************************************************************************/
+
+#include "ol_sort.h"
+#include "ol_string.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace ol;
+
+// ===========================================================================
+// 元素类型
+// ===========================================================================
+// 64字节记录：按key比较，payload模拟业务字段，移动代价远高于整数
+struct Record
+{
+    uint64_t key;
+    char payload[56];
+};
+
+struct RecordLess
+{
+    bool operator()(const Record& a, const Record& b) const { return a.key < b.key; }
+};
+
+template <typename T>
+struct default_compare
+{
+    using type = std::less<T>;
+};
+
+template <>
+struct default_compare<Record>
+{
+    using type = RecordLess;
+};
+
+// 插桩计数器：比较次数、元素移动次数（拷贝/移动构造与赋值），并行排序会从多个线程累加
+std::atomic<uint64_t> g_comparisons{0};
+std::atomic<uint64_t> g_moves{0};
+
+// 插桩元素：每次拷贝/移动都计数
+template <typename T>
+struct Tracked
+{
+    T value;
+
+    Tracked() = default;
+    explicit Tracked(const T& v) : value(v) {}
+    Tracked(const Tracked& other) : value(other.value) { g_moves.fetch_add(1, std::memory_order_relaxed); }
+    Tracked(Tracked&& other) noexcept : value(std::move(other.value)) { g_moves.fetch_add(1, std::memory_order_relaxed); }
+    Tracked& operator=(const Tracked& other)
+    {
+        value = other.value;
+        g_moves.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+    Tracked& operator=(Tracked&& other) noexcept
+    {
+        value = std::move(other.value);
+        g_moves.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+};
+
+// 插桩比较器：每次比较都计数
+template <typename Compare>
+struct TrackedCompare
+{
+    Compare comp;
+
+    template <typename T>
+    bool operator()(const Tracked<T>& a, const Tracked<T>& b) const
+    {
+        g_comparisons.fetch_add(1, std::memory_order_relaxed);
+        return comp(a.value, b.value);
+    }
+};
+
+// ===========================================================================
+// 输入分布
+// ===========================================================================
+enum class Dist
+{
+    Random,
+    Sorted,
+    Reverse,
+    OrganPipe,
+    FewUnique,
+    Zipf,
+    NearlySorted
+};
+
+const char* const DIST_NAMES[] = {"random", "sorted", "reverse", "organ_pipe", "few_unique", "zipf", "nearly_sorted"};
+const size_t DIST_COUNT = sizeof(DIST_NAMES) / sizeof(DIST_NAMES[0]);
+
+/**
+ * @brief 按分布生成n个非负键（不超过2^31-1），再由make_value转换为各元素类型，保证各类型的相对顺序一致
+ */
+std::vector<int64_t> make_keys(Dist dist, size_t n, uint64_t seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<int64_t> full(0, INT32_MAX);
+    std::vector<int64_t> keys(n);
+
+    switch (dist)
+    {
+    case Dist::Random:
+        for (auto& k : keys) k = full(gen);
+        break;
+    case Dist::Sorted:
+    case Dist::Reverse:
+        for (auto& k : keys) k = full(gen);
+        std::sort(keys.begin(), keys.end());
+        if (dist == Dist::Reverse) std::reverse(keys.begin(), keys.end());
+        break;
+    case Dist::OrganPipe:
+        for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int64_t>(i < n / 2 ? i : n - 1 - i);
+        break;
+    case Dist::FewUnique:
+        for (auto& k : keys) k = static_cast<int64_t>(gen() % 16);
+        break;
+    case Dist::Zipf:
+    {
+        // s=1.1的Zipf分布：按累积分布表反查排名，再把排名打散成键，使高频值不集中在最小端
+        const size_t m = std::max<size_t>(2, std::min<size_t>(n, 1000000));
+        std::vector<double> cdf(m);
+        double sum = 0;
+        for (size_t r = 0; r < m; ++r) cdf[r] = (sum += 1.0 / std::pow(static_cast<double>(r + 1), 1.1));
+        std::uniform_real_distribution<double> u(0.0, sum);
+        for (auto& k : keys)
+        {
+            const uint64_t rank = static_cast<uint64_t>(std::lower_bound(cdf.begin(), cdf.end(), u(gen)) - cdf.begin());
+            k = static_cast<int64_t>((rank * 2654435761ULL) & 0x7fffffffULL);
+        }
+        break;
+    }
+    case Dist::NearlySorted:
+        for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int64_t>(i);
+        for (size_t i = 0; i < n / 100 + 1 && n > 1; ++i) std::swap(keys[gen() % n], keys[gen() % n]);
+        break;
+    }
+    return keys;
+}
+
+template <typename T>
+T make_value(int64_t key);
+
+template <>
+int make_value<int>(int64_t key) { return static_cast<int>(key); }
+
+template <>
+double make_value<double>(int64_t key) { return static_cast<double>(key) / 1024.0; }
+
+template <>
+std::string make_value<std::string>(int64_t key)
+{
+    char buf[17];
+    snprintf(buf, sizeof(buf), "%016" PRIx64, static_cast<uint64_t>(key));
+    return buf;
+}
+
+template <>
+Record make_value<Record>(int64_t key)
+{
+    Record r;
+    r.key = static_cast<uint64_t>(key);
+    memset(r.payload, static_cast<int>(key & 0xff), sizeof(r.payload));
+    return r;
+}
+
+// ===========================================================================
+// 算法
+// ===========================================================================
+enum class Algo
+{
+    Insertion,
+    BinaryInsertion,
+    Bubble,
+    Selection,
+    Shell,
+    Heap,
+    Merge,
+    Tim,
+    Quick,
+    Intro,
+    ParallelMerge,
+    ParallelSample,
+    StdSort,
+    StdStableSort,
+    Counting,
+    RadixLsd,
+    Radix256,
+    RadixMsd,
+    Bucket
+};
+
+struct AlgoInfo
+{
+    const char* name;
+    bool quadratic;  ///< O(n²)算法，只在小规模上运行
+    bool comparison; ///< 比较型排序，可插桩统计比较/移动次数
+};
+
+const AlgoInfo ALGOS[] = {
+    {"insertion_sort", true, true},
+    {"binary_insertion_sort", true, true},
+    {"bubble_sort", true, true},
+    {"selection_sort", true, true},
+    {"shell_sort", false, true},
+    {"heap_sort", false, true},
+    {"merge_sort", false, true},
+    {"tim_sort", false, true},
+    {"quick_sort", false, true},
+    {"intro_sort", false, true},
+    {"parallel_merge_sort", false, true},
+    {"parallel_sample_sort", false, true},
+    {"std::sort", false, true},
+    {"std::stable_sort", false, true},
+    {"counting_sort", false, false},
+    {"radix_sort_lsd", false, false},
+    {"radix256_sort", false, false},
+    {"radix_sort_msd", false, false},
+    {"bucket_sort", false, false},
+};
+const size_t ALGO_COUNT = sizeof(ALGOS) / sizeof(ALGOS[0]);
+
+const size_t COUNTING_SORT_MAX_RANGE = size_t(1) << 24; ///< 计数排序允许的最大值域，避免巨大的计数数组
+
+/**
+ * @brief 判断算法能否用于该元素类型与数据
+ */
+template <typename T>
+bool applicable(Algo algo, const std::vector<T>& data)
+{
+    switch (algo)
+    {
+    case Algo::Counting:
+        if constexpr (std::is_integral<T>::value)
+        {
+            if (data.empty()) return true;
+            auto mm = std::minmax_element(data.begin(), data.end());
+            return static_cast<size_t>(static_cast<int64_t>(*mm.second) - *mm.first) < COUNTING_SORT_MAX_RANGE;
+        }
+        return false;
+    case Algo::RadixLsd:
+        return std::is_integral<T>::value;
+    case Algo::Radix256:
+        return std::is_arithmetic<T>::value || std::is_same<T, Record>::value;
+    case Algo::RadixMsd:
+        return std::is_same<T, std::string>::value;
+    case Algo::Bucket:
+        return std::is_arithmetic<T>::value;
+    default:
+        return true;
+    }
+}
+
+/**
+ * @brief 运行比较型排序（V可以是原始元素或插桩元素）
+ */
+template <typename V, typename Compare>
+void run_comparison_sort(Algo algo, std::vector<V>& v, const Compare& comp)
+{
+    switch (algo)
+    {
+    case Algo::Insertion: insertion_sort(v, comp); break;
+    case Algo::BinaryInsertion: binary_insertion_sort(v, comp); break;
+    case Algo::Bubble: bubble_sort(v, comp); break;
+    case Algo::Selection: selection_sort(v, comp); break;
+    case Algo::Shell: shell_sort(v, comp); break;
+    case Algo::Heap: heap_sort(v, comp); break;
+    case Algo::Merge: merge_sort(v, comp); break;
+    case Algo::Tim: tim_sort(v, comp); break;
+    case Algo::Quick: quick_sort(v, comp); break;
+    case Algo::Intro: intro_sort(v, comp); break;
+    case Algo::ParallelMerge: parallel_merge_sort(v, comp); break;
+    case Algo::ParallelSample: parallel_sample_sort(v, comp); break;
+    case Algo::StdSort: std::sort(v.begin(), v.end(), comp); break;
+    case Algo::StdStableSort: std::stable_sort(v.begin(), v.end(), comp); break;
+    default: break;
+    }
+}
+
+/**
+ * @brief 运行任意算法（调用前已用applicable检查）
+ */
+template <typename T>
+void run_sort(Algo algo, std::vector<T>& v)
+{
+    using Compare = typename default_compare<T>::type;
+    if (ALGOS[static_cast<size_t>(algo)].comparison)
+    {
+        run_comparison_sort(algo, v, Compare());
+        return;
+    }
+
+    if constexpr (std::is_integral<T>::value)
+    {
+        if (algo == Algo::Counting) counting_sort(v);
+        if (algo == Algo::RadixLsd) radix_sort_lsd(v, 256);
+        if (algo == Algo::Bucket) bucket_sort(v, std::max<size_t>(1, v.size() / 16));
+    }
+    if constexpr (std::is_arithmetic<T>::value)
+    {
+        if (algo == Algo::Radix256) radix256_sort(v);
+    }
+    if constexpr (std::is_floating_point<T>::value)
+    {
+        if (algo == Algo::Bucket && !v.empty())
+        {
+            auto mm = std::minmax_element(v.begin(), v.end());
+            bucket_sort(v, std::max<size_t>(1, v.size() / 16), *mm.first, *mm.second + 1.0);
+        }
+    }
+    if constexpr (std::is_same<T, Record>::value)
+    {
+        if (algo == Algo::Radix256) radix256_sort_by_key(v, [](const Record& r)
+                                                         { return r.key; });
+    }
+    if constexpr (std::is_same<T, std::string>::value)
+    {
+        if (algo == Algo::RadixMsd) radix_sort_msd(v);
+    }
+}
+
+// ===========================================================================
+// 测量与输出
+// ===========================================================================
+struct Options
+{
+    std::vector<size_t> sizes = {100, 1000, 10000, 100000, 1000000};
+    std::vector<std::string> types = {"int", "double", "string", "record"};
+    std::vector<std::string> dists;  ///< 为空表示全部
+    std::vector<std::string> algos;  ///< 为空表示全部
+    std::string format = "table";
+    std::string output;
+    double min_time = 0.05;          ///< 每个组合至少累计测量的时间（秒）
+    size_t max_reps = 1000;          ///< 每个组合最多重复次数
+    size_t quadratic_max = 10000;    ///< O(n²)算法运行的最大规模
+    bool counts = true;              ///< 是否做插桩运行
+    uint64_t seed = 20240601;
+};
+
+struct Result
+{
+    std::string type;
+    std::string dist;
+    size_t n;
+    std::string algo;
+    size_t reps;
+    double ns_median;   ///< 每元素耗时中位数（纳秒）
+    double ns_min;      ///< 每元素耗时最小值（纳秒）
+    double cmp_per_elem;  ///< 每元素比较次数，非比较型排序为-1
+    double move_per_elem; ///< 每元素移动次数，非比较型排序为-1
+    bool ok;            ///< 结果是否有序
+};
+
+bool selected(const std::vector<std::string>& filter, const std::string& name)
+{
+    return filter.empty() || std::find(filter.begin(), filter.end(), name) != filter.end();
+}
+
+/**
+ * @brief 测量一个(类型, 分布, 规模, 算法)组合
+ */
+template <typename T>
+Result measure(const Options& opt, const char* type_name, const char* dist_name, Algo algo, const std::vector<T>& input)
+{
+    using Compare = typename default_compare<T>::type;
+    using Clock = std::chrono::steady_clock;
+    const size_t n = input.size();
+
+    Result res{type_name, dist_name, n, ALGOS[static_cast<size_t>(algo)].name, 0, 0, 0, -1, -1, true};
+
+    // 计时运行：每次从原始输入拷贝（拷贝时间不计入），直到累计时间达到min_time
+    std::vector<double> samples;
+    double total = 0;
+    std::vector<T> work;
+    while (samples.size() < opt.max_reps && (samples.empty() || total < opt.min_time))
+    {
+        work = input;
+        auto start = Clock::now();
+        run_sort(algo, work);
+        double secs = std::chrono::duration<double>(Clock::now() - start).count();
+        samples.push_back(secs);
+        total += secs;
+    }
+    res.ok = std::is_sorted(work.begin(), work.end(), Compare());
+    std::sort(samples.begin(), samples.end());
+    const double per_elem = 1e9 / static_cast<double>(std::max<size_t>(n, 1));
+    res.reps = samples.size();
+    res.ns_median = samples[samples.size() / 2] * per_elem;
+    res.ns_min = samples.front() * per_elem;
+
+    // 插桩运行：统计比较/移动次数（插桩元素不是算术类型，intro_sort此时走普通分区而非无分支分区）
+    if (opt.counts && ALGOS[static_cast<size_t>(algo)].comparison)
+    {
+        std::vector<Tracked<T>> tracked;
+        tracked.reserve(n);
+        for (const T& v : input) tracked.emplace_back(v);
+        g_comparisons = 0;
+        g_moves = 0;
+        run_comparison_sort(algo, tracked, TrackedCompare<Compare>{Compare()});
+        res.cmp_per_elem = static_cast<double>(g_comparisons.load()) / std::max<size_t>(n, 1);
+        res.move_per_elem = static_cast<double>(g_moves.load()) / std::max<size_t>(n, 1);
+    }
+    return res;
+}
+
+template <typename T>
+void run_type(const Options& opt, const char* type_name, std::vector<Result>& results)
+{
+    for (size_t d = 0; d < DIST_COUNT; ++d)
+    {
+        if (!selected(opt.dists, DIST_NAMES[d])) continue;
+        for (size_t n : opt.sizes)
+        {
+            std::vector<int64_t> keys = make_keys(static_cast<Dist>(d), n, opt.seed + d);
+            std::vector<T> input;
+            input.reserve(n);
+            for (int64_t k : keys) input.push_back(make_value<T>(k));
+
+            for (size_t a = 0; a < ALGO_COUNT; ++a)
+            {
+                const Algo algo = static_cast<Algo>(a);
+                if (!selected(opt.algos, ALGOS[a].name)) continue;
+                if (ALGOS[a].quadratic && n > opt.quadratic_max) continue;
+                if (!applicable(algo, input)) continue;
+
+                results.push_back(measure(opt, type_name, DIST_NAMES[d], algo, input));
+                const Result& r = results.back();
+                fprintf(stderr, "\r%-8s %-14s %10zu %-22s %10.2f ns/elem%s", r.type.c_str(), r.dist.c_str(), r.n,
+                        r.algo.c_str(), r.ns_median, r.ok ? "" : "  NOT SORTED!");
+            }
+        }
+    }
+}
+
+void print_table(FILE* fp, const std::vector<Result>& results)
+{
+    fprintf(fp, "%-8s %-14s %10s %-22s %6s %12s %12s %10s %10s %s\n", "type", "dist", "n", "algo", "reps",
+            "ns/elem", "min ns/elem", "cmp/elem", "move/elem", "ok");
+    for (const Result& r : results)
+    {
+        fprintf(fp, "%-8s %-14s %10zu %-22s %6zu %12.2f %12.2f ", r.type.c_str(), r.dist.c_str(), r.n, r.algo.c_str(),
+                r.reps, r.ns_median, r.ns_min);
+        if (r.cmp_per_elem < 0)
+            fprintf(fp, "%10s %10s", "-", "-");
+        else
+            fprintf(fp, "%10.2f %10.2f", r.cmp_per_elem, r.move_per_elem);
+        fprintf(fp, " %s\n", r.ok ? "yes" : "NO");
+    }
+}
+
+void print_csv(FILE* fp, const std::vector<Result>& results)
+{
+    fprintf(fp, "type,dist,n,algo,reps,ns_per_elem,min_ns_per_elem,cmp_per_elem,move_per_elem,ok\n");
+    for (const Result& r : results)
+    {
+        fprintf(fp, "%s,%s,%zu,%s,%zu,%.3f,%.3f,", r.type.c_str(), r.dist.c_str(), r.n, r.algo.c_str(), r.reps,
+                r.ns_median, r.ns_min);
+        if (r.cmp_per_elem < 0)
+            fprintf(fp, ",");
+        else
+            fprintf(fp, "%.3f,%.3f", r.cmp_per_elem, r.move_per_elem);
+        fprintf(fp, ",%d\n", r.ok ? 1 : 0);
+    }
+}
+
+void print_json(FILE* fp, const std::vector<Result>& results)
+{
+#ifdef __VERSION__
+    const char* compiler = __VERSION__;
+#else
+    const char* compiler = "unknown";
+#endif
+    fprintf(fp, "{\n  \"benchmark\": \"ol_sort\",\n  \"compiler\": \"%s\",\n  \"results\": [\n", compiler);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Result& r = results[i];
+        fprintf(fp, "    {\"type\": \"%s\", \"dist\": \"%s\", \"n\": %zu, \"algo\": \"%s\", \"reps\": %zu, "
+                    "\"ns_per_elem\": %.3f, \"min_ns_per_elem\": %.3f, ",
+                r.type.c_str(), r.dist.c_str(), r.n, r.algo.c_str(), r.reps, r.ns_median, r.ns_min);
+        if (r.cmp_per_elem < 0)
+            fprintf(fp, "\"cmp_per_elem\": null, \"move_per_elem\": null, ");
+        else
+            fprintf(fp, "\"cmp_per_elem\": %.3f, \"move_per_elem\": %.3f, ", r.cmp_per_elem, r.move_per_elem);
+        fprintf(fp, "\"ok\": %s}%s\n", r.ok ? "true" : "false", i + 1 < results.size() ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+}
+
+// ===========================================================================
+// 命令行
+// ===========================================================================
+std::vector<std::string> split_list(const std::string& value)
+{
+    ccmdstr cmd(value, ",", true);
+    std::vector<std::string> items(cmd.size());
+    for (size_t i = 0; i < cmd.size(); ++i) cmd.getvalue(i, items[i]);
+    return items;
+}
+
+void usage(const char* prog)
+{
+    printf("Usage: %s [--sizes=100,1e4,1e6] [--types=int,double,string,record]\n"
+           "          [--dists=random,sorted,reverse,organ_pipe,few_unique,zipf,nearly_sorted]\n"
+           "          [--algos=intro_sort,tim_sort,...] [--format=table|csv|json] [--output=file]\n"
+           "          [--min-time=0.05] [--max-reps=1000] [--quadratic-max=10000] [--no-counts] [--seed=N]\n"
+           "Algorithms:",
+           prog);
+    for (const AlgoInfo& a : ALGOS) printf(" %s", a.name);
+    printf("\n");
+}
+
+bool parse_args(int argc, char* argv[], Options& opt)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        const size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--sizes")
+        {
+            opt.sizes.clear();
+            for (const std::string& s : split_list(value)) opt.sizes.push_back(static_cast<size_t>(std::stod(s)));
+        }
+        else if (key == "--types")
+            opt.types = split_list(value);
+        else if (key == "--dists")
+            opt.dists = split_list(value);
+        else if (key == "--algos")
+            opt.algos = split_list(value);
+        else if (key == "--format")
+            opt.format = value;
+        else if (key == "--output")
+            opt.output = value;
+        else if (key == "--min-time")
+            opt.min_time = std::stod(value);
+        else if (key == "--max-reps")
+            opt.max_reps = std::max<size_t>(1, static_cast<size_t>(std::stod(value)));
+        else if (key == "--quadratic-max")
+            opt.quadratic_max = static_cast<size_t>(std::stod(value));
+        else if (key == "--no-counts")
+            opt.counts = false;
+        else if (key == "--seed")
+            opt.seed = std::stoull(value);
+        else
+            return false;
+    }
+    return opt.format == "table" || opt.format == "csv" || opt.format == "json";
+}
+
+int main(int argc, char* argv[])
+{
+    Options opt;
+    try
+    {
+        if (!parse_args(argc, argv, opt))
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    catch (const std::exception&)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<Result> results;
+    for (const std::string& type : opt.types)
+    {
+        if (type == "int")
+            run_type<int>(opt, "int", results);
+        else if (type == "double")
+            run_type<double>(opt, "double", results);
+        else if (type == "string")
+            run_type<std::string>(opt, "string", results);
+        else if (type == "record")
+            run_type<Record>(opt, "record", results);
+        else
+            fprintf(stderr, "unknown type: %s\n", type.c_str());
+    }
+    fprintf(stderr, "\n");
+
+    FILE* fp = stdout;
+    if (!opt.output.empty() && (fp = fopen(opt.output.c_str(), "w")) == nullptr)
+    {
+        fprintf(stderr, "cannot open %s\n", opt.output.c_str());
+        return 1;
+    }
+
+    if (opt.format == "csv")
+        print_csv(fp, results);
+    else if (opt.format == "json")
+        print_json(fp, results);
+    else
+        print_table(fp, results);
+
+    if (fp != stdout) fclose(fp);
+
+    // 有任何结果未排好序时返回非0，便于在脚本中发现回归
+    for (const Result& r : results)
+        if (!r.ok) return 2;
+    return 0;
+}
@@ -0,0 +1,620 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_Future.h
+ * 功能描述：轻量级Future/Promise实现，支持在执行器（如ol::ThreadPool）上调度的延续任务，特性包括：
+ *          - then()：上游完成后把延续任务投递到执行器，不需要任何线程阻塞在get()上等待
+ *          - 异常传播：上游异常时跳过延续函数，异常原样传递给下游Future
+ *          - when_all/when_any：对一组Future做汇聚（全部完成/任一完成），结果本身也是Future，可继续then
+ *          - 与ol::ThreadPool集成：ThreadPool::submitAsync返回的Future默认把延续投递回同一线程池
+ * 作者：ol
+ * 适用标准：C++17及以上（需支持constexpr if、std::optional等特性）
+ */
+/****************************************************************************************/
+
+#ifndef OL_FUTURE_H
+#define OL_FUTURE_H 1
+
+#include "ol_Task.h"
+#include "ol_type_traits.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ol
+{
+    /**
+     * @brief 执行器类型：接收一个任务并负责在某处执行它
+     * @note 执行器丢弃任务（如线程池已停止）时，任务中持有的Promise被销毁，下游Future得到broken_promise异常
+     */
+    using Executor = std::function<void(Task)>;
+
+    template <typename T>
+    class Future;
+
+    template <typename T>
+    class Promise;
+
+    namespace base
+    {
+        /**
+         * @brief Future/Promise共享状态
+         * @tparam T 结果类型（可为void）
+         */
+        template <typename T>
+        struct FutureState
+        {
+            using Storage = std::conditional_t<std::is_void_v<T>, TypeEmpty, T>;
+
+            std::mutex mutex;                 ///< 保护以下成员
+            std::condition_variable condVar;  ///< 完成时唤醒wait()
+            bool ready = false;               ///< 是否已完成（值或异常）
+            std::optional<Storage> value;     ///< 结果值
+            std::exception_ptr exception;     ///< 结果异常
+            Task continuation;                ///< 完成回调（最多一个，由then/when_all/when_any注册）
+            Executor executor;                ///< 默认执行器（then未指定执行器时使用，为空则在完成线程上直接执行）
+
+            /**
+             * @brief 设置结果并触发完成回调
+             * @return 首次设置返回true，已完成返回false
+             */
+            template <typename... Args>
+            bool setValue(Args&&... args)
+            {
+                Task callback;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (ready) return false;
+                    value.emplace(std::forward<Args>(args)...);
+                    ready = true;
+                    callback = std::move(continuation);
+                }
+                condVar.notify_all();
+                if (callback) callback();
+                return true;
+            }
+
+            /**
+             * @brief 设置异常并触发完成回调
+             * @return 首次设置返回true，已完成返回false
+             */
+            bool setException(std::exception_ptr e)
+            {
+                Task callback;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (ready) return false;
+                    exception = std::move(e);
+                    ready = true;
+                    callback = std::move(continuation);
+                }
+                condVar.notify_all();
+                if (callback) callback();
+                return true;
+            }
+
+            /**
+             * @brief 注册完成回调，已完成时立即在当前线程执行
+             */
+            void onReady(Task callback)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!ready)
+                    {
+                        continuation = std::move(callback);
+                        return;
+                    }
+                }
+                callback();
+            }
+
+            bool isReady()
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                return ready;
+            }
+
+            void wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condVar.wait(lock, [this]()
+                             { return ready; });
+            }
+        };
+
+        /**
+         * @brief Future内部状态访问器（供when_all/when_any使用）
+         */
+        struct FutureAccess
+        {
+            template <typename T>
+            static const std::shared_ptr<FutureState<T>>& state(const Future<T>& future) { return future.m_state; }
+        };
+
+        // 调用f(args...)并把结果（或异常）写入promise
+        template <typename R, typename F, typename... Args>
+        void fulfill(Promise<R>& promise, F& f, Args&&... args)
+        {
+            try
+            {
+                if constexpr (std::is_void_v<R>)
+                {
+                    std::invoke(f, std::forward<Args>(args)...);
+                    promise.setValue();
+                }
+                else
+                {
+                    promise.setValue(std::invoke(f, std::forward<Args>(args)...));
+                }
+            }
+            catch (...)
+            {
+                promise.setException(std::current_exception());
+            }
+        }
+
+        // then()延续函数的返回类型：T为void时无参调用，否则以T&&调用
+        template <typename T, typename F>
+        struct ContinuationResult
+        {
+            using type = std::invoke_result_t<F, T&&>;
+        };
+
+        template <typename F>
+        struct ContinuationResult<void, F>
+        {
+            using type = std::invoke_result_t<F>;
+        };
+    } // namespace base
+
+    /**
+     * @brief Promise：结果的写入端
+     * @tparam T 结果类型（可为void）
+     * @note 只可移动；未设置结果就被销毁时，对应Future得到std::future_error(broken_promise)异常
+     */
+    template <typename T>
+    class Promise
+    {
+    private:
+        std::shared_ptr<base::FutureState<T>> m_state; ///< 共享状态
+        bool m_futureRetrieved;                        ///< getFuture()是否已调用
+
+    public:
+        /**
+         * @brief 构造Promise
+         * @param executor 对应Future的默认执行器（then未指定执行器时使用，默认为空即在完成线程上直接执行）
+         */
+        explicit Promise(Executor executor = Executor())
+            : m_state(std::make_shared<base::FutureState<T>>()), m_futureRetrieved(false)
+        {
+            m_state->executor = std::move(executor);
+        }
+
+        Promise(Promise&& other) noexcept
+            : m_state(std::move(other.m_state)), m_futureRetrieved(other.m_futureRetrieved) {}
+
+        Promise& operator=(Promise&& other) noexcept
+        {
+            if (this != &other)
+            {
+                abandon();
+                m_state = std::move(other.m_state);
+                m_futureRetrieved = other.m_futureRetrieved;
+            }
+            return *this;
+        }
+
+        Promise(const Promise&) = delete;
+        Promise& operator=(const Promise&) = delete;
+
+        ~Promise() { abandon(); }
+
+        /**
+         * @brief 获取对应的Future（只能调用一次）
+         * @throw std::future_error 重复获取或Promise已被移走时抛出
+         */
+        Future<T> getFuture()
+        {
+            if (!m_state) throw std::future_error(std::future_errc::no_state);
+            if (m_futureRetrieved) throw std::future_error(std::future_errc::future_already_retrieved);
+            m_futureRetrieved = true;
+            return Future<T>(m_state);
+        }
+
+        /**
+         * @brief 设置结果值，唤醒等待者并触发延续
+         * @throw std::future_error 已设置过结果时抛出
+         * @note 已注册的延续在调用线程上投递（或执行），执行器为空时延续函数会在本调用内同步运行
+         */
+        template <typename... Args>
+        void setValue(Args&&... args)
+        {
+            if (!m_state) throw std::future_error(std::future_errc::no_state);
+            if (!m_state->setValue(std::forward<Args>(args)...))
+                throw std::future_error(std::future_errc::promise_already_satisfied);
+        }
+
+        /**
+         * @brief 设置异常，唤醒等待者并触发延续
+         * @throw std::future_error 已设置过结果时抛出
+         */
+        void setException(std::exception_ptr e)
+        {
+            if (!m_state) throw std::future_error(std::future_errc::no_state);
+            if (!m_state->setException(std::move(e)))
+                throw std::future_error(std::future_errc::promise_already_satisfied);
+        }
+
+    private:
+        // 放弃共享状态：未设置结果时写入broken_promise异常
+        void abandon()
+        {
+            if (m_state)
+            {
+                m_state->setException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+                m_state.reset();
+            }
+        }
+    };
+
+    /**
+     * @brief Future：结果的读取端，支持then()延续
+     * @tparam T 结果类型（可为void）
+     * @note 只可移动，结果只能被消费一次：get()/then()/when_all/when_any调用后Future变为无效
+     * @warning 在线程池工作线程内对同一线程池的Future调用get()可能导致死锁，应优先使用then()
+     */
+    template <typename T>
+    class Future
+    {
+    private:
+        std::shared_ptr<base::FutureState<T>> m_state; ///< 共享状态
+
+        friend class Promise<T>;
+        friend struct base::FutureAccess;
+
+        explicit Future(std::shared_ptr<base::FutureState<T>> state) : m_state(std::move(state)) {}
+
+    public:
+        Future() = default;
+        Future(Future&&) noexcept = default;
+        Future& operator=(Future&&) noexcept = default;
+        Future(const Future&) = delete;
+        Future& operator=(const Future&) = delete;
+
+        /**
+         * @brief 判断Future是否关联了共享状态（未被消费）
+         */
+        bool valid() const noexcept { return m_state != nullptr; }
+
+        /**
+         * @brief 判断结果是否已就绪（不阻塞）
+         * @throw std::future_error Future无效时抛出
+         */
+        bool isReady() const
+        {
+            checkValid();
+            return m_state->isReady();
+        }
+
+        /**
+         * @brief 阻塞等待结果就绪
+         * @throw std::future_error Future无效时抛出
+         */
+        void wait() const
+        {
+            checkValid();
+            m_state->wait();
+        }
+
+        /**
+         * @brief 限时等待结果就绪
+         * @return 超时前就绪返回true，否则返回false
+         * @throw std::future_error Future无效时抛出
+         */
+        template <typename Rep, typename Period>
+        bool waitFor(std::chrono::duration<Rep, Period> timeout) const
+        {
+            checkValid();
+            std::unique_lock<std::mutex> lock(m_state->mutex);
+            return m_state->condVar.wait_for(lock, timeout, [this]()
+                                             { return m_state->ready; });
+        }
+
+        /**
+         * @brief 阻塞获取结果（调用后Future变为无效）
+         * @return 结果值（T为void时无返回值）
+         * @throw 上游异常原样抛出；Future无效时抛出std::future_error
+         */
+        T get()
+        {
+            checkValid();
+            std::shared_ptr<base::FutureState<T>> state = std::move(m_state);
+            state->wait();
+            if (state->exception) std::rethrow_exception(state->exception);
+            if constexpr (std::is_void_v<T>)
+                return;
+            else
+                return std::move(*state->value);
+        }
+
+        /**
+         * @brief 注册延续，在本Future的默认执行器上执行（submitAsync返回的Future为其线程池）
+         * @tparam F 延续函数类型：T为void时为f()，否则为f(T&&)
+         * @param f 延续函数
+         * @return 以延续函数返回值为结果的新Future，继承本Future的默认执行器
+         * @note 上游异常时不调用f，异常直接传递给返回的Future；f抛出的异常同样写入返回的Future
+         * @note 调用后本Future变为无效
+         */
+        template <typename F>
+        auto then(F&& f) -> Future<typename base::ContinuationResult<T, std::decay_t<F>>::type>
+        {
+            checkValid();
+            Executor executor = m_state->executor;
+            return then(std::move(executor), std::forward<F>(f));
+        }
+
+        /**
+         * @brief 注册延续，在指定执行器上执行
+         * @param executor 执行延续的执行器（为空时在上游完成的线程上直接执行）
+         * @param f 延续函数
+         * @return 以延续函数返回值为结果的新Future，默认执行器为executor
+         * @note 上游已完成时立即投递；执行器丢弃任务时返回的Future得到broken_promise异常
+         */
+        template <typename F>
+        auto then(Executor executor, F&& f) -> Future<typename base::ContinuationResult<T, std::decay_t<F>>::type>
+        {
+            using R = typename base::ContinuationResult<T, std::decay_t<F>>::type;
+
+            checkValid();
+            Promise<R> promise(executor);
+            Future<R> result = promise.getFuture();
+
+            std::shared_ptr<base::FutureState<T>> state = std::move(m_state);
+            base::FutureState<T>* upstream = state.get();
+            upstream->onReady(
+                [state = std::move(state), executor = std::move(executor),
+                 promise = std::move(promise), f = std::forward<F>(f)]() mutable
+                {
+                    Task job([state = std::move(state), promise = std::move(promise), f = std::move(f)]() mutable
+                             {
+                                 if (state->exception)
+                                     promise.setException(state->exception);
+                                 else if constexpr (std::is_void_v<T>)
+                                     base::fulfill(promise, f);
+                                 else
+                                     base::fulfill(promise, f, std::move(*state->value));
+                             });
+                    if (executor)
+                        executor(std::move(job));
+                    else
+                        job();
+                });
+
+            return result;
+        }
+
+    private:
+        void checkValid() const
+        {
+            if (!m_state) throw std::future_error(std::future_errc::no_state);
+        }
+    };
+
+    /**
+     * @brief 创建已就绪的Future
+     * @param value 结果值
+     * @param executor 返回Future的默认执行器（默认为空）
+     */
+    template <typename T>
+    Future<std::decay_t<T>> makeReadyFuture(T&& value, Executor executor = Executor())
+    {
+        Promise<std::decay_t<T>> promise(std::move(executor));
+        Future<std::decay_t<T>> future = promise.getFuture();
+        promise.setValue(std::forward<T>(value));
+        return future;
+    }
+
+    /**
+     * @brief 创建已就绪的Future<void>
+     * @param executor 返回Future的默认执行器（默认为空）
+     */
+    inline Future<void> makeReadyFuture(Executor executor = Executor())
+    {
+        Promise<void> promise(std::move(executor));
+        Future<void> future = promise.getFuture();
+        promise.setValue();
+        return future;
+    }
+
+    /**
+     * @brief when_any的结果：首个完成的Future下标及全部Future
+     * @tparam Sequence Future容器类型
+     */
+    template <typename Sequence>
+    struct WhenAnyResult
+    {
+        size_t index;       ///< 首个完成的Future在序列中的下标（序列为空时为static_cast<size_t>(-1)）
+        Sequence futures;   ///< 全部Future（下标index的已就绪，其余可能仍未完成）
+    };
+
+    /**
+     * @brief 等待区间内的所有Future完成
+     * @tparam InputIt 输入迭代器类型，元素为ol::Future<T>
+     * @return Future<std::vector<Future<T>>>，全部完成后就绪，其中每个Future均已就绪（值或异常）
+     * @note 区间内的Future被移动，调用后不应再使用；区间为空时返回已就绪的空数组
+     * @note 不阻塞任何线程：最后一个完成的Future在其完成线程上设置结果
+     */
+    template <typename InputIt>
+    auto when_all(InputIt first, InputIt last)
+        -> Future<std::vector<typename std::iterator_traits<InputIt>::value_type>>
+    {
+        using FutureType = typename std::iterator_traits<InputIt>::value_type;
+        using Sequence = std::vector<FutureType>;
+
+        struct Context
+        {
+            Sequence futures;
+            std::atomic_size_t remaining;
+            Promise<Sequence> promise;
+        };
+
+        auto ctx = std::make_shared<Context>();
+        for (; first != last; ++first) ctx->futures.emplace_back(std::move(*first));
+        Future<Sequence> result = ctx->promise.getFuture();
+
+        if (ctx->futures.empty())
+        {
+            ctx->promise.setValue(Sequence());
+            return result;
+        }
+
+        // 先收集状态指针再注册：回调可能在注册过程中触发并移走futures
+        std::vector<std::decay_t<decltype(base::FutureAccess::state(ctx->futures.front()))>> states;
+        states.reserve(ctx->futures.size());
+        for (const auto& future : ctx->futures) states.push_back(base::FutureAccess::state(future));
+
+        ctx->remaining.store(states.size(), std::memory_order_relaxed);
+        for (const auto& state : states)
+        {
+            state->onReady([ctx]()
+                           {
+                               if (ctx->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                                   ctx->promise.setValue(std::move(ctx->futures));
+                           });
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief 等待容器内的所有Future完成（容器版本）
+     * @note 与迭代器版本一致，容器元素会被移动
+     */
+    template <typename Container>
+    auto when_all(Container& futures)
+    {
+        return when_all(std::begin(futures), std::end(futures));
+    }
+
+    /**
+     * @brief 等待多个不同类型的Future全部完成
+     * @tparam Ts 各Future的结果类型
+     * @return Future<std::tuple<Future<Ts>...>>，全部完成后就绪
+     * @note 参数中的Future被移动，调用后不应再使用
+     */
+    template <typename... Ts>
+    Future<std::tuple<Future<Ts>...>> when_all(Future<Ts>&&... futures)
+    {
+        using Sequence = std::tuple<Future<Ts>...>;
+
+        struct Context
+        {
+            Sequence futures;
+            std::atomic_size_t remaining;
+            Promise<Sequence> promise;
+        };
+
+        auto ctx = std::make_shared<Context>();
+        ctx->futures = Sequence(std::move(futures)...);
+        Future<Sequence> result = ctx->promise.getFuture();
+
+        if constexpr (sizeof...(Ts) == 0)
+        {
+            ctx->promise.setValue(Sequence());
+        }
+        else
+        {
+            auto states = std::apply([](const auto&... f)
+                                     { return std::make_tuple(base::FutureAccess::state(f)...); },
+                                     ctx->futures);
+
+            ctx->remaining.store(sizeof...(Ts), std::memory_order_relaxed);
+            std::apply([&ctx](const auto&... state)
+                       { (state->onReady([ctx]()
+                                         {
+                                             if (ctx->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                                                 ctx->promise.setValue(std::move(ctx->futures));
+                                         }),
+                          ...); },
+                       states);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief 等待区间内任一Future完成
+     * @tparam InputIt 输入迭代器类型，元素为ol::Future<T>
+     * @return Future<WhenAnyResult<std::vector<Future<T>>>>，首个Future完成（值或异常）时就绪
+     * @note 区间内的Future被移动，调用后不应再使用；区间为空时立即就绪且index为static_cast<size_t>(-1)
+     * @note 其余Future在结果中原样返回，可继续等待或丢弃
+     */
+    template <typename InputIt>
+    auto when_any(InputIt first, InputIt last)
+        -> Future<WhenAnyResult<std::vector<typename std::iterator_traits<InputIt>::value_type>>>
+    {
+        using FutureType = typename std::iterator_traits<InputIt>::value_type;
+        using Sequence = std::vector<FutureType>;
+        using Result = WhenAnyResult<Sequence>;
+
+        struct Context
+        {
+            Sequence futures;
+            std::atomic_bool done{false};
+            Promise<Result> promise;
+        };
+
+        auto ctx = std::make_shared<Context>();
+        for (; first != last; ++first) ctx->futures.emplace_back(std::move(*first));
+        Future<Result> result = ctx->promise.getFuture();
+
+        if (ctx->futures.empty())
+        {
+            ctx->promise.setValue(Result{static_cast<size_t>(-1), Sequence()});
+            return result;
+        }
+
+        // 先收集状态指针再注册：回调可能在注册过程中触发并移走futures
+        std::vector<std::decay_t<decltype(base::FutureAccess::state(ctx->futures.front()))>> states;
+        states.reserve(ctx->futures.size());
+        for (const auto& future : ctx->futures) states.push_back(base::FutureAccess::state(future));
+
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            // 注册过程中若已有Future完成，其余无需再注册
+            if (ctx->done.load(std::memory_order_acquire)) break;
+
+            states[i]->onReady([ctx, i]()
+                               {
+                                   if (!ctx->done.exchange(true, std::memory_order_acq_rel))
+                                       ctx->promise.setValue(Result{i, std::move(ctx->futures)});
+                               });
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief 等待容器内任一Future完成（容器版本）
+     * @note 与迭代器版本一致，容器元素会被移动
+     */
+    template <typename Container>
+    auto when_any(Container& futures)
+    {
+        return when_any(std::begin(futures), std::end(futures));
+    }
+
+} // namespace ol
+
+#endif // !OL_FUTURE_H
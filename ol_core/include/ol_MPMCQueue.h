@@ -0,0 +1,212 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_MPMCQueue.h
+ * 功能描述：无锁有界多生产者多消费者队列（Dmitry Vyukov算法），特性包括：
+ *          - 每个槽位带一个序号，入队/出队只需对各自的位置计数做一次CAS，无互斥锁、无锁护航
+ *          - 入队位置、出队位置和每个槽位都按缓存行对齐，生产者与消费者之间没有伪共享
+ *          - 容量在构造时确定，任意正整数均可（2的幂时用位与代替取模）
+ *          - 非阻塞接口：队列满/空时立即返回false，阻塞等待由调用方决定（如ol::ThreadPool）
+ * 作者：ol
+ * 适用标准：C++17及以上（需支持对齐new、constexpr if等特性）
+ */
+/****************************************************************************************/
+
+#ifndef OL_MPMCQUEUE_H
+#define OL_MPMCQUEUE_H 1
+
+#include "ol_type_traits.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ol
+{
+    /**
+     * @brief 无锁有界MPMC队列
+     * @tparam T 元素类型（移动构造/移动赋值/析构不得抛出异常）
+     * @note 所有成员函数均可被任意线程并发调用；size()/empty()为近似值，仅用于统计和调度提示
+     * @note 元素进出队列按FIFO顺序，但多生产者之间的相对顺序由各自CAS成功的先后决定
+     * @example ol::MPMCQueue<int> queue(1024); queue.tryPush(1); int v; queue.tryPop(v);
+     */
+    template <typename T>
+    class MPMCQueue : public TypeNonCopyableMovable
+    {
+        static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>,
+                      "MPMCQueue element type must be nothrow move constructible and destructible");
+
+    public:
+        static constexpr size_t kCacheLineSize = 64; ///< 缓存行大小（字节）
+
+    private:
+        // 槽位：序号等于入队位置时可写入，等于入队位置+1时可读出，读出后推进一整圈（+容量）
+        struct alignas(kCacheLineSize) Cell
+        {
+            std::atomic_size_t sequence;                 ///< 槽位序号
+            alignas(T) unsigned char storage[sizeof(T)]; ///< 元素存储区
+        };
+
+        const size_t m_capacity;        ///< 队列容量
+        const size_t m_mask;            ///< 容量为2的幂时为容量-1，否则为0（取模计算槽位）
+        std::unique_ptr<Cell[]> m_cells; ///< 槽位数组
+
+        alignas(kCacheLineSize) std::atomic_size_t m_enqueuePos; ///< 下一个入队位置（生产者独占缓存行）
+        alignas(kCacheLineSize) std::atomic_size_t m_dequeuePos; ///< 下一个出队位置（消费者独占缓存行）
+        char m_padding[kCacheLineSize - sizeof(std::atomic_size_t)]; ///< 填充，避免与相邻对象共享缓存行
+
+    public:
+        /**
+         * @brief 构造队列
+         * @param capacity 队列容量（必须大于0）
+         * @throw std::invalid_argument 当capacity为0时抛出
+         */
+        explicit MPMCQueue(size_t capacity)
+            : m_capacity(capacity),
+              m_mask((capacity & (capacity - 1)) == 0 ? capacity - 1 : 0),
+              m_enqueuePos(0), m_dequeuePos(0)
+        {
+            if (capacity == 0) throw std::invalid_argument("[ol::MPMCQueue] Capacity must be greater than 0");
+
+            m_cells.reset(new Cell[capacity]);
+            for (size_t i = 0; i < capacity; ++i) m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 析构函数，销毁队列中剩余的元素
+         * @warning 析构时不得有其他线程仍在访问队列
+         */
+        ~MPMCQueue()
+        {
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                size_t last = m_enqueuePos.load(std::memory_order_relaxed);
+                for (size_t pos = m_dequeuePos.load(std::memory_order_relaxed); pos != last; ++pos)
+                {
+                    Cell& cell = m_cells[index(pos)];
+                    if (cell.sequence.load(std::memory_order_relaxed) == pos + 1) element(cell)->~T();
+                }
+            }
+        }
+
+        /**
+         * @brief 尝试入队（拷贝）
+         * @return 成功返回true，队列满返回false
+         */
+        bool tryPush(const T& value) { return tryEmplace(value); }
+
+        /**
+         * @brief 尝试入队（移动）
+         * @return 成功返回true；队列满返回false，此时value保持不变
+         */
+        bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+        /**
+         * @brief 尝试在队尾原地构造元素
+         * @param args 元素构造参数
+         * @return 成功返回true；队列满返回false，此时不会构造元素，参数保持不变
+         * @note 构造不得抛出异常（槽位一旦占用就必须发布），可能抛出的构造应先在外部完成再移动入队
+         */
+        template <typename... Args>
+        bool tryEmplace(Args&&... args)
+        {
+            static_assert(std::is_nothrow_constructible_v<T, Args&&...>,
+                          "MPMCQueue::tryEmplace requires a nothrow constructor");
+
+            Cell* cell;
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &m_cells[index(pos)];
+                size_t seq = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                }
+                else if (diff < 0)
+                {
+                    return false; // 槽位尚未被消费：队列满
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed); // 被其他生产者抢先，重新读取位置
+                }
+            }
+
+            ::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 尝试出队
+         * @param value 出队元素（移动赋值）
+         * @return 成功返回true，队列空返回false（此时value保持不变）
+         */
+        bool tryPop(T& value)
+        {
+            static_assert(std::is_nothrow_move_assignable_v<T>, "MPMCQueue::tryPop requires a nothrow move assignment");
+
+            Cell* cell;
+            size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &m_cells[index(pos)];
+                size_t seq = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+                if (diff == 0)
+                {
+                    if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                }
+                else if (diff < 0)
+                {
+                    return false; // 槽位尚未写入：队列空
+                }
+                else
+                {
+                    pos = m_dequeuePos.load(std::memory_order_relaxed); // 被其他消费者抢先，重新读取位置
+                }
+            }
+
+            T* elem = element(*cell);
+            value = std::move(*elem);
+            elem->~T();
+            cell->sequence.store(pos + m_capacity, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief 获取队列容量
+         */
+        size_t capacity() const noexcept { return m_capacity; }
+
+        /**
+         * @brief 获取队列中的元素数（近似值，并发修改时可能瞬时偏差）
+         */
+        size_t size() const noexcept
+        {
+            size_t dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+            size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+            if (enqueuePos <= dequeuePos) return 0;
+            size_t n = enqueuePos - dequeuePos;
+            return n < m_capacity ? n : m_capacity;
+        }
+
+        /**
+         * @brief 判断队列是否为空（近似值）
+         */
+        bool empty() const noexcept { return size() == 0; }
+
+    private:
+        size_t index(size_t pos) const noexcept { return m_mask != 0 ? (pos & m_mask) : (pos % m_capacity); }
+
+        static T* element(Cell& cell) noexcept { return std::launder(reinterpret_cast<T*>(cell.storage)); }
+    };
+
+} // namespace ol
+
+#endif // !OL_MPMCQUEUE_H
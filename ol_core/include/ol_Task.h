@@ -0,0 +1,229 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_Task.h
+ * 功能描述：只可移动的无参任务包装类，用于替代任务队列中的std::function<void()>，特性包括：
+ *          - 小对象内联存储：不超过kInlineSize字节的可调用对象直接存放在Task内部，不申请堆内存
+ *          - 只可移动：可以直接持有std::packaged_task等不可拷贝的对象，无需再包一层std::shared_ptr
+ *          - 大对象自动回退到堆存储，接口与std::function<void()>保持一致（operator()、operator bool）
+ * 作者：ol
+ * 适用标准：C++17及以上（需支持constexpr if、类型萃取等特性）
+ */
+/****************************************************************************************/
+
+#ifndef OL_TASK_H
+#define OL_TASK_H 1
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ol
+{
+    /**
+     * @brief 只可移动的无参任务包装类（带小对象内联存储）
+     * @note 可调用对象满足以下条件时内联存储：大小不超过kInlineSize、对齐不超过std::max_align_t、移动构造不抛异常
+     * @note 整个对象大小为64字节（一条缓存行），队列中连续存放时不会跨缓存行共享
+     * @note 调用空任务会抛出std::bad_function_call，与std::function一致
+     * @example ol::Task task([p = std::move(packagedTask)]() mutable { p(); });
+     */
+    class Task
+    {
+    public:
+        static constexpr size_t kInlineSize = 48; ///< 内联存储容量（字节）
+
+    private:
+        // 按可调用对象类型生成的操作表
+        struct VTable
+        {
+            void (*invoke)(void* storage);               ///< 调用可调用对象
+            void (*move)(void* dst, void* src) noexcept; ///< 把src中的可调用对象移动到dst（src随后由destroy销毁）
+            void (*destroy)(void* storage) noexcept;     ///< 销毁可调用对象
+        };
+
+        template <typename F>
+        static constexpr bool kFitsInline = sizeof(F) <= kInlineSize &&
+                                            alignof(F) <= alignof(std::max_align_t) &&
+                                            std::is_nothrow_move_constructible_v<F>;
+
+        // 内联存储的操作表
+        template <typename F>
+        struct InlineOps
+        {
+            static void invoke(void* storage) { (*static_cast<F*>(storage))(); }
+            static void move(void* dst, void* src) noexcept { ::new (dst) F(std::move(*static_cast<F*>(src))); }
+            static void destroy(void* storage) noexcept { static_cast<F*>(storage)->~F(); }
+            static constexpr VTable vtable{&invoke, &move, &destroy};
+        };
+
+        // 堆存储的操作表（storage中存放F*）
+        template <typename F>
+        struct HeapOps
+        {
+            static F*& ptr(void* storage) { return *static_cast<F**>(storage); }
+            static void invoke(void* storage) { (*ptr(storage))(); }
+            static void move(void* dst, void* src) noexcept
+            {
+                ::new (dst) F*(ptr(src));
+                ptr(src) = nullptr;
+            }
+            static void destroy(void* storage) noexcept { delete ptr(storage); }
+            static constexpr VTable vtable{&invoke, &move, &destroy};
+        };
+
+        // 判断可调用对象是否为空：空函数指针、空成员指针、空std::function
+        template <typename F>
+        struct IsStdFunction : std::false_type
+        {
+        };
+        template <typename Sig>
+        struct IsStdFunction<std::function<Sig>> : std::true_type
+        {
+        };
+
+        template <typename F>
+        static bool isNull(const F& f) noexcept
+        {
+            if constexpr (std::is_pointer_v<F> || std::is_member_pointer_v<F> || IsStdFunction<F>::value)
+                return !f;
+            else
+                return false;
+        }
+
+        alignas(std::max_align_t) unsigned char m_storage[kInlineSize]; ///< 可调用对象存储区（内联对象或堆对象指针）
+        const VTable* m_vtable;                                         ///< 操作表，为nullptr表示空任务
+
+    public:
+        /**
+         * @brief 构造空任务
+         */
+        Task() noexcept : m_vtable(nullptr) {}
+
+        /**
+         * @brief 构造空任务
+         */
+        Task(std::nullptr_t) noexcept : m_vtable(nullptr) {}
+
+        /**
+         * @brief 从可调用对象构造任务
+         * @tparam F 可调用对象类型（无参调用，返回值被忽略）
+         * @param f 可调用对象，会被移动或拷贝到Task内部
+         * @note 满足内联条件时不申请堆内存，否则在堆上构造一份
+         * @note 空函数指针、空成员指针、空std::function构造出空任务（operator bool返回false），与std::function一致
+         */
+        template <typename F,
+                  typename Fn = std::decay_t<F>,
+                  typename = std::enable_if_t<!std::is_same_v<Fn, Task> && std::is_invocable_v<Fn&>>>
+        Task(F&& f) : m_vtable(nullptr)
+        {
+            if (isNull<Fn>(f)) return;
+
+            if constexpr (kFitsInline<Fn>)
+            {
+                ::new (static_cast<void*>(m_storage)) Fn(std::forward<F>(f));
+                m_vtable = &InlineOps<Fn>::vtable;
+            }
+            else
+            {
+                ::new (static_cast<void*>(m_storage)) Fn*(new Fn(std::forward<F>(f)));
+                m_vtable = &HeapOps<Fn>::vtable;
+            }
+        }
+
+        /**
+         * @brief 移动构造，other变为空任务
+         */
+        Task(Task&& other) noexcept : m_vtable(other.m_vtable)
+        {
+            if (m_vtable)
+            {
+                m_vtable->move(m_storage, other.m_storage);
+                other.reset();
+            }
+        }
+
+        /**
+         * @brief 移动赋值，other变为空任务
+         */
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                if (other.m_vtable)
+                {
+                    m_vtable = other.m_vtable;
+                    m_vtable->move(m_storage, other.m_storage);
+                    other.reset();
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * @brief 赋值为空任务
+         */
+        Task& operator=(std::nullptr_t) noexcept
+        {
+            reset();
+            return *this;
+        }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        /**
+         * @brief 析构函数，销毁持有的可调用对象
+         */
+        ~Task() { reset(); }
+
+        /**
+         * @brief 执行任务
+         * @throw std::bad_function_call 任务为空时抛出；可调用对象自身抛出的异常原样传出
+         */
+        void operator()()
+        {
+            if (!m_vtable) throw std::bad_function_call();
+            m_vtable->invoke(m_storage);
+        }
+
+        /**
+         * @brief 判断任务是否非空
+         * @return 持有可调用对象返回true，空任务返回false
+         */
+        explicit operator bool() const noexcept { return m_vtable != nullptr; }
+
+        /**
+         * @brief 销毁持有的可调用对象，变为空任务
+         */
+        void reset() noexcept
+        {
+            if (m_vtable)
+            {
+                m_vtable->destroy(m_storage);
+                m_vtable = nullptr;
+            }
+        }
+
+        /**
+         * @brief 交换两个任务
+         */
+        void swap(Task& other) noexcept
+        {
+            Task temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+        }
+
+        /**
+         * @brief 判断可调用对象类型F是否会被内联存储（不申请堆内存）
+         * @tparam F 可调用对象类型
+         */
+        template <typename F>
+        static constexpr bool isInlinable() noexcept { return kFitsInline<std::decay_t<F>>; }
+    };
+
+} // namespace ol
+
+#endif // !OL_TASK_H
@@ -4,11 +4,29 @@
  * 功能描述：通用线程池模板类的实现，支持以下特性：
  *          - 双模式支持：固定线程数模式（默认）和动态扩缩容模式（通过模板参数控制）
  *          - 任务管理：支持无返回值任务（addTask）和带返回值任务（submitTask）
+ *          - 异步组合：submitAsync返回ol::Future，then()延续默认投递回本线程池，配合when_all/when_any
+ *            构建扇出/扇入流水线，不阻塞任何工作线程
+ *          - 任务存储：使用只可移动、带内联存储的ol::Task，小任务入队不申请堆内存
+ *          - 任务优先级：高/普通/低三条任务通道，高优先级连续执行有上限、低优先级按等待轮数老化，防止饥饿；
+ *            默认普通优先级走原有FIFO路径，无额外开销
+ *          - 定时任务：scheduleAfter/scheduleEvery基于最小堆和单个定时线程（首次使用时创建），返回可取消的TimerHandle
+ *          - 批量提交：addTasks/submitBatch一次加锁批量入队，并按批量大小唤醒相应数量的工作线程
  *          - 队列策略：任务队列满时可选择拒绝、阻塞等待或超时等待策略
+ *          - 有界无锁队列：设置最大队列容量（且未启用工作窃取）时，普通优先级任务走无锁MPMC环形队列（ol::MPMCQueue），
+ *            提交和取任务均不加锁，仅在工作线程空闲休眠、生产者因队列满等待时才使用互斥锁和条件变量；
+ *            普通优先级通道的容量为maxQueueSize，高/低优先级通道按所有通道的任务总数限制（总数最多约为2×maxQueueSize）
  *          - 线程安全：通过互斥锁和条件变量保证多线程环境下的操作安全性
+ *          - 工作窃取（固定模式可选）：每个工作线程拥有本地双端队列，外部提交走共享注入队列，
+ *            空闲线程从其他线程的本地队列头部窃取任务，避免所有任务争抢同一把锁
+ *          - CPU亲和性（固定模式可选）：工作线程可逐核固定、限定在CPU集合内或按NUMA节点分组，
+ *            NUMA分组时可启用节点本地队列（工作窃取时优先窃取同节点线程的任务）
+ *          - 运行指标（可选）：enableMetrics()开启后统计排队延迟/执行耗时直方图、完成数和每个工作线程的忙碌比例，
+ *            计数写入各工作线程独占的槽位，getStats()读取时再汇总，热路径无共享写竞争
  *          - 动态特性（当模板参数IsDynamic=true时）：
  *              - 自动根据任务负载扩缩容线程数量（在minThreads和maxThreads范围内）
- *              - 可配置管理者线程检查间隔，平衡响应速度和资源消耗
+ *              - 管理者线程按毫秒级间隔采样排队数、完成速率和利用率，默认策略（EwmaScalingPolicy）
+ *                基于排队等待时间的指数加权移动平均决定线程数，扩缩容阈值带滞回，缩容有冷却时间，避免抖动
+ *              - 扩缩容策略可通过ScalingPolicy接口替换
  * 作者：ol
  * 适用标准：C++17及以上（需支持constexpr if、模板条件类型等特性）
  */
@@ -17,15 +35,25 @@
 #ifndef OL_THREADPOOL_H
 #define OL_THREADPOOL_H 1
 
+#include "ol_Future.h"
+#include "ol_MPMCQueue.h"
+#include "ol_Task.h"
+#include "ol_affinity.h"
+#include "ol_mutex.h"
 #include "ol_type_traits.h"
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <cstdint>
 #include <queue>
 #include <deque>
 #include <functional>
 #include <future>
+#include <iterator>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <thread>
@@ -38,6 +66,265 @@
 
 namespace ol
 {
+    /**
+     * @brief 线程池任务优先级
+     * @note 默认kNormal，走原有FIFO队列；kHigh/kLow进入独立通道，仅在存在此类任务时才参与调度选择
+     */
+    enum class TaskPriority : char
+    {
+        kHigh,   ///< 高优先级（延迟敏感任务，如心跳应答）
+        kNormal, ///< 普通优先级（默认）
+        kLow     ///< 低优先级（后台批量任务）
+    };
+
+    /**
+     * @brief 线程池定时任务句柄，用于取消scheduleAfter/scheduleEvery添加的定时任务
+     * @note 可拷贝，所有副本指向同一个定时任务；默认构造或提交失败时为无效句柄
+     * @note 取消只影响尚未开始执行的触发，正在执行的任务不会被中断
+     */
+    class TimerHandle
+    {
+    public:
+        // 定时任务共享状态（由线程池定时线程和句柄共同持有）
+        struct State
+        {
+            Task task;                              ///< 定时执行的任务
+            std::chrono::steady_clock::duration period; ///< 周期（0表示一次性任务）
+            TaskPriority priority;                  ///< 触发时投递到线程池的优先级
+            std::atomic_bool cancelled{false};      ///< 是否已取消
+            std::atomic_bool running{false};        ///< 周期任务上一次触发是否仍在执行（执行中则跳过本次触发，避免重叠）
+        };
+
+    private:
+        std::shared_ptr<State> m_state; ///< 定时任务共享状态
+
+    public:
+        TimerHandle() = default;
+        explicit TimerHandle(std::shared_ptr<State> state) : m_state(std::move(state)) {}
+
+        /**
+         * @brief 取消定时任务
+         * @return 本次调用成功取消返回true；句柄无效或已取消返回false
+         */
+        bool cancel()
+        {
+            return m_state && !m_state->cancelled.exchange(true, std::memory_order_acq_rel);
+        }
+
+        /**
+         * @brief 判断定时任务是否已取消
+         */
+        bool isCancelled() const { return m_state && m_state->cancelled.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 判断句柄是否有效（提交成功）
+         */
+        bool valid() const { return m_state != nullptr; }
+    };
+
+    /**
+     * @brief 耗时直方图快照（按2的幂划分纳秒区间）
+     * @note 桶0统计0ns，桶i（1 <= i < kBucketNum-1）统计[2^(i-1), 2^i)ns，最后一个桶统计所有更大的值
+     */
+    struct LatencyHistogram
+    {
+        static constexpr size_t kBucketNum = 32; ///< 桶数量（最后一个桶起点约为1.07秒）
+
+        std::array<uint64_t, kBucketNum> buckets{}; ///< 各桶计数
+        uint64_t count = 0;                         ///< 样本总数
+        uint64_t totalNs = 0;                       ///< 样本总耗时（纳秒）
+        uint64_t maxNs = 0;                         ///< 最大样本（纳秒）
+
+        /**
+         * @brief 计算耗时所属的桶
+         * @param ns 耗时（纳秒）
+         */
+        static size_t bucketOf(uint64_t ns)
+        {
+            size_t width = 0;
+            while (ns != 0 && width < kBucketNum - 1)
+            {
+                ns >>= 1;
+                ++width;
+            }
+            return width;
+        }
+
+        /**
+         * @brief 平均耗时（纳秒），无样本时为0
+         */
+        double meanNs() const { return count == 0 ? 0.0 : static_cast<double>(totalNs) / count; }
+
+        /**
+         * @brief 估算分位数（纳秒）
+         * @param p 分位（0~1，如0.99）
+         * @return 分位数所在桶的上界（最后一个桶返回maxNs），无样本时为0
+         */
+        uint64_t percentileNs(double p) const
+        {
+            if (count == 0) return 0;
+            uint64_t rank = static_cast<uint64_t>(p * count);
+            if (rank >= count) rank = count - 1;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < kBucketNum; ++i)
+            {
+                seen += buckets[i];
+                if (seen > rank) return i + 1 < kBucketNum ? std::min(uint64_t(1) << i, maxNs) : maxNs;
+            }
+            return maxNs;
+        }
+
+        /**
+         * @brief 合并另一个直方图
+         */
+        void merge(const LatencyHistogram& other)
+        {
+            for (size_t i = 0; i < kBucketNum; ++i) buckets[i] += other.buckets[i];
+            count += other.count;
+            totalNs += other.totalNs;
+            maxNs = std::max(maxNs, other.maxNs);
+        }
+    };
+
+    /**
+     * @brief 单个工作线程的运行指标
+     */
+    struct WorkerStats
+    {
+        size_t id;          ///< 工作线程编号（按创建顺序递增，动态模式下退出的线程编号不复用）
+        uint64_t completed; ///< 已完成任务数
+        uint64_t busyNs;    ///< 执行任务的累计耗时（纳秒）
+        uint64_t elapsedNs; ///< 统计时长（纳秒）：自线程启动或开启指标起，取较晚者
+        double busyRatio;   ///< 忙碌比例 = busyNs / elapsedNs
+    };
+
+    /**
+     * @brief 线程池运行指标快照（由ThreadPool::getStats()返回）
+     */
+    struct ThreadPoolStats
+    {
+        uint64_t completed = 0;          ///< 已完成任务数（含已退出的工作线程）
+        uint64_t rejected = 0;           ///< 队列满被拒绝的提交数（拒绝策略）
+        uint64_t timedOut = 0;           ///< 队列满等待超时的提交数（超时策略）
+        LatencyHistogram queueLatency;   ///< 入队到开始执行的排队延迟
+        LatencyHistogram execTime;       ///< 任务执行耗时
+        std::vector<WorkerStats> workers; ///< 当前存活工作线程的指标
+        double busyRatio = 0.0;          ///< 存活工作线程的总体忙碌比例
+    };
+
+    /**
+     * @brief 动态扩缩容采样（管理者线程每个采样周期生成一次，传给ScalingPolicy::decide）
+     */
+    struct ScalingSample
+    {
+        std::chrono::nanoseconds interval; ///< 距上一次采样的时间
+        size_t workerNum;                  ///< 当前有效工作线程数（不含已通知退出的线程）
+        size_t idleNum;                    ///< 当前空闲线程数
+        size_t queuedNum;                  ///< 当前排队任务数
+        size_t completedNum;               ///< 本采样周期内完成的任务数
+        size_t minThreads;                 ///< 线程数下限
+        size_t maxThreads;                 ///< 线程数上限
+    };
+
+    /**
+     * @brief 动态扩缩容策略接口
+     * @note decide()只在管理者线程中调用，实现无需考虑线程安全，可在内部保存平滑状态
+     * @note 线程池会把返回值限制在[minThreads, maxThreads]内，单次扩容最多翻倍，
+     *       缩容受冷却时间（checkInterval）限制且只回收空闲线程，策略本身无需处理这些约束
+     */
+    class ScalingPolicy
+    {
+    public:
+        virtual ~ScalingPolicy() = default;
+
+        /**
+         * @brief 根据采样决定目标线程数
+         * @param sample 本次采样
+         * @return 期望的工作线程数（等于sample.workerNum表示保持不变）
+         */
+        virtual size_t decide(const ScalingSample& sample) = 0;
+    };
+
+    /**
+     * @brief 默认扩缩容策略：基于排队等待时间和吞吐量的指数加权移动平均（EWMA）
+     * @note 扩容：排队数超过scaleUpBacklog*线程数（滞回上沿）且估算排队等待时间超过targetQueueWait时，
+     *       按单线程吞吐量计算清空积压所需的线程数；尚无完成样本时用积压持续时间代替等待时间
+     * @note 缩容：队列为空且平滑后的利用率低于scaleDownUtilization（滞回下沿）时，
+     *       缩到恰好让利用率回到scaleDownUtilization的线程数
+     * @note 估算排队等待时间按利特尔法则：排队数 / 平滑后的完成速率
+     */
+    class EwmaScalingPolicy : public ScalingPolicy
+    {
+    public:
+        struct Options
+        {
+            std::chrono::milliseconds targetQueueWait{50};  ///< 可接受的排队等待时间
+            double scaleUpBacklog = 1.0;                    ///< 扩容所需的每线程排队任务数下限
+            double scaleDownUtilization = 0.5;              ///< 低于该平滑利用率才缩容
+            std::chrono::milliseconds smoothing{100};       ///< EWMA时间常数
+        };
+
+    private:
+        Options m_options;                           ///< 策略参数
+        double m_completionRate;                     ///< 平滑后的完成速率（任务/秒）
+        double m_utilization;                        ///< 平滑后的利用率（忙碌线程/线程数）
+        std::chrono::nanoseconds m_backlogAge;       ///< 队列持续非空的时间
+
+    public:
+        EwmaScalingPolicy() : EwmaScalingPolicy(Options()) {}
+
+        explicit EwmaScalingPolicy(const Options& options)
+            : m_options(options), m_completionRate(0.0), m_utilization(0.0), m_backlogAge(0)
+        {
+            if (options.targetQueueWait.count() <= 0 || options.smoothing.count() <= 0 ||
+                options.scaleUpBacklog < 0.0 || options.scaleDownUtilization <= 0.0 || options.scaleDownUtilization > 1.0)
+                throw std::invalid_argument("[ol::EwmaScalingPolicy] Invalid options");
+        }
+
+        const Options& options() const { return m_options; }
+        double completionRate() const { return m_completionRate; }
+        double utilization() const { return m_utilization; }
+
+        size_t decide(const ScalingSample& sample) override
+        {
+            const double dt = std::chrono::duration<double>(sample.interval).count();
+            const size_t workers = sample.workerNum;
+            if (dt <= 0.0 || workers == 0) return std::max<size_t>(workers, 1);
+
+            // 时间常数固定，alpha随采样间隔变化，采样抖动不影响平滑效果
+            const double alpha = 1.0 - std::exp(-dt / std::chrono::duration<double>(m_options.smoothing).count());
+            const size_t busy = workers - std::min(sample.idleNum, workers);
+            m_completionRate += alpha * (sample.completedNum / dt - m_completionRate);
+            m_utilization += alpha * (static_cast<double>(busy) / workers - m_utilization);
+            m_backlogAge = sample.queuedNum > 0 ? m_backlogAge + sample.interval : std::chrono::nanoseconds(0);
+
+            const double queued = static_cast<double>(sample.queuedNum);
+            if (queued > m_options.scaleUpBacklog * workers)
+            {
+                const double targetWait = std::chrono::duration<double>(m_options.targetQueueWait).count();
+                const double waitEst = m_completionRate > 0.0 ? queued / m_completionRate
+                                                              : std::chrono::duration<double>(m_backlogAge).count();
+                if (waitEst <= targetWait) return workers;
+
+                // 单线程吞吐量未知时按积压逐个追加线程（线程池会限制单次增量）
+                const double perThread = m_completionRate / std::max(m_utilization * workers, 1.0);
+                if (perThread <= 0.0) return workers + sample.queuedNum;
+
+                // 在targetQueueWait内清空积压所需的线程数
+                const double needed = std::ceil((m_completionRate + queued / targetWait) / perThread);
+                return std::max(workers + 1, static_cast<size_t>(std::min(needed, static_cast<double>(sample.maxThreads))));
+            }
+
+            if (sample.queuedNum == 0 && m_utilization < m_options.scaleDownUtilization)
+            {
+                const double needed = std::ceil(m_utilization * workers / m_options.scaleDownUtilization);
+                return std::max(static_cast<size_t>(needed), sample.minThreads);
+            }
+
+            return workers;
+        }
+    };
+
     /**
      * @brief 线程池模板类，支持动态/固定两种工作模式
      * @tparam IsDynamic 是否启用动态模式：true为动态扩缩容模式，false为固定线程数模式（默认）
@@ -61,7 +348,14 @@ namespace ol
         mutable std::mutex m_workersMutex;                                                                                            ///< 保护工作线程集合的互斥锁
         typename std::conditional_t<IsDynamic, std::unordered_map<std::thread::id, std::thread>, std::vector<std::thread>> m_workers; ///< 工作线程集合
         mutable std::mutex m_taskQueueMutex;                                                                                          ///< 保护任务队列的互斥锁
-        std::queue<std::function<void()>> m_taskQueue;                                                                                ///< 任务队列
+        std::queue<Task> m_taskQueue;                                                                                                 ///< 任务队列（普通优先级通道）
+        std::queue<Task> m_highTaskQueue;                                                                                             ///< 高优先级任务通道
+        std::queue<Task> m_lowTaskQueue;                                                                                              ///< 低优先级任务通道
+        std::atomic_size_t m_priorityTaskNum;                                                                                         ///< 高/低优先级通道中的任务总数（为0时直接走普通FIFO路径）
+        size_t m_highStreak;                                                                                                          ///< 在普通任务等待时已连续执行的高优先级任务数
+        size_t m_lowSkipped;                                                                                                          ///< 低优先级任务等待期间已被跳过的调度轮数
+        static constexpr size_t kHighBurstLimit = 8;                                                                                  ///< 普通任务等待时，高优先级最多连续执行的任务数
+        static constexpr size_t kLowAgingLimit = 16;                                                                                  ///< 低优先级任务被跳过多少轮后强制执行一次
         std::condition_variable m_taskQueueNotEmpty_condVar;                                                                          ///< 任务队列非空条件变量
         std::condition_variable m_taskQueueNotFull_condVar;                                                                           ///< 任务队列非满条件变量
         std::atomic_bool m_stop;                                                                                                      ///< 停止标志
@@ -70,6 +364,78 @@ namespace ol
         QueueFullPolicy m_queueFullPolicy;                                                                                            ///< 队列满策略
         std::chrono::milliseconds m_timeoutMS;                                                                                        ///< 超时时间（毫秒）
 
+        // 工作窃取模式成员（仅固定模式可启用）
+        struct alignas(64) WorkerQueue
+        {
+            spin_mutex mutex;       ///< 保护本地队列的自旋锁
+            std::deque<Task> tasks; ///< 本地任务队列（所属线程在尾部LIFO存取，窃取者从头部FIFO窃取）
+        };
+        bool m_workStealing;                           ///< 是否启用工作窃取模式
+        std::unique_ptr<WorkerQueue[]> m_workerQueues; ///< 每个工作线程的本地队列
+        size_t m_workerQueueNum;                       ///< 本地队列数量（等于工作线程数）
+        std::vector<int> m_workerNodes;                ///< 节点本地队列模式：每个工作线程所属的NUMA节点（为空表示不区分节点）
+        std::atomic_size_t m_pendingTaskNum;           ///< 工作窃取/有界无锁模式：所有队列中的待执行任务总数
+        std::atomic_size_t m_sleepingWorkers;          ///< 工作窃取/有界无锁模式：休眠等待任务的工作线程数
+        std::atomic_size_t m_blockedProducers;         ///< 工作窃取/有界无锁模式：因队列满而阻塞等待的提交者数
+
+        // 有界无锁模式成员（maxQueueSize > 0且未启用工作窃取时启用）
+        std::unique_ptr<MPMCQueue<Task>> m_boundedQueue; ///< 普通优先级通道的无锁环形队列（容量为maxQueueSize）
+
+        inline static thread_local const ThreadPool* t_ownerPool = nullptr; ///< 当前线程所属的线程池（非工作线程为nullptr）
+        inline static thread_local size_t t_workerIndex = 0;                ///< 当前工作线程的本地队列序号
+
+        // 运行指标成员
+        // 单写者直方图：只由所属工作线程写入（relaxed读-改-写，无RMW指令），读取方汇总
+        struct AtomicHistogram
+        {
+            std::array<std::atomic_uint64_t, LatencyHistogram::kBucketNum> buckets{};
+            std::atomic_uint64_t count{0};
+            std::atomic_uint64_t totalNs{0};
+            std::atomic_uint64_t maxNs{0};
+
+            static void bump(std::atomic_uint64_t& counter, uint64_t value)
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+
+            void add(uint64_t ns)
+            {
+                bump(buckets[LatencyHistogram::bucketOf(ns)], 1);
+                bump(count, 1);
+                bump(totalNs, ns);
+                if (ns > maxNs.load(std::memory_order_relaxed)) maxNs.store(ns, std::memory_order_relaxed);
+            }
+
+            void snapshot(LatencyHistogram& out) const
+            {
+                LatencyHistogram h;
+                for (size_t i = 0; i < h.kBucketNum; ++i) h.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+                h.count = count.load(std::memory_order_relaxed);
+                h.totalNs = totalNs.load(std::memory_order_relaxed);
+                h.maxNs = maxNs.load(std::memory_order_relaxed);
+                out.merge(h);
+            }
+        };
+        // 每个工作线程独占的指标槽位（按缓存行对齐，避免不同线程的槽位伪共享）
+        struct alignas(64) MetricsSlot
+        {
+            size_t id;                                  ///< 工作线程编号
+            std::chrono::steady_clock::time_point start; ///< 线程启动时间
+            AtomicHistogram queueLatency;               ///< 排队延迟
+            AtomicHistogram execTime;                   ///< 执行耗时
+            std::atomic_uint64_t completed{0};          ///< 已完成任务数
+            std::atomic_uint64_t busyNs{0};             ///< 执行任务累计耗时
+        };
+        std::atomic_bool m_metricsEnabled;                       ///< 是否开启运行指标统计
+        mutable std::mutex m_metricsMutex;                       ///< 保护指标槽位集合的互斥锁（仅线程启动/退出和读取时使用）
+        std::vector<std::unique_ptr<MetricsSlot>> m_metricsSlots; ///< 存活工作线程的指标槽位
+        ThreadPoolStats m_retiredStats;                          ///< 已退出工作线程的累计指标
+        size_t m_metricsWorkerSeq;                               ///< 工作线程编号生成器
+        std::chrono::steady_clock::time_point m_metricsSince;    ///< 最近一次开启指标的时间
+        std::atomic_uint64_t m_rejectedNum;                      ///< 被拒绝的提交数
+        std::atomic_uint64_t m_timedOutNum;                      ///< 等待超时的提交数
+        inline static thread_local MetricsSlot* t_metricsSlot = nullptr; ///< 当前工作线程的指标槽位
+
         // 动态模式特有成员
         struct DynamicMembers
         {
@@ -79,26 +445,59 @@ namespace ol
             std::atomic_size_t workerExitNum;               ///< 工作线程需销毁数
             mutable std::mutex managerMutex;                ///< 管理者线程锁（只是为了事件通知让管理者在睡眠中退出）
             std::condition_variable managerExit_condVar;    ///< 管理者线程退出条件变量
-            std::chrono::seconds checkInterval;             ///< 管理者检查间隔（秒）
+            std::chrono::seconds checkInterval;             ///< 缩容冷却时间（秒，距上一次扩缩容至少间隔该时间才缩容）
+            std::chrono::milliseconds sampleInterval;       ///< 管理者采样间隔（毫秒）
+            std::shared_ptr<ScalingPolicy> scalingPolicy;   ///< 扩缩容策略（受managerMutex保护）
+            std::atomic_size_t completedNum;                ///< 累计完成任务数（供管理者计算吞吐量）
             std::thread managerThread;                      ///< 管理者线程
             mutable std::mutex workerExitId_dequeMutex;     ///< 保护工作线程退出ID队列的互斥锁
             std::deque<std::thread::id> workerExitId_deque; ///< 工作线程退出ID队列
         };
         typename std::conditional_t<IsDynamic, DynamicMembers, TypeEmpty> m_dynamic; ///< 动态模式成员
 
+        // 定时任务成员
+        struct TimerEntry
+        {
+            std::chrono::steady_clock::time_point when; ///< 下一次触发时间
+            uint64_t seq;                               ///< 添加序号（触发时间相同时先加入的先触发）
+            std::shared_ptr<TimerHandle::State> state;  ///< 定时任务共享状态
+
+            // 最小堆比较（std::push_heap默认构造最大堆，故反向比较）
+            bool operator<(const TimerEntry& other) const
+            {
+                return when != other.when ? when > other.when : seq > other.seq;
+            }
+        };
+        std::mutex m_timerMutex;                 ///< 保护定时任务堆的互斥锁
+        std::condition_variable m_timer_condVar; ///< 定时线程等待条件变量（新任务更早到期或线程池停止时唤醒）
+        std::vector<TimerEntry> m_timerHeap;     ///< 定时任务最小堆（按触发时间）
+        uint64_t m_timerSeq;                     ///< 定时任务添加序号
+        std::thread m_timerThread;               ///< 定时线程（首次添加定时任务时创建）
+
     public:
         /**
          * @brief 固定模式构造函数（仅IsDynamic=false时可用）
          * @param threadNum 固定线程数量（必须大于0，否则线程池初始化为停止状态）
-         * @param maxQueueSize 任务队列最大容量（0表示无限制，默认0）
+         * @param maxQueueSize 任务队列最大容量（0表示无限制，默认0；有界无锁模式下为普通优先级通道的容量，见addTask()）
+         * @param workStealing 是否启用工作窃取模式（默认false）
+         * @param placement 工作线程的CPU放置策略（默认不绑定），WorkerPlacement::numa(true)会自动启用工作窃取模式
          * @note 线程池初始化时会创建指定数量的工作线程
+         * @note 亲和性设置失败（如CPU编号不存在）时输出错误信息，线程继续以默认调度运行
+         * @note 工作窃取模式下，工作线程内提交的任务进入本地队列，外部线程提交的任务进入共享注入队列，
+         *       队列容量限制作用于所有队列的任务总数（工作线程内提交时为近似限制）
          * @throw 无异常抛出（线程数为0时仅初始化停止状态）
          */
         template <bool D = IsDynamic, typename = std::enable_if_t<!D>>
-        ThreadPool(size_t threadNum, size_t maxQueueSize = 0)
-            : m_stop(false), m_activeWorkers(0),
+        ThreadPool(size_t threadNum, size_t maxQueueSize = 0, bool workStealing = false,
+                   const WorkerPlacement& placement = WorkerPlacement())
+            : m_priorityTaskNum(0), m_highStreak(0), m_lowSkipped(0),
+              m_stop(false), m_activeWorkers(0),
               m_maxQueueSize(maxQueueSize),
-              m_queueFullPolicy(QueueFullPolicy::kReject), m_timeoutMS(std::chrono::milliseconds(500))
+              m_queueFullPolicy(QueueFullPolicy::kReject), m_timeoutMS(std::chrono::milliseconds(500)),
+              m_workStealing(false), m_workerQueueNum(0),
+              m_pendingTaskNum(0), m_sleepingWorkers(0), m_blockedProducers(0),
+              m_metricsEnabled(false), m_metricsWorkerSeq(0), m_rejectedNum(0), m_timedOutNum(0),
+              m_timerSeq(0)
         {
             if (threadNum == 0)
             {
@@ -106,13 +505,40 @@ namespace ol
                 return;
             }
 
+            std::vector<WorkerPlacement::Slot> slots = placement.assign(threadNum);
+
+            // 工作窃取模式：为每个工作线程创建本地队列
+            if (workStealing || placement.nodeLocalQueues())
+            {
+                m_workStealing = true;
+                m_workerQueues.reset(new WorkerQueue[threadNum]);
+                m_workerQueueNum = threadNum;
+
+                // 节点本地队列：记录每个工作线程所属节点，窃取时同节点优先
+                if (placement.nodeLocalQueues())
+                {
+                    m_workerNodes.resize(threadNum);
+                    for (size_t i = 0; i < threadNum; ++i) m_workerNodes[i] = slots[i].node;
+                }
+            }
+            else if (maxQueueSize > 0)
+            {
+                // 有界无锁模式：普通优先级通道使用无锁环形队列
+                m_boundedQueue.reset(new MPMCQueue<Task>(maxQueueSize));
+            }
+
             // 启动固定数量的工作线程
             m_workers.reserve(threadNum);
-            while (threadNum > 0)
+            for (size_t i = 0; i < threadNum; ++i)
             {
                 m_activeWorkers.fetch_add(1, std::memory_order_acq_rel);
-                m_workers.emplace_back(&ThreadPool<IsDynamic>::worker, this);
-                --threadNum;
+                if (m_workStealing)
+                    m_workers.emplace_back(&ThreadPool<IsDynamic>::stealingWorker, this, i);
+                else
+                    m_workers.emplace_back(&ThreadPool<IsDynamic>::worker, this);
+
+                if (!slots[i].cpus.empty() && !setThreadAffinity(m_workers.back(), slots[i].cpus))
+                    fprintf(stderr, "[ol::ThreadPool] Failed to set CPU affinity for worker %zu\n", i);
             }
         }
 
@@ -120,8 +546,8 @@ namespace ol
          * @brief 动态模式构造函数（仅IsDynamic=true时可用）
          * @param minThreadNum 最小线程数（默认0，实际会至少创建1个线程）
          * @param maxThreadNum 最大线程数（默认CPU核心数）
-         * @param maxQueueSize 任务队列最大容量（0表示无限制，默认0）
-         * @param checkInterval 管理者线程检查间隔（秒，默认1秒）
+         * @param maxQueueSize 任务队列最大容量（0表示无限制，默认0；有界无锁模式下为普通优先级通道的容量，见addTask()）
+         * @param checkInterval 缩容冷却时间（秒，默认1秒）：距上一次扩缩容不足该时间时不缩容，避免抖动
          * @note 初始化时会创建minThreadNum个线程（若minThreadNum=0则创建1个;若minThreadNum=maxThreadNum=0则线程池初始化为停止状态）
          * @throw std::invalid_argument 当 minThreadNum > maxThreadNum 时抛出
          */
@@ -130,9 +556,14 @@ namespace ol
                    size_t maxThreadNum = std::thread::hardware_concurrency(),
                    size_t maxQueueSize = 0,
                    std::chrono::seconds checkInterval = std::chrono::seconds(1))
-            : m_stop(false), m_activeWorkers(0),
+            : m_priorityTaskNum(0), m_highStreak(0), m_lowSkipped(0),
+              m_stop(false), m_activeWorkers(0),
               m_maxQueueSize(maxQueueSize),
-              m_queueFullPolicy(QueueFullPolicy::kReject), m_timeoutMS(std::chrono::milliseconds(500))
+              m_queueFullPolicy(QueueFullPolicy::kReject), m_timeoutMS(std::chrono::milliseconds(500)),
+              m_workStealing(false), m_workerQueueNum(0),
+              m_pendingTaskNum(0), m_sleepingWorkers(0), m_blockedProducers(0),
+              m_metricsEnabled(false), m_metricsWorkerSeq(0), m_rejectedNum(0), m_timedOutNum(0),
+              m_timerSeq(0)
         {
             if (minThreadNum > maxThreadNum) throw std::invalid_argument("[ol::ThreadPool] Invalid thread number range");
 
@@ -151,6 +582,12 @@ namespace ol
             m_dynamic.idleThreads = 0;
             m_dynamic.workerExitNum = 0;
             m_dynamic.checkInterval = checkInterval;
+            m_dynamic.sampleInterval = std::chrono::milliseconds(10);
+            m_dynamic.scalingPolicy = std::make_shared<EwmaScalingPolicy>();
+            m_dynamic.completedNum = 0;
+
+            // 有界无锁模式：普通优先级通道使用无锁环形队列
+            if (maxQueueSize > 0) m_boundedQueue.reset(new MPMCQueue<Task>(maxQueueSize));
 
             m_workers.reserve(minThreadNum);
             while (minThreadNum > 0)
@@ -212,6 +649,33 @@ namespace ol
             // 确保 m_stop 对所有线程可见
             std::atomic_thread_fence(std::memory_order_seq_cst);
 
+            // 停止定时线程，未触发的定时任务全部丢弃：加锁只取出定时任务堆，任务在解锁后析构，
+            // 避免任务捕获的对象在析构时调用scheduleAfter()等接口而死锁
+            std::vector<TimerEntry> droppedTimers;
+            {
+                std::lock_guard<std::mutex> lock(m_timerMutex);
+                droppedTimers.swap(m_timerHeap);
+            }
+            droppedTimers.clear();
+            m_timer_condVar.notify_all();
+            {
+                // 定时线程可能正阻塞在队列满等待中
+                std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+            }
+            m_taskQueueNotFull_condVar.notify_all();
+            if (m_timerThread.joinable())
+            {
+                try
+                {
+                    m_timerThread.join();
+                }
+                catch (const std::system_error& e)
+                {
+                    fprintf(stderr, "[ol::ThreadPool] Timer thread join failed: %s\n", e.what());
+                }
+                m_timerThread = std::thread();
+            }
+
             // 动态模式：先停止管理者线程
             if constexpr (IsDynamic)
             {
@@ -245,7 +709,10 @@ namespace ol
 #endif
             }
 
-            // 唤醒所有等待的工作线程
+            // 唤醒所有等待的工作线程（先获取一次队列锁，避免线程在检查条件后、进入等待前错过通知）
+            {
+                std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+            }
             m_taskQueueNotEmpty_condVar.notify_all();
             m_taskQueueNotFull_condVar.notify_all();
 
@@ -282,11 +749,11 @@ namespace ol
                         }
                         catch (const std::exception& e)
                         {
-                            fprintf(stderr, "[ol::ThreadPool] Dynamic mode: Thread(ID:%zu) join failed: %s\n", id, e.what());
+                            fprintf(stderr, "[ol::ThreadPool] Dynamic mode: Thread(ID:%zu) join failed: %s\n", std::hash<std::thread::id>{}(id), e.what());
                         }
                         catch (...)
                         {
-                            fprintf(stderr, "[ol::ThreadPool] Dynamic mode: Thread(ID:%zu) join catch unknown exception\n", id);
+                            fprintf(stderr, "[ol::ThreadPool] Dynamic mode: Thread(ID:%zu) join catch unknown exception\n", std::hash<std::thread::id>{}(id));
                         }
                     }
 #ifdef DEBUG
@@ -313,11 +780,11 @@ namespace ol
                         }
                         catch (const std::exception& e)
                         {
-                            fprintf(stderr, "[ol::ThreadPool] Fixed mode: Thread(ID:%zu) join failed: %s\n", th.get_id(), e.what());
+                            fprintf(stderr, "[ol::ThreadPool] Fixed mode: Thread(ID:%zu) join failed: %s\n", std::hash<std::thread::id>{}(th.get_id()), e.what());
                         }
                         catch (...)
                         {
-                            fprintf(stderr, "[ol::ThreadPool] Fixed mode: Thread(ID:%zu) join catch unknown exception\n", th.get_id());
+                            fprintf(stderr, "[ol::ThreadPool] Fixed mode: Thread(ID:%zu) join catch unknown exception\n", std::hash<std::thread::id>{}(th.get_id()));
                         }
                     }
 #ifdef DEBUG
@@ -343,8 +810,10 @@ namespace ol
          */
         inline size_t getTaskNum() const
         {
+            if (m_workStealing || m_boundedQueue) return m_pendingTaskNum.load(std::memory_order_acquire);
+
             std::lock_guard<std::mutex> lock(m_taskQueueMutex);
-            return m_taskQueue.size();
+            return queuedTaskNum();
         }
 
         /**
@@ -405,59 +874,215 @@ namespace ol
         }
 
         /**
-         * @brief 动态模式特有：设置管理者线程的检查间隔
-         * @param interval 检查间隔（秒）
-         * @note 仅IsDynamic=true时可用，用于调整扩缩容的响应速度
+         * @brief 动态模式特有：设置缩容冷却时间
+         * @param interval 冷却时间（秒），距上一次扩缩容不足该时间时不缩容
+         * @note 仅IsDynamic=true时可用；扩容不受冷却时间限制，采样频率由setSampleInterval设置
          */
         template <bool D = IsDynamic, typename = std::enable_if_t<D>>
         void setCheckInterval(std::chrono::seconds interval)
         {
+            std::lock_guard<std::mutex> lock(m_dynamic.managerMutex);
             m_dynamic.checkInterval = interval;
         }
 
+        /**
+         * @brief 动态模式特有：设置管理者线程的采样间隔
+         * @param interval 采样间隔（毫秒，默认10毫秒），越小对突发负载反应越快
+         * @throw std::invalid_argument 当interval<=0时抛出
+         */
+        template <bool D = IsDynamic, typename = std::enable_if_t<D>>
+        void setSampleInterval(std::chrono::milliseconds interval)
+        {
+            if (interval.count() <= 0)
+                throw std::invalid_argument("[ol::ThreadPool] Sample interval must be greater than 0");
+            std::lock_guard<std::mutex> lock(m_dynamic.managerMutex);
+            m_dynamic.sampleInterval = interval;
+        }
+
+        /**
+         * @brief 动态模式特有：替换扩缩容策略
+         * @param policy 新策略（为空时恢复默认的EwmaScalingPolicy）
+         * @note 策略只在管理者线程中调用，替换后从下一次采样开始生效
+         */
+        template <bool D = IsDynamic, typename = std::enable_if_t<D>>
+        void setScalingPolicy(std::shared_ptr<ScalingPolicy> policy)
+        {
+            if (!policy) policy = std::make_shared<EwmaScalingPolicy>();
+            std::lock_guard<std::mutex> lock(m_dynamic.managerMutex);
+            m_dynamic.scalingPolicy = std::move(policy);
+        }
+
         /**
          * @brief 添加无返回值任务到线程池
-         * @param task 待执行的任务（std::function<void()>类型）
+         * @param task 待执行的任务（ol::Task类型，可由任意无参可调用对象隐式构造）
+         * @param priority 任务优先级（默认普通优先级）
          * @return 任务添加成功返回true，失败返回false（线程池已停止或队列满且策略为拒绝/超时）
-         * @note 线程安全，根据当前队列策略处理满队列情况
+         * @note 线程安全，根据当前队列策略处理满队列情况。普通模式/工作窃取模式下，队列容量限制作用于所有优先级通道的任务总数；
+         *       有界无锁模式下，普通优先级通道只受无锁环形队列容量（maxQueueSize）限制，高/低优先级任务在所有通道的任务总数
+         *       达到maxQueueSize时受限，因此任务总数最多约为2×maxQueueSize
+         * @note 工作窃取模式下，工作线程内提交的普通优先级任务在队列未满时直接进入本地队列，不竞争共享锁
          * @warning 如果任务有异常虽然会将异常输出到错误流，但推荐自己包装一下函数，设置异常处理函数
          */
-        bool addTask(std::function<void()> task)
+        bool addTask(Task task, TaskPriority priority = TaskPriority::kNormal)
         {
-            if (m_stop.load(std::memory_order_acquire)) return false;
+            return tryAddTask(task, priority);
+        }
+
+        /**
+         * @brief 批量添加无返回值任务到线程池
+         * @tparam InputIt 输入迭代器类型，元素需可转换为ol::Task
+         * @param first 起始迭代器
+         * @param last 结束迭代器
+         * @param priority 整批任务的优先级（默认普通优先级）
+         * @return 成功入队的任务数（按顺序入队，返回n表示前n个任务已入队）
+         * @note 整批任务只获取一次队列锁，入队后按批量大小唤醒工作线程（批量不小于线程数时notify_all）
+         * @note 队列满时对剩余任务逐个应用当前队列策略：拒绝策略立即返回已入队数，阻塞/超时策略在等待前先唤醒工作线程消费已入队任务
+         * @note 区间内的元素会被移动（std::move），调用后不应再使用
+         */
+        template <typename InputIt>
+        size_t addTasks(InputIt first, InputIt last, TaskPriority priority = TaskPriority::kNormal)
+        {
+            if (m_stop.load(std::memory_order_acquire)) return 0;
+
+            size_t added = 0;
+
+            // 工作窃取模式：本线程池的工作线程在无容量限制时整批压入本地队列
+            if (m_workStealing && priority == TaskPriority::kNormal && t_ownerPool == this && m_maxQueueSize == 0)
+            {
+                WorkerQueue& queue = m_workerQueues[t_workerIndex];
+                {
+                    std::lock_guard<spin_mutex> lock(queue.mutex);
+                    for (; first != last; ++first, ++added) queue.tasks.emplace_back(prepareTask(std::move(*first)));
+                }
+                m_pendingTaskNum.fetch_add(added, std::memory_order_seq_cst);
+                if (m_sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+                    }
+                    wakeWorkers(added);
+                }
+                return added;
+            }
+
+            // 有界无锁模式：普通优先级任务逐个无锁入队，连续入队的部分合并为一次计数发布和唤醒
+            if (m_boundedQueue && priority == TaskPriority::kNormal)
+            {
+                size_t unpublished = 0; // 已入队但尚未发布到任务计数的任务数
+                for (; first != last; ++first)
+                {
+                    Task task = prepareTask(std::move(*first));
+                    if (m_boundedQueue->tryPush(std::move(task)))
+                    {
+                        ++unpublished;
+                        ++added;
+                        continue;
+                    }
+
+                    // 队列已满：先发布并唤醒工作线程消费本批已入队的任务，再按队列策略处理
+                    publishBounded(unpublished);
+                    unpublished = 0;
+                    if (m_queueFullPolicy == QueueFullPolicy::kReject)
+                    {
+                        m_rejectedNum.fetch_add(1, std::memory_order_relaxed);
+                        break;
+                    }
+                    if (!pushBoundedSlow(task)) break;
+                    ++added;
+                }
+                publishBounded(unpublished);
+                return added;
+            }
 
+            size_t notified = 0; // 已唤醒过工作线程的任务数
             {
                 std::unique_lock<std::mutex> lock(m_taskQueueMutex);
 
-                // 处理队列大小限制
-                if (m_maxQueueSize > 0)
+                for (; first != last; ++first)
                 {
-                    while (m_taskQueue.size() >= m_maxQueueSize && !m_stop.load(std::memory_order_acquire))
+                    // 队列已满且即将等待：先唤醒工作线程消费本批已入队的任务，避免自身阻塞导致无人消费
+                    if (m_maxQueueSize > 0 && added > notified && queuedTaskNum() >= m_maxQueueSize)
                     {
-                        switch (m_queueFullPolicy)
-                        {
-                        case QueueFullPolicy::kReject:
-                            return false;
-                        case QueueFullPolicy::kBlock:
-                            m_taskQueueNotFull_condVar.wait(lock, [this]()
-                                                            { return m_taskQueue.size() < m_maxQueueSize || m_stop.load(std::memory_order_acquire); });
-                            break;
-                        case QueueFullPolicy::kTimeout:
-                            bool result = m_taskQueueNotFull_condVar.wait_for(lock, m_timeoutMS,
-                                                                              [this]()
-                                                                              { return m_taskQueue.size() < m_maxQueueSize || m_stop.load(std::memory_order_acquire); });
-                            if (!result) return false;
-                            break;
-                        }
+                        wakeWorkers(added - notified);
+                        notified = added;
                     }
+
+                    if (!waitNotFull(lock)) break;
+
+                    pushTaskLocked(prepareTask(std::move(*first)), priority);
+                    ++added;
                 }
+            }
 
-                if (m_stop.load(std::memory_order_acquire)) return false;
-                m_taskQueue.push(std::move(task));
+            wakeWorkers(added - notified);
+            return added;
+        }
+
+        /**
+         * @brief 批量添加无返回值任务到线程池（容器版本）
+         * @tparam Container 容器类型（支持std::begin/std::end）
+         * @param tasks 任务容器，元素会被移动
+         * @param priority 整批任务的优先级（默认普通优先级）
+         * @return 成功入队的任务数
+         * @note 与迭代器版本一致
+         */
+        template <typename Container>
+        size_t addTasks(Container& tasks, TaskPriority priority = TaskPriority::kNormal)
+        {
+            return addTasks(std::begin(tasks), std::end(tasks), priority);
+        }
+
+        /**
+         * @brief 批量提交带返回值的任务到线程池
+         * @tparam InputIt 输入迭代器类型，元素为无参可调用对象
+         * @param first 起始迭代器
+         * @param last 结束迭代器
+         * @param priority 整批任务的优先级（默认普通优先级）
+         * @return pair<成功入队的任务数, 与区间内任务一一对应的std::future对象数组>
+         * @note 内部通过addTasks一次加锁入队；未能入队的任务对应的future.get()会抛出与submitTask一致的异常
+         * @note 区间内的元素会被移动（std::move），调用后不应再使用
+         */
+        template <typename InputIt>
+        auto submitBatch(InputIt first, InputIt last, TaskPriority priority = TaskPriority::kNormal)
+            -> std::pair<size_t, std::vector<std::future<typename std::invoke_result_t<typename std::iterator_traits<InputIt>::value_type&>>>>
+        {
+            using ReturnType = typename std::invoke_result_t<typename std::iterator_traits<InputIt>::value_type&>;
+
+            std::vector<Task> tasks;
+            std::vector<std::future<ReturnType>> results;
+            for (; first != last; ++first)
+            {
+                std::packaged_task<ReturnType()> task(std::move(*first));
+                results.emplace_back(task.get_future());
+                tasks.emplace_back([task = std::move(task)]() mutable
+                                   { task(); });
             }
 
-            m_taskQueueNotEmpty_condVar.notify_one();
-            return true;
+            size_t added = addTasks(tasks.begin(), tasks.end(), priority);
+
+            // 未入队的任务：替换为携带失败原因的future
+            for (size_t i = added; i < results.size(); ++i)
+            {
+                std::promise<ReturnType> promise;
+                promise.set_exception(submitError());
+                results[i] = promise.get_future();
+            }
+
+            return {added, std::move(results)};
+        }
+
+        /**
+         * @brief 批量提交带返回值的任务到线程池（容器版本）
+         * @tparam Container 容器类型（支持std::begin/std::end），元素为无参可调用对象
+         * @param tasks 任务容器，元素会被移动
+         * @param priority 整批任务的优先级（默认普通优先级）
+         * @return pair<成功入队的任务数, 与容器内任务一一对应的std::future对象数组>
+         * @note 与迭代器版本一致
+         */
+        template <typename Container>
+        auto submitBatch(Container& tasks, TaskPriority priority = TaskPriority::kNormal)
+        {
+            return submitBatch(std::begin(tasks), std::end(tasks), priority);
         }
 
         /**
@@ -470,66 +1095,446 @@ namespace ol
          * @note 若任务添加失败（bool为false），调用future.get()会抛出对应异常（线程池停止/队列满）；
          *       若任务添加成功（bool为true），future.get()会返回任务结果或抛出任务自身的异常。
          * @note 线程安全，内部调用addTask实现任务添加
+         * @note std::packaged_task直接移动进ol::Task内联存储，除共享状态外不再额外申请堆内存
          */
         template <typename F, typename... Args>
         auto submitTask(F&& f, Args&&... args) -> std::pair<bool, std::future<typename std::invoke_result_t<F, Args...>>>
+        {
+            return submitTask(TaskPriority::kNormal, std::forward<F>(f), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief 按指定优先级提交带返回值的任务到线程池
+         * @tparam F 任务函数类型
+         * @tparam Args 任务函数参数类型
+         * @param priority 任务优先级
+         * @param f 任务函数
+         * @param args 任务函数参数
+         * @return pair<是否成功添加任务的bool值, 包含任务返回值的std::future对象>
+         * @note 与submitTask(f, args...)一致，仅任务进入priority对应的通道
+         */
+        template <typename F, typename... Args>
+        auto submitTask(TaskPriority priority, F&& f, Args&&... args) -> std::pair<bool, std::future<typename std::invoke_result_t<F, Args...>>>
         {
             using ReturnType = typename std::invoke_result_t<F, Args...>;
 
-            auto task = std::make_shared<std::packaged_task<ReturnType()>>(
+            std::packaged_task<ReturnType()> task(
                 [f = std::forward<F>(f), args = std::make_tuple(std::forward<Args>(args)...)]() mutable
                 {
                     return std::apply(std::move(f), std::move(args));
                 });
 
-            std::future<ReturnType> result = task->get_future();
+            std::future<ReturnType> result = task.get_future();
 
-            if (!addTask([task]() mutable
-                         { (*task)(); }))
+            if (!addTask([task = std::move(task)]() mutable
+                         { task(); },
+                         priority))
             {
                 std::promise<ReturnType> promise;
-                if (m_stop.load(std::memory_order_acquire))
-                {
-                    promise.set_exception(std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] ThreadPool has been stopped")));
-                    return {false, promise.get_future()};
-                }
-
-                switch (m_queueFullPolicy)
-                {
-                case QueueFullPolicy::kReject:
-                    promise.set_exception(std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task queue full (Reject policy)")));
-                    return {false, promise.get_future()};
-                case QueueFullPolicy::kBlock:
-                    // 此时失败一定是因为线程池已停止（否则wait会一直等）
-                    promise.set_exception(std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task submission failed in block policy (ThreadPool stopped)")));
-                    return {false, promise.get_future()};
-                case QueueFullPolicy::kTimeout:
-                    promise.set_exception(std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task queue full (Timeout policy)")));
-                    return {false, promise.get_future()};
-                default:
-                    promise.set_exception(std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task submission failed")));
-                    return {false, promise.get_future()};
-                }
+                promise.set_exception(submitError());
+                return {false, promise.get_future()};
             }
 
             return {true, std::move(result)};
         }
 
         /**
-         * @brief 检查线程池是否处于运行状态
-         * @return 运行中返回true，已停止返回false
-         * @note 基于原子变量m_stop的状态判断，线程安全
+         * @brief 提交带返回值的任务到线程池，返回支持延续的ol::Future
+         * @tparam F 任务函数类型
+         * @tparam Args 任务函数参数类型
+         * @param f 任务函数
+         * @param args 任务函数参数
+         * @return ol::Future对象，其then()延续默认以普通优先级投递回本线程池
+         * @note 提交失败（线程池已停止或队列满被拒绝）时返回的Future直接持有异常，不会丢失
+         * @example pool.submitAsync(load).then([](Data d) { return parse(d); }).then(store);
          */
-        bool isRunning() const { return !m_stop.load(std::memory_order_acquire); }
+        template <typename F, typename... Args>
+        auto submitAsync(F&& f, Args&&... args) -> Future<typename std::invoke_result_t<F, Args...>>
+        {
+            return submitAsync(TaskPriority::kNormal, std::forward<F>(f), std::forward<Args>(args)...);
+        }
 
-    private:
         /**
-         * @brief 工作线程主函数
-         * @note 循环从任务队列获取并执行任务，直到线程池停止或（动态模式下）收到退出指令
-         * @note 动态模式下会维护空闲线程计数，任务执行前后更新状态
+         * @brief 按指定优先级提交带返回值的任务到线程池，返回支持延续的ol::Future
+         * @param priority 任务优先级（同时作为then()延续的默认优先级）
+         * @note 与submitAsync(f, args...)一致
          */
-        void worker()
+        template <typename F, typename... Args>
+        auto submitAsync(TaskPriority priority, F&& f, Args&&... args) -> Future<typename std::invoke_result_t<F, Args...>>
+        {
+            using ReturnType = typename std::invoke_result_t<F, Args...>;
+
+            Promise<ReturnType> promise(executor(priority));
+            Future<ReturnType> result = promise.getFuture();
+
+            Task task([promise = std::move(promise), f = std::forward<F>(f),
+                       args = std::make_tuple(std::forward<Args>(args)...)]() mutable
+                      { std::apply([&](auto&&... a)
+                                   { base::fulfill(promise, f, std::move(a)...); },
+                                   std::move(args)); });
+
+            // 提交失败时task保持不变，先写入具体错误，随后task析构时Promise不会再覆盖为broken_promise
+            if (!tryAddTask(task, priority)) base::FutureAccess::state(result)->setException(submitError());
+
+            return result;
+        }
+
+        /**
+         * @brief 获取把任务投递到本线程池的执行器，可用于Future::then(executor, f)
+         * @param priority 投递任务的优先级（默认普通优先级）
+         * @return 执行器对象（内部仅持有线程池指针，线程池析构后不可再使用）
+         * @note 投递失败时任务被丢弃，其中持有的Promise随之销毁，下游Future得到broken_promise异常
+         */
+        Executor executor(TaskPriority priority = TaskPriority::kNormal)
+        {
+            return [this, priority](Task task)
+            { addTask(std::move(task), priority); };
+        }
+
+        /**
+         * @brief 延迟执行任务
+         * @tparam Rep 时长数值类型
+         * @tparam Period 时长单位
+         * @param delay 延迟时长（<=0时尽快执行）
+         * @param task 待执行的任务
+         * @param priority 到期后投递到线程池的优先级（默认普通优先级）
+         * @return 定时任务句柄，可用于取消；线程池已停止时返回无效句柄
+         * @note 由单个定时线程维护最小堆，到期后通过addTask投递到工作线程执行，不占用工作线程等待
+         * @note 到期投递同样受队列满策略约束（拒绝/超时策略下可能被丢弃）
+         */
+        template <typename Rep, typename Period>
+        TimerHandle scheduleAfter(std::chrono::duration<Rep, Period> delay, Task task, TaskPriority priority = TaskPriority::kNormal)
+        {
+            return addTimer(std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay),
+                            std::chrono::steady_clock::duration::zero(), std::move(task), priority);
+        }
+
+        /**
+         * @brief 周期执行任务
+         * @tparam Rep 时长数值类型
+         * @tparam Period 时长单位
+         * @param period 执行周期（必须大于0），首次在一个周期后执行
+         * @param task 待执行的任务（会被多次调用）
+         * @param priority 每次触发投递到线程池的优先级（默认普通优先级）
+         * @return 定时任务句柄，调用cancel()后停止后续触发；线程池已停止时返回无效句柄
+         * @throw std::invalid_argument 当period <= 0时抛出
+         * @note 按固定频率触发（不因执行耗时累积漂移）；若上一次触发仍在执行，则跳过本次触发，同一任务不会并发执行
+         */
+        template <typename Rep, typename Period>
+        TimerHandle scheduleEvery(std::chrono::duration<Rep, Period> period, Task task, TaskPriority priority = TaskPriority::kNormal)
+        {
+            auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+            if (interval.count() <= 0) throw std::invalid_argument("[ol::ThreadPool] Period must be greater than 0");
+            return addTimer(interval, interval, std::move(task), priority);
+        }
+
+        /**
+         * @brief 获取尚未触发（或周期任务尚未取消）的定时任务数量
+         * @return 定时任务堆中的任务数（已取消但尚未到期的任务也计入）
+         */
+        size_t getTimerNum()
         {
+            std::lock_guard<std::mutex> lock(m_timerMutex);
+            return m_timerHeap.size();
+        }
+
+        /**
+         * @brief 开启或关闭运行指标统计
+         * @param enable true开启，false关闭（默认true）
+         * @note 开启后入队的任务会被包装一层以记录入队时间（任务不再满足内联存储，多一次堆分配），
+         *       执行结束时把排队延迟、执行耗时写入当前工作线程独占的槽位；关闭时无额外开销
+         * @note 拒绝/超时计数始终统计（仅发生在提交失败路径上）
+         */
+        void enableMetrics(bool enable = true)
+        {
+            if (enable)
+            {
+                std::lock_guard<std::mutex> lock(m_metricsMutex);
+                m_metricsSince = std::chrono::steady_clock::now();
+            }
+            m_metricsEnabled.store(enable, std::memory_order_release);
+        }
+
+        /**
+         * @brief 判断是否开启了运行指标统计
+         */
+        bool isMetricsEnabled() const { return m_metricsEnabled.load(std::memory_order_acquire); }
+
+        /**
+         * @brief 获取运行指标快照
+         * @return 汇总所有工作线程槽位后的指标（读取期间仍在执行的任务不计入）
+         * @note 只在读取时加锁遍历槽位，不影响工作线程的任务执行路径
+         */
+        ThreadPoolStats getStats() const
+        {
+            ThreadPoolStats stats;
+            auto now = std::chrono::steady_clock::now();
+            uint64_t totalBusyNs = 0, totalElapsedNs = 0;
+
+            std::lock_guard<std::mutex> lock(m_metricsMutex);
+            stats.completed = m_retiredStats.completed;
+            stats.queueLatency = m_retiredStats.queueLatency;
+            stats.execTime = m_retiredStats.execTime;
+            stats.workers.reserve(m_metricsSlots.size());
+            for (const auto& slot : m_metricsSlots)
+            {
+                slot->queueLatency.snapshot(stats.queueLatency);
+                slot->execTime.snapshot(stats.execTime);
+
+                WorkerStats worker;
+                worker.id = slot->id;
+                worker.completed = slot->completed.load(std::memory_order_relaxed);
+                worker.busyNs = slot->busyNs.load(std::memory_order_relaxed);
+                auto since = std::max(slot->start, m_metricsSince);
+                worker.elapsedNs = now > since ? std::chrono::duration_cast<std::chrono::nanoseconds>(now - since).count() : 0;
+                worker.busyRatio = worker.elapsedNs == 0 ? 0.0 : std::min(1.0, static_cast<double>(worker.busyNs) / worker.elapsedNs);
+                stats.completed += worker.completed;
+                totalBusyNs += worker.busyNs;
+                totalElapsedNs += worker.elapsedNs;
+                stats.workers.push_back(worker);
+            }
+            stats.rejected = m_rejectedNum.load(std::memory_order_relaxed);
+            stats.timedOut = m_timedOutNum.load(std::memory_order_relaxed);
+            stats.busyRatio = totalElapsedNs == 0 ? 0.0 : std::min(1.0, static_cast<double>(totalBusyNs) / totalElapsedNs);
+            return stats;
+        }
+
+        /**
+         * @brief 检查线程池是否处于运行状态
+         * @return 运行中返回true，已停止返回false
+         * @note 基于原子变量m_stop的状态判断，线程安全
+         */
+        bool isRunning() const { return !m_stop.load(std::memory_order_acquire); }
+
+    private:
+        /**
+         * @brief 添加任务的实现
+         * @param task 待执行的任务，仅在添加成功时被移走，失败时保持不变
+         * @param priority 任务优先级
+         * @return 任务添加成功返回true，失败返回false
+         */
+        bool tryAddTask(Task& task, TaskPriority priority)
+        {
+            if (m_stop.load(std::memory_order_acquire)) return false;
+
+            if (m_metricsEnabled.load(std::memory_order_relaxed)) task = prepareTask(std::move(task));
+
+            // 有界无锁模式：普通优先级任务直接压入无锁环形队列
+            if (m_boundedQueue && priority == TaskPriority::kNormal) return pushBounded(task);
+
+            // 工作窃取模式：本线程池的工作线程提交任务时直接压入本地队列
+            if (m_workStealing && priority == TaskPriority::kNormal && t_ownerPool == this &&
+                (m_maxQueueSize == 0 || m_pendingTaskNum.load(std::memory_order_relaxed) < m_maxQueueSize))
+            {
+                pushLocal(std::move(task));
+                return true;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+
+                // 处理队列大小限制
+                if (!waitNotFull(lock)) return false;
+
+                pushTaskLocked(std::move(task), priority);
+            }
+
+            m_taskQueueNotEmpty_condVar.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief 把可调用对象转换为入队的Task，开启指标时包装一层以记录入队时间
+         * @param f 可调用对象（或Task）
+         */
+        template <typename F>
+        Task prepareTask(F&& f)
+        {
+            if (!m_metricsEnabled.load(std::memory_order_relaxed)) return Task(std::forward<F>(f));
+
+            return Task([task = Task(std::forward<F>(f)), enqueued = std::chrono::steady_clock::now()]() mutable
+                        { runInstrumented(task, enqueued); });
+        }
+
+        /**
+         * @brief 执行任务并把排队延迟、执行耗时记录到当前工作线程的指标槽位（任务抛出异常时同样记录）
+         * @param task 待执行的任务
+         * @param enqueued 入队时间
+         */
+        static void runInstrumented(Task& task, std::chrono::steady_clock::time_point enqueued)
+        {
+            struct Recorder
+            {
+                MetricsSlot* slot;
+                std::chrono::steady_clock::time_point enqueued;
+                std::chrono::steady_clock::time_point start;
+                ~Recorder()
+                {
+                    if (!slot) return;
+                    auto end = std::chrono::steady_clock::now();
+                    uint64_t waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>(start - enqueued).count();
+                    uint64_t execNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+                    slot->queueLatency.add(waitNs);
+                    slot->execTime.add(execNs);
+                    AtomicHistogram::bump(slot->completed, 1);
+                    AtomicHistogram::bump(slot->busyNs, execNs);
+                }
+            } recorder{t_metricsSlot, enqueued, std::chrono::steady_clock::now()};
+
+            task();
+        }
+
+        /**
+         * @brief 工作线程启动时登记指标槽位
+         */
+        void attachMetricsSlot()
+        {
+            auto slot = std::make_unique<MetricsSlot>();
+            slot->start = std::chrono::steady_clock::now();
+            t_metricsSlot = slot.get();
+
+            std::lock_guard<std::mutex> lock(m_metricsMutex);
+            slot->id = m_metricsWorkerSeq++;
+            m_metricsSlots.push_back(std::move(slot));
+        }
+
+        /**
+         * @brief 工作线程退出时注销指标槽位，把其计数并入已退出线程的累计指标
+         */
+        void detachMetricsSlot()
+        {
+            MetricsSlot* slot = t_metricsSlot;
+            t_metricsSlot = nullptr;
+            if (!slot) return;
+
+            std::lock_guard<std::mutex> lock(m_metricsMutex);
+            slot->queueLatency.snapshot(m_retiredStats.queueLatency);
+            slot->execTime.snapshot(m_retiredStats.execTime);
+            m_retiredStats.completed += slot->completed.load(std::memory_order_relaxed);
+            m_metricsSlots.erase(std::find_if(m_metricsSlots.begin(), m_metricsSlots.end(),
+                                              [slot](const std::unique_ptr<MetricsSlot>& p)
+                                              { return p.get() == slot; }));
+        }
+
+        /**
+         * @brief 添加定时任务到最小堆，必要时创建定时线程
+         * @param delay 首次触发延迟
+         * @param period 周期（0表示一次性任务）
+         * @param task 待执行的任务
+         * @param priority 触发时投递到线程池的优先级
+         * @return 定时任务句柄，线程池已停止时返回无效句柄
+         */
+        TimerHandle addTimer(std::chrono::steady_clock::duration delay, std::chrono::steady_clock::duration period,
+                             Task&& task, TaskPriority priority)
+        {
+            if (m_stop.load(std::memory_order_acquire)) return TimerHandle();
+
+            auto state = std::make_shared<TimerHandle::State>();
+            state->task = std::move(task);
+            state->period = period;
+            state->priority = priority;
+
+            bool earliest;
+            {
+                std::lock_guard<std::mutex> lock(m_timerMutex);
+                if (m_stop.load(std::memory_order_acquire)) return TimerHandle();
+
+                if (!m_timerThread.joinable()) m_timerThread = std::thread(&ThreadPool<IsDynamic>::timerLoop, this);
+
+                m_timerHeap.push_back({std::chrono::steady_clock::now() + delay, m_timerSeq++, state});
+                std::push_heap(m_timerHeap.begin(), m_timerHeap.end());
+                earliest = m_timerHeap.front().state == state;
+            }
+
+            // 新任务成为最早到期的任务时，唤醒定时线程重新计算等待时间
+            if (earliest) m_timer_condVar.notify_one();
+            return TimerHandle(std::move(state));
+        }
+
+        /**
+         * @brief 定时线程主函数
+         * @note 等待堆顶任务到期后弹出：已取消的直接丢弃；一次性任务把Task移交给线程池；
+         *       周期任务按固定频率计算下一次触发时间后重新入堆，上一次仍在执行时跳过本次投递
+         */
+        void timerLoop()
+        {
+            std::unique_lock<std::mutex> lock(m_timerMutex);
+            while (!m_stop.load(std::memory_order_acquire))
+            {
+                if (m_timerHeap.empty())
+                {
+                    m_timer_condVar.wait(lock, [this]()
+                                         { return !m_timerHeap.empty() || m_stop.load(std::memory_order_acquire); });
+                    continue;
+                }
+
+                auto now = std::chrono::steady_clock::now();
+                if (now < m_timerHeap.front().when)
+                {
+                    m_timer_condVar.wait_until(lock, m_timerHeap.front().when);
+                    continue;
+                }
+
+                std::pop_heap(m_timerHeap.begin(), m_timerHeap.end());
+                TimerEntry entry = std::move(m_timerHeap.back());
+                m_timerHeap.pop_back();
+
+                std::shared_ptr<TimerHandle::State> state = std::move(entry.state);
+                if (state->cancelled.load(std::memory_order_acquire))
+                {
+                    // 已取消的任务可能只剩这一份引用，在锁外析构
+                    lock.unlock();
+                    state.reset();
+                    lock.lock();
+                    continue;
+                }
+
+                Task fire;
+                if (state->period.count() == 0)
+                {
+                    fire = std::move(state->task); // 一次性任务：直接移交
+                }
+                else
+                {
+                    // 周期任务：按固定频率推进，落后超过一个周期时从当前时间重新计时，避免补发积压
+                    entry.when += state->period;
+                    if (entry.when <= now) entry.when = now + state->period;
+                    entry.state = state;
+                    m_timerHeap.push_back(std::move(entry));
+                    std::push_heap(m_timerHeap.begin(), m_timerHeap.end());
+
+                    if (state->running.exchange(true, std::memory_order_acq_rel)) continue; // 上一次仍在执行，跳过
+
+                    fire = [state]()
+                    {
+                        struct RunningGuard
+                        {
+                            TimerHandle::State* s;
+                            ~RunningGuard() { s->running.store(false, std::memory_order_release); }
+                        } guard{state.get()};
+
+                        if (!state->cancelled.load(std::memory_order_acquire)) state->task();
+                    };
+                }
+
+                // 投递时释放定时锁，避免队列满阻塞时影响添加定时任务
+                lock.unlock();
+                bool added = addTask(std::move(fire), state->priority);
+                if (!added && state->period.count() != 0) state->running.store(false, std::memory_order_release);
+                state.reset(); // 在锁外释放引用
+                lock.lock();
+            }
+        }
+
+        /**
+         * @brief 工作线程主函数
+         * @note 循环从任务队列获取并执行任务，直到线程池停止或（动态模式下）收到退出指令
+         * @note 动态模式下会维护空闲线程计数，任务执行前后更新状态
+         */
+        void worker()
+        {
+            attachMetricsSlot();
+
             // 动态模式：初始化线程状态
             if constexpr (IsDynamic)
             {
@@ -540,8 +1545,52 @@ namespace ol
             {
                 while (!m_stop.load(std::memory_order_acquire))
                 {
-                    std::function<void()> task;
+                    Task task;
+
+                    if (m_boundedQueue)
+                    {
+                        // 有界无锁模式：无锁取任务，取不到时才加锁休眠
+                        if (!popBounded(task))
+                        {
+                            std::unique_lock<std::mutex> lock(m_taskQueueMutex);
 
+                            // 与publishBounded配对：先登记休眠再检查任务计数（均为seq_cst），避免丢失唤醒
+                            m_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+                            m_taskQueueNotEmpty_condVar.wait(lock, [this]()
+                                                             {
+                                                                 if constexpr (IsDynamic)
+                                                                     return m_pendingTaskNum.load(std::memory_order_seq_cst) > 0 || m_stop.load(std::memory_order_acquire) || m_dynamic.workerExitNum.load(std::memory_order_acquire) > 0;
+                                                                 else
+                                                                     return m_pendingTaskNum.load(std::memory_order_seq_cst) > 0 || m_stop.load(std::memory_order_acquire); });
+                            m_sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+
+                            if (m_stop.load(std::memory_order_acquire)) break;
+
+                            if constexpr (IsDynamic)
+                            {
+                                if (m_dynamic.workerExitNum.load(std::memory_order_acquire) > 0)
+                                {
+                                    m_dynamic.workerExitNum.fetch_sub(1, std::memory_order_acq_rel);
+                                    break;
+                                }
+                            }
+                            continue;
+                        }
+
+                        // 任务出队，通知可能阻塞等待的生产者
+                        m_pendingTaskNum.fetch_sub(1, std::memory_order_seq_cst);
+                        if (m_blockedProducers.load(std::memory_order_seq_cst) > 0)
+                        {
+                            {
+                                std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+                            }
+                            m_taskQueueNotFull_condVar.notify_one();
+                        }
+
+                        // 动态模式：空闲线程数-1
+                        if constexpr (IsDynamic) m_dynamic.idleThreads.fetch_sub(1, std::memory_order_acq_rel);
+                    }
+                    else
                     {
                         std::unique_lock<std::mutex> lock(m_taskQueueMutex);
 
@@ -549,9 +1598,9 @@ namespace ol
                         auto waitCond = [this]()
                         {
                             if constexpr (IsDynamic)
-                                return !m_taskQueue.empty() || m_stop.load(std::memory_order_acquire) || m_dynamic.workerExitNum.load(std::memory_order_acquire) > 0;
+                                return queuedTaskNum() > 0 || m_stop.load(std::memory_order_acquire) || m_dynamic.workerExitNum.load(std::memory_order_acquire) > 0;
                             else
-                                return !m_taskQueue.empty() || m_stop.load(std::memory_order_acquire);
+                                return queuedTaskNum() > 0 || m_stop.load(std::memory_order_acquire);
                         };
                         m_taskQueueNotEmpty_condVar.wait(lock, waitCond);
 
@@ -566,11 +1615,8 @@ namespace ol
                             }
                         }
 
-                        if (m_taskQueue.empty()) continue;
-
                         // 取出任务
-                        task = std::move(m_taskQueue.front());
-                        m_taskQueue.pop();
+                        if (!popTaskLocked(task)) continue;
 
                         // 通知可能等待的生产者
                         if (m_queueFullPolicy != QueueFullPolicy::kReject) m_taskQueueNotFull_condVar.notify_one();
@@ -580,35 +1626,27 @@ namespace ol
                     }
 
                     // 执行任务
-                    try
-                    {
-                        if (task) task(); // 空任务保护
-                    }
-                    catch (const std::exception& e)
-                    {
-                        fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) Task error: %s\n", std::this_thread::get_id(), e.what());
-                    }
-                    catch (...)
-                    {
-                        fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) Unknown task error\n", std::this_thread::get_id());
-                    }
+                    runTask(task);
 
                     // 动态模式：任务完成，恢复空闲状态
                     if constexpr (IsDynamic)
                     {
+                        m_dynamic.completedNum.fetch_add(1, std::memory_order_relaxed);
                         m_dynamic.idleThreads.fetch_add(1, std::memory_order_release);
                     }
                 }
             }
             catch (const std::exception& e)
             {
-                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) exception: %s\n", std::this_thread::get_id(), e.what());
+                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) exception: %s\n", std::hash<std::thread::id>{}(std::this_thread::get_id()), e.what());
             }
             catch (...)
             {
-                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) unexpected exception\n", std::this_thread::get_id());
+                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) unexpected exception\n", std::hash<std::thread::id>{}(std::this_thread::get_id()));
             }
 
+            detachMetricsSlot();
+
             // 活跃线程数-1
             m_activeWorkers.fetch_sub(1, std::memory_order_acq_rel);
 
@@ -638,13 +1676,444 @@ namespace ol
 #endif
         }
 
+        /**
+         * @brief 执行单个任务，捕获并输出任务抛出的异常
+         * @param task 待执行的任务
+         */
+        static void runTask(Task& task)
+        {
+            try
+            {
+                if (task) task(); // 空任务保护
+            }
+            catch (const std::exception& e)
+            {
+                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) Task error: %s\n", std::hash<std::thread::id>{}(std::this_thread::get_id()), e.what());
+            }
+            catch (...)
+            {
+                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) Unknown task error\n", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            }
+        }
+
+        /**
+         * @brief 等待任务队列出现空位（调用方需持有m_taskQueueMutex）
+         * @param lock 已持有的队列锁，阻塞/超时策略下等待期间会被释放
+         * @return 可以入队返回true；线程池已停止或按队列策略放弃（拒绝/超时）返回false
+         */
+        bool waitNotFull(std::unique_lock<std::mutex>& lock)
+        {
+            if (m_maxQueueSize > 0)
+            {
+                auto notFull = [this]()
+                { return queuedTaskNum() < m_maxQueueSize || m_stop.load(std::memory_order_acquire); };
+
+                while (queuedTaskNum() >= m_maxQueueSize && !m_stop.load(std::memory_order_acquire))
+                {
+                    switch (m_queueFullPolicy)
+                    {
+                    case QueueFullPolicy::kReject:
+                        m_rejectedNum.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    case QueueFullPolicy::kBlock:
+                        m_blockedProducers.fetch_add(1, std::memory_order_seq_cst);
+                        m_taskQueueNotFull_condVar.wait(lock, notFull);
+                        m_blockedProducers.fetch_sub(1, std::memory_order_relaxed);
+                        break;
+                    case QueueFullPolicy::kTimeout:
+                        m_blockedProducers.fetch_add(1, std::memory_order_seq_cst);
+                        bool result = m_taskQueueNotFull_condVar.wait_for(lock, m_timeoutMS, notFull);
+                        m_blockedProducers.fetch_sub(1, std::memory_order_relaxed);
+                        if (!result)
+                        {
+                            m_timedOutNum.fetch_add(1, std::memory_order_relaxed);
+                            return false;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            return !m_stop.load(std::memory_order_acquire);
+        }
+
+        /**
+         * @brief 按新入队任务数唤醒工作线程
+         * @param taskNum 新入队的任务数
+         * @note 任务数不小于活跃线程数时notify_all，否则逐个notify_one，避免惊群
+         */
+        void wakeWorkers(size_t taskNum)
+        {
+            if (taskNum == 0) return;
+
+            if (taskNum >= m_activeWorkers.load(std::memory_order_acquire))
+            {
+                m_taskQueueNotEmpty_condVar.notify_all();
+                return;
+            }
+
+            while (taskNum-- > 0) m_taskQueueNotEmpty_condVar.notify_one();
+        }
+
+        /**
+         * @brief 生成任务提交失败的异常（根据线程池状态和当前队列策略）
+         * @return 描述失败原因的异常指针
+         */
+        std::exception_ptr submitError() const
+        {
+            if (m_stop.load(std::memory_order_acquire))
+                return std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] ThreadPool has been stopped"));
+
+            switch (m_queueFullPolicy)
+            {
+            case QueueFullPolicy::kReject:
+                return std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task queue full (Reject policy)"));
+            case QueueFullPolicy::kBlock:
+                // 此时失败一定是因为线程池已停止（否则wait会一直等）
+                return std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task submission failed in block policy (ThreadPool stopped)"));
+            case QueueFullPolicy::kTimeout:
+                return std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task queue full (Timeout policy)"));
+            default:
+                return std::make_exception_ptr(std::runtime_error("[ol::ThreadPool] Task submission failed"));
+            }
+        }
+
+        /**
+         * @brief 获取当前排队中的任务数（调用方需持有m_taskQueueMutex）
+         * @return 普通模式为共享队列长度，工作窃取/有界无锁模式为所有队列的任务总数
+         */
+        inline size_t queuedTaskNum() const
+        {
+            if (m_workStealing || m_boundedQueue) return m_pendingTaskNum.load(std::memory_order_seq_cst);
+            return m_taskQueue.size() + m_priorityTaskNum.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief 把任务压入priority对应的共享通道（调用方需持有m_taskQueueMutex）
+         * @param task 待执行的任务
+         * @param priority 任务优先级
+         */
+        void pushTaskLocked(Task&& task, TaskPriority priority)
+        {
+            switch (priority)
+            {
+            case TaskPriority::kHigh:
+                m_highTaskQueue.push(std::move(task));
+                m_priorityTaskNum.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case TaskPriority::kLow:
+                m_lowTaskQueue.push(std::move(task));
+                m_priorityTaskNum.fetch_add(1, std::memory_order_relaxed);
+                break;
+            default:
+                m_taskQueue.push(std::move(task));
+                break;
+            }
+            if (m_workStealing || m_boundedQueue) m_pendingTaskNum.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        /**
+         * @brief 从共享通道中按优先级取出一个任务（调用方需持有m_taskQueueMutex）
+         * @param task 取出的任务
+         * @return 成功取出返回true，所有通道均为空返回false
+         * @note 没有高/低优先级任务时直接取普通FIFO队列（有界无锁模式下为无锁环形队列）；否则按以下规则选择通道：
+         *       1. 低优先级任务已被跳过kLowAgingLimit轮（或其他通道为空）时执行一个低优先级任务
+         *       2. 高优先级任务优先，但在普通任务等待时最多连续执行kHighBurstLimit个
+         *       3. 其余情况执行普通优先级任务
+         */
+        bool popTaskLocked(Task& task)
+        {
+            std::queue<Task>* lane = &m_taskQueue;
+
+            if (m_priorityTaskNum.load(std::memory_order_relaxed) > 0)
+            {
+                const bool hasHigh = !m_highTaskQueue.empty();
+                const bool hasNormal = m_boundedQueue ? !m_boundedQueue->empty() : !m_taskQueue.empty();
+                const bool hasLow = !m_lowTaskQueue.empty();
+
+                if (hasLow && (m_lowSkipped >= kLowAgingLimit || (!hasHigh && !hasNormal)))
+                {
+                    lane = &m_lowTaskQueue;
+                    m_lowSkipped = 0;
+                }
+                else
+                {
+                    if (hasLow) ++m_lowSkipped;
+
+                    if (hasHigh && (m_highStreak < kHighBurstLimit || !hasNormal))
+                    {
+                        lane = &m_highTaskQueue;
+                        if (hasNormal) ++m_highStreak;
+                    }
+                    else
+                    {
+                        m_highStreak = 0;
+                    }
+                }
+
+                if (lane != &m_taskQueue) m_priorityTaskNum.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            // 有界无锁模式：普通优先级通道为无锁环形队列
+            if (lane == &m_taskQueue && m_boundedQueue) return m_boundedQueue->tryPop(task);
+
+            if (lane->empty()) return false;
+
+            task = std::move(lane->front());
+            lane->pop();
+            return true;
+        }
+
+        /**
+         * @brief 有界无锁模式：把普通优先级任务压入无锁环形队列
+         * @param task 待执行的任务，仅在入队成功时被移走
+         * @return 入队成功返回true；队列满且按策略放弃（拒绝/超时）或线程池停止时返回false
+         */
+        bool pushBounded(Task& task)
+        {
+            if (m_boundedQueue->tryPush(std::move(task)))
+            {
+                publishBounded(1);
+                return true;
+            }
+
+            if (m_queueFullPolicy == QueueFullPolicy::kReject)
+            {
+                m_rejectedNum.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            return pushBoundedSlow(task);
+        }
+
+        /**
+         * @brief 有界无锁模式：队列满时按阻塞/超时策略等待空位后入队
+         * @param task 待执行的任务，仅在入队成功时被移走
+         * @return 入队成功返回true，超时或线程池停止返回false
+         * @note 登记阻塞后再读取一次任务计数（seq_cst），与消费者"先减计数再检查阻塞数"配对，
+         *       保证要么消费者看到登记并唤醒，要么本线程看到消费者腾出的空位
+         */
+        bool pushBoundedSlow(Task& task)
+        {
+            auto deadline = std::chrono::steady_clock::now() + m_timeoutMS;
+            bool pushed = false;
+            {
+                std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+                m_blockedProducers.fetch_add(1, std::memory_order_seq_cst);
+                while (!m_stop.load(std::memory_order_acquire))
+                {
+                    m_pendingTaskNum.load(std::memory_order_seq_cst);
+                    if (m_boundedQueue->tryPush(std::move(task)))
+                    {
+                        pushed = true;
+                        break;
+                    }
+
+                    if (m_queueFullPolicy == QueueFullPolicy::kBlock)
+                        m_taskQueueNotFull_condVar.wait(lock);
+                    else if (m_taskQueueNotFull_condVar.wait_until(lock, deadline) == std::cv_status::timeout)
+                    {
+                        pushed = !m_stop.load(std::memory_order_acquire) && m_boundedQueue->tryPush(std::move(task));
+                        if (!pushed && !m_stop.load(std::memory_order_acquire)) m_timedOutNum.fetch_add(1, std::memory_order_relaxed);
+                        break;
+                    }
+                }
+                m_blockedProducers.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            if (pushed) publishBounded(1);
+            return pushed;
+        }
+
+        /**
+         * @brief 有界无锁模式：发布新入队的任务数，必要时唤醒休眠的工作线程
+         * @param taskNum 新入队的任务数
+         * @note 先增加任务计数再检查休眠线程数，与工作线程休眠前的检查配对（均为seq_cst），避免丢失唤醒
+         */
+        void publishBounded(size_t taskNum)
+        {
+            if (taskNum == 0) return;
+
+            m_pendingTaskNum.fetch_add(taskNum, std::memory_order_seq_cst);
+            if (m_sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+                }
+                wakeWorkers(taskNum);
+            }
+        }
+
+        /**
+         * @brief 有界无锁模式：取出一个任务
+         * @param task 取出的任务
+         * @return 成功取出返回true，所有通道均为空返回false
+         * @note 存在高/低优先级任务时加锁按通道规则选择，否则直接从无锁环形队列取任务
+         */
+        bool popBounded(Task& task)
+        {
+            if (m_priorityTaskNum.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+                if (popTaskLocked(task)) return true;
+            }
+            return m_boundedQueue->tryPop(task);
+        }
+
+        /**
+         * @brief 工作窃取模式：把任务压入当前工作线程的本地队列尾部，必要时唤醒休眠的工作线程
+         * @param task 待执行的任务
+         */
+        void pushLocal(Task&& task)
+        {
+            WorkerQueue& queue = m_workerQueues[t_workerIndex];
+            {
+                std::lock_guard<spin_mutex> lock(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+
+            // 先增加任务计数再检查休眠线程数，与休眠前的检查配对（均为seq_cst），避免丢失唤醒
+            m_pendingTaskNum.fetch_add(1, std::memory_order_seq_cst);
+            if (m_sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+                }
+                m_taskQueueNotEmpty_condVar.notify_one();
+            }
+        }
+
+        /**
+         * @brief 工作窃取模式：从本地队列尾部取出任务（LIFO，缓存更热）
+         * @param index 本地队列序号
+         * @param task 取出的任务
+         * @return 成功取出返回true，本地队列为空返回false
+         */
+        bool popLocal(size_t index, Task& task)
+        {
+            WorkerQueue& queue = m_workerQueues[index];
+            std::lock_guard<spin_mutex> lock(queue.mutex);
+            if (queue.tasks.empty()) return false;
+
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        /**
+         * @brief 工作窃取模式：从共享注入队列头部取出外部提交的任务
+         * @param task 取出的任务
+         * @return 成功取出返回true，注入队列为空返回false
+         */
+        bool popInjected(Task& task)
+        {
+            std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+            return popTaskLocked(task);
+        }
+
+        /**
+         * @brief 工作窃取模式：从其他工作线程的本地队列头部窃取任务（FIFO，窃取较早入队的任务）
+         * @param index 窃取者的本地队列序号
+         * @param task 窃取到的任务
+         * @return 成功窃取返回true，其他队列均为空返回false
+         */
+        bool stealTask(size_t index, Task& task)
+        {
+            // 节点本地队列模式：第一轮只窃取同节点的工作线程，第二轮再跨节点
+            for (int pass = m_workerNodes.empty() ? 1 : 0; pass < 2; ++pass)
+            {
+                for (size_t i = 1; i < m_workerQueueNum; ++i)
+                {
+                    size_t victimIndex = (index + i) % m_workerQueueNum;
+                    if (pass == 0 && m_workerNodes[victimIndex] != m_workerNodes[index]) continue;
+
+                    WorkerQueue& victim = m_workerQueues[victimIndex];
+                    std::unique_lock<spin_mutex> lock(victim.mutex, std::try_to_lock);
+                    if (!lock.owns_lock() || victim.tasks.empty()) continue; // 队列正被操作时跳过，避免在热点上自旋
+
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief 工作窃取模式的工作线程主函数
+         * @param index 本线程的本地队列序号
+         * @note 取任务顺序：本地队列尾部 -> 共享注入队列 -> 窃取其他线程本地队列头部，均为空时休眠；
+         *       共享通道中存在高/低优先级任务时先检查共享注入队列，保证高优先级任务不被本地任务延后
+         */
+        void stealingWorker(size_t index)
+        {
+            t_ownerPool = this;
+            t_workerIndex = index;
+            attachMetricsSlot();
+
+            try
+            {
+                while (!m_stop.load(std::memory_order_acquire))
+                {
+                    Task task;
+
+                    bool found = false;
+                    if (m_pendingTaskNum.load(std::memory_order_acquire) > 0)
+                    {
+                        if (m_priorityTaskNum.load(std::memory_order_relaxed) > 0)
+                            found = popInjected(task) || popLocal(index, task) || stealTask(index, task);
+                        else
+                            found = popLocal(index, task) || popInjected(task) || stealTask(index, task);
+                    }
+
+                    if (!found)
+                    {
+                        // 所有队列均为空：休眠等待（与pushLocal配对，先登记休眠再检查任务计数）
+                        std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+                        m_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+                        m_taskQueueNotEmpty_condVar.wait(lock, [this]()
+                                                         { return m_pendingTaskNum.load(std::memory_order_seq_cst) > 0 || m_stop.load(std::memory_order_acquire); });
+                        m_sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    // 任务出队，通知可能阻塞等待的生产者
+                    m_pendingTaskNum.fetch_sub(1, std::memory_order_seq_cst);
+                    if (m_blockedProducers.load(std::memory_order_seq_cst) > 0)
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(m_taskQueueMutex);
+                        }
+                        m_taskQueueNotFull_condVar.notify_one();
+                    }
+
+                    // 执行任务
+                    runTask(task);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) exception: %s\n", std::hash<std::thread::id>{}(std::this_thread::get_id()), e.what());
+            }
+            catch (...)
+            {
+                fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) unexpected exception\n", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            }
+
+            t_ownerPool = nullptr;
+
+            detachMetricsSlot();
+
+            // 活跃线程数-1
+            m_activeWorkers.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
         /**
          * @brief 管理者线程主函数（仅动态模式可用）
-         * @note 定期执行以下操作：
+         * @note 每个采样周期（sampleInterval）执行以下操作：
          *       1. 清理已退出的工作线程对象
-         *       2. 根据任务负载和空闲线程数进行扩缩容：
-         *          - 扩容：任务数 > 线程数*2 且未达最大线程数时创建新线程
-         *          - 缩容：空闲线程 > 线程总数的1/2 且超过最小线程数时销毁多余线程
+         *       2. 采样排队数、空闲线程数和本周期完成数，交给扩缩容策略决定目标线程数：
+         *          - 扩容：目标限制在maxThreads内，单次最多翻倍，不受冷却时间限制
+         *          - 缩容：目标不低于minThreads，只回收空闲线程，且距上一次扩缩容至少checkInterval
          */
         template <bool D = IsDynamic, typename = std::enable_if_t<D>>
         void manager()
@@ -656,11 +2125,14 @@ namespace ol
             try
             {
                 std::deque<std::thread::id> exitIds;
+                auto lastSample = std::chrono::steady_clock::now();
+                auto lastScale = lastSample;
+                size_t lastCompleted = m_dynamic.completedNum.load(std::memory_order_relaxed);
                 while (!m_stop.load(std::memory_order_acquire))
                 {
-                    // 定期检查（可被stop()唤醒）
+                    // 定期采样（可被stop()唤醒）
                     std::unique_lock<std::mutex> lock_manger(m_dynamic.managerMutex);
-                    m_dynamic.managerExit_condVar.wait_for(lock_manger, m_dynamic.checkInterval, [this]()
+                    m_dynamic.managerExit_condVar.wait_for(lock_manger, m_dynamic.sampleInterval, [this]()
                                                            { return m_stop.load(std::memory_order_acquire); });
                     if (m_stop.load(std::memory_order_acquire)) return;
 
@@ -701,11 +2173,11 @@ namespace ol
                                 }
                                 catch (const std::exception& e)
                                 {
-                                    fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) join failure: %s\n", exitId, e.what());
+                                    fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) join failure: %s\n", std::hash<std::thread::id>{}(exitId), e.what());
                                 }
                                 catch (...)
                                 {
-                                    fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) Unknown join error\n", exitId);
+                                    fprintf(stderr, "[ol::ThreadPool] Worker thread(ID:%zu) Unknown join error\n", std::hash<std::thread::id>{}(exitId));
                                 }
                             }
 
@@ -713,79 +2185,82 @@ namespace ol
                         }
                     }
 
-                    // 2. 扩缩容
+                    // 2. 采样并扩缩容
+                    auto now = std::chrono::steady_clock::now();
+                    size_t completed = m_dynamic.completedNum.load(std::memory_order_relaxed);
+                    ScalingSample sample;
+                    sample.interval = std::chrono::duration_cast<std::chrono::nanoseconds>(now - lastSample);
+                    // 已通知退出但尚未退出的线程不计入有效线程数
+                    size_t exiting = m_dynamic.workerExitNum.load(std::memory_order_acquire);
+                    size_t active = m_activeWorkers.load(std::memory_order_acquire);
+                    sample.workerNum = active > exiting ? active - exiting : 0;
+                    sample.idleNum = m_dynamic.idleThreads.load(std::memory_order_acquire);
+                    sample.idleNum = sample.idleNum > exiting ? sample.idleNum - exiting : 0;
                     {
                         std::lock_guard<std::mutex> lock_taskQueue(m_taskQueueMutex);
-                        std::lock_guard<std::mutex> lock_workers(m_workersMutex);
-                        size_t taskCount = m_taskQueue.size();
-                        size_t workerCount = m_workers.size();
-                        size_t idleCount = m_dynamic.idleThreads.load(std::memory_order_acquire);
+                        sample.queuedNum = queuedTaskNum();
+                    }
+                    sample.completedNum = completed - lastCompleted;
+                    sample.minThreads = m_dynamic.minThreads;
+                    sample.maxThreads = m_dynamic.maxThreads;
+                    lastSample = now;
+                    lastCompleted = completed;
 
-                        // 扩容判断：任务数 > 线程数 * 2 且未达最大线程数
-                        if (taskCount > workerCount * 2 && workerCount < m_dynamic.maxThreads)
+                    size_t workerCount = sample.workerNum;
+                    size_t target = m_dynamic.scalingPolicy->decide(sample);
+                    target = std::min(std::max(target, m_dynamic.minThreads), m_dynamic.maxThreads);
+
+                    if (target > workerCount)
+                    {
+                        // 每次最多扩容到当前的2倍，避免一次性创建过多线程
+                        size_t needThreads = std::min(target - workerCount, std::max(workerCount, static_cast<size_t>(1)));
+
+                        std::lock_guard<std::mutex> lock_workers(m_workersMutex);
+                        m_workers.reserve(m_workers.size() + needThreads);
+                        while (needThreads > 0)
                         {
-                            size_t needThreads = std::min(
-                                m_dynamic.maxThreads - workerCount,
-                                (taskCount + workerCount - 1) / workerCount // 按当前负载估算需要的线程数（向上取整）
-                            );
-                            // 每次最多扩容到当前的1.5倍，避免一次性创建过多线程
-                            needThreads = std::min(needThreads, workerCount / 2 + 1);
-
-                            m_workers.reserve(workerCount + needThreads);
-                            while (needThreads > 0)
-                            {
-                                m_activeWorkers.fetch_add(1, std::memory_order_acq_rel);
-                                std::thread th(&ThreadPool<IsDynamic>::worker, this);
+                            m_activeWorkers.fetch_add(1, std::memory_order_acq_rel);
+                            std::thread th(&ThreadPool<IsDynamic>::worker, this);
 #ifdef DEBUG
-                                printf("[manager] 新工作线程(ID:%zu)\n", th.get_id());
-#endif
-                                m_workers.emplace(th.get_id(), std::move(th)); // 哈希表插入新工作线程
-                                --needThreads;
-                            }
-#ifdef DEBUG
-                            printf("[manager] 扩容：线程数从 %zu 增加到 %zu（任务数: %zu）\n",
-                                   workerCount, m_workers.size(), taskCount);
+                            printf("[manager] 新工作线程(ID:%zu)\n", th.get_id());
 #endif
+                            m_workers.emplace(th.get_id(), std::move(th)); // 哈希表插入新工作线程
+                            --needThreads;
                         }
-                        // 缩容判断：空闲线程 > 线程总数的1/2 且 线程数 > 最小线程数
-                        else if (idleCount > workerCount / 2 && workerCount > m_dynamic.minThreads)
-                        {
-
-                            // 实际缩减数 = 取 可缩减线程数 和 多余空闲线程数 的较小值
-                            size_t reduceThreads = std::min(
-                                workerCount - m_dynamic.minThreads, // 可缩减线程数 = 当前线程数 - 最低保留数
-                                idleCount - (workerCount / 2)       // 多余空闲线程数 = 超过一半的空闲线程
-                            );
-
+                        lastScale = now;
 #ifdef DEBUG
-                            size_t reduceThreads_temp = reduceThreads;
+                        printf("[manager] 扩容：线程数从 %zu 增加到 %zu（排队任务数: %zu）\n",
+                               workerCount, m_workers.size(), sample.queuedNum);
 #endif
-
-                            // 销毁线程
-                            if (reduceThreads > 0)
+                    }
+                    else if (target < workerCount && now - lastScale >= m_dynamic.checkInterval)
+                    {
+                        // 只回收空闲线程，忙碌线程完成当前任务前不受影响
+                        size_t reduceThreads = std::min(workerCount - target, sample.idleNum);
+                        if (reduceThreads > 0)
+                        {
                             {
+                                // 持锁修改退出计数，避免与工作线程的等待条件检查交错而丢失唤醒
+                                std::lock_guard<std::mutex> lock_taskQueue(m_taskQueueMutex);
                                 m_dynamic.workerExitNum.fetch_add(reduceThreads, std::memory_order_acq_rel);
-                                do
-                                {
-                                    m_taskQueueNotEmpty_condVar.notify_one();
-                                    --reduceThreads;
-                                } while (reduceThreads > 0);
                             }
+                            for (size_t i = 0; i < reduceThreads; ++i) m_taskQueueNotEmpty_condVar.notify_one();
+                            lastScale = now;
+                        }
 #ifdef DEBUG
-                            printf("[manager] 缩容：计划销毁 %zu 个线程（当前线程数: %zu, 空闲数: %zu, 保留至少: %zu）\n",
-                                   reduceThreads_temp, workerCount, idleCount, m_dynamic.minThreads);
+                        printf("[manager] 缩容：计划销毁 %zu 个线程（当前线程数: %zu, 空闲数: %zu, 保留至少: %zu）\n",
+                               reduceThreads, workerCount, sample.idleNum, m_dynamic.minThreads);
 #endif
-                        }
                     }
                 }
             }
             catch (const std::exception& e)
             {
-                fprintf(stderr, "[ol::ThreadPool] Manager thread(ID:%zu) exception: %s\n", std::this_thread::get_id(), e.what());
+                fprintf(stderr, "[ol::ThreadPool] Manager thread(ID:%zu) exception: %s\n", std::hash<std::thread::id>{}(std::this_thread::get_id()), e.what());
             }
             catch (...)
             {
-                fprintf(stderr, "[ol::ThreadPool] Manager thread(ID:%zu) unexpected exception\n", std::this_thread::get_id());
+                fprintf(stderr, "[ol::ThreadPool] Manager thread(ID:%zu) unexpected exception\n", std::hash<std::thread::id>{}(std::this_thread::get_id()));
             }
 
             // 清空退出队列
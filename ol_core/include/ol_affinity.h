@@ -0,0 +1,313 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_affinity.h
+ * 功能描述：CPU亲和性与NUMA拓扑工具，用于把线程固定到指定CPU或NUMA节点，特性包括：
+ *          - 解析Linux cpulist格式（如"0-3,8,10-11"）
+ *          - 从/sys/devices/system/node读取NUMA节点及其CPU列表，读取失败时退化为单节点
+ *          - 设置线程（std::thread或当前线程）的CPU亲和性
+ *          - WorkerPlacement：线程池工作线程的放置策略（逐核固定、限定CPU集合、按NUMA节点分组）
+ *          - 仅Linux平台真正生效，其他平台设置亲和性的接口返回false
+ * 作者：ol
+ * 适用标准：C++17及以上
+ */
+/****************************************************************************************/
+
+#ifndef OL_AFFINITY_H
+#define OL_AFFINITY_H 1
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#endif // __linux__
+
+namespace ol
+{
+    /**
+     * @brief NUMA节点描述
+     */
+    struct NumaNode
+    {
+        int id;                ///< 节点编号
+        std::vector<int> cpus; ///< 节点内的CPU编号（升序）
+    };
+
+#ifdef __linux__
+    constexpr long kMaxCpuNum = CPU_SETSIZE; ///< 可表示的CPU编号上限（cpu_set_t的容量），编号必须小于该值
+#else
+    constexpr long kMaxCpuNum = 1024; ///< 可表示的CPU编号上限，编号必须小于该值
+#endif // __linux__
+
+    /**
+     * @brief 解析Linux cpulist格式的CPU列表
+     * @param cpuList CPU列表字符串，如"0-3,8,10-11"（允许末尾换行）
+     * @return 升序去重的CPU编号数组，格式错误的片段以及编号不小于kMaxCpuNum的片段被忽略
+     * @note 编号上限保证畸形输入（如"0-2000000000"）不会展开出大量元素
+     */
+    inline std::vector<int> parseCpuList(const std::string& cpuList)
+    {
+        std::vector<int> cpus;
+        size_t pos = 0;
+        while (pos < cpuList.size())
+        {
+            size_t end = cpuList.find(',', pos);
+            if (end == std::string::npos) end = cpuList.size();
+            std::string item = cpuList.substr(pos, end - pos);
+            pos = end + 1;
+
+            char* next = nullptr;
+            long first = std::strtol(item.c_str(), &next, 10);
+            if (next == item.c_str() || first < 0 || first >= kMaxCpuNum) continue;
+            long last = first;
+            if (*next == '-')
+            {
+                const char* rangeEnd = next + 1;
+                last = std::strtol(rangeEnd, &next, 10);
+                if (next == rangeEnd || last < first || last >= kMaxCpuNum) continue;
+            }
+            for (long cpu = first; cpu <= last; ++cpu) cpus.push_back(static_cast<int>(cpu));
+        }
+
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    /**
+     * @brief 获取在线的CPU编号
+     * @return 读取/sys/devices/system/cpu/online，失败时返回0 ~ hardware_concurrency-1
+     */
+    inline std::vector<int> getOnlineCpus()
+    {
+        std::ifstream file("/sys/devices/system/cpu/online");
+        std::string line;
+        if (file && std::getline(file, line))
+        {
+            std::vector<int> cpus = parseCpuList(line);
+            if (!cpus.empty()) return cpus;
+        }
+
+        std::vector<int> cpus(std::max(1u, std::thread::hardware_concurrency()));
+        for (size_t i = 0; i < cpus.size(); ++i) cpus[i] = static_cast<int>(i);
+        return cpus;
+    }
+
+    /**
+     * @brief 获取NUMA拓扑
+     * @return 按节点编号升序的节点数组（只包含有CPU的节点）；无NUMA信息时返回包含全部在线CPU的单个节点0
+     */
+    inline std::vector<NumaNode> getNumaNodes()
+    {
+        std::vector<NumaNode> nodes;
+
+#ifdef __linux__
+        const std::string nodeRoot = "/sys/devices/system/node/";
+        if (DIR* dir = opendir(nodeRoot.c_str()))
+        {
+            while (dirent* entry = readdir(dir))
+            {
+                std::string name = entry->d_name;
+                if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+                    name.find_first_not_of("0123456789", 4) != std::string::npos)
+                    continue;
+
+                std::ifstream file(nodeRoot + name + "/cpulist");
+                std::string line;
+                if (!file || !std::getline(file, line)) continue;
+
+                NumaNode node{std::atoi(name.c_str() + 4), parseCpuList(line)};
+                if (!node.cpus.empty()) nodes.push_back(std::move(node));
+            }
+            closedir(dir);
+        }
+#endif // __linux__
+
+        if (nodes.empty()) nodes.push_back(NumaNode{0, getOnlineCpus()});
+
+        std::sort(nodes.begin(), nodes.end(), [](const NumaNode& a, const NumaNode& b)
+                  { return a.id < b.id; });
+        return nodes;
+    }
+
+    /**
+     * @brief 设置线程的CPU亲和性
+     * @param thread 目标线程（必须处于joinable状态）
+     * @param cpus 允许运行的CPU编号集合（为空时不做任何修改）
+     * @return 设置成功返回true；cpus为空、线程不可用、CPU编号非法或非Linux平台返回false
+     */
+    inline bool setThreadAffinity(std::thread& thread, const std::vector<int>& cpus)
+    {
+#ifdef __linux__
+        if (cpus.empty() || !thread.joinable()) return false;
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus)
+        {
+            if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+            CPU_SET(cpu, &set);
+        }
+        return pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set) == 0;
+#else
+        (void)thread;
+        (void)cpus;
+        return false;
+#endif // __linux__
+    }
+
+    /**
+     * @brief 设置当前线程的CPU亲和性
+     * @param cpus 允许运行的CPU编号集合（为空时不做任何修改）
+     * @return 设置成功返回true，失败返回false
+     */
+    inline bool setCurrentThreadAffinity(const std::vector<int>& cpus)
+    {
+#ifdef __linux__
+        if (cpus.empty()) return false;
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus)
+        {
+            if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+            CPU_SET(cpu, &set);
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        (void)cpus;
+        return false;
+#endif // __linux__
+    }
+
+    /**
+     * @brief 获取当前线程正在运行的CPU编号
+     * @return CPU编号，无法获取时返回-1
+     */
+    inline int getCurrentCpu()
+    {
+#ifdef __linux__
+        return sched_getcpu();
+#else
+        return -1;
+#endif // __linux__
+    }
+
+    /**
+     * @brief 线程池工作线程的放置策略
+     * @note 默认不做任何绑定；通过静态工厂函数创建具体策略
+     * @example ol::ThreadPool<false> pool(8, 0, true, ol::WorkerPlacement::numa(true));
+     */
+    class WorkerPlacement
+    {
+    public:
+        enum class Mode : char
+        {
+            kNone,   ///< 不绑定，由操作系统调度
+            kPinned, ///< 每个工作线程固定到一个CPU（按顺序循环分配）
+            kCpuSet, ///< 所有工作线程限定在同一个CPU集合内浮动
+            kNuma    ///< 工作线程按NUMA节点分组，每个线程限定在所属节点的CPU集合内
+        };
+
+        /**
+         * @brief 单个工作线程的放置结果
+         */
+        struct Slot
+        {
+            std::vector<int> cpus; ///< 允许运行的CPU集合（为空表示不绑定）
+            int node;              ///< 所属NUMA节点编号（未按节点分组时为-1）
+        };
+
+    private:
+        Mode m_mode;             ///< 放置模式
+        std::vector<int> m_cpus; ///< kPinned/kCpuSet模式使用的CPU列表
+        bool m_nodeLocalQueues;  ///< kNuma模式：是否启用节点本地队列（就近窃取）
+
+    public:
+        WorkerPlacement() : m_mode(Mode::kNone), m_nodeLocalQueues(false) {}
+
+        /**
+         * @brief 每个工作线程固定到一个CPU
+         * @param cpus CPU列表，工作线程i绑定到cpus[i % cpus.size()]（为空时等同于不绑定）
+         */
+        static WorkerPlacement pinned(std::vector<int> cpus)
+        {
+            WorkerPlacement placement;
+            placement.m_mode = cpus.empty() ? Mode::kNone : Mode::kPinned;
+            placement.m_cpus = std::move(cpus);
+            return placement;
+        }
+
+        /**
+         * @brief 所有工作线程限定在同一个CPU集合内
+         * @param cpus CPU集合（为空时等同于不绑定）
+         */
+        static WorkerPlacement cpuSet(std::vector<int> cpus)
+        {
+            WorkerPlacement placement;
+            placement.m_mode = cpus.empty() ? Mode::kNone : Mode::kCpuSet;
+            placement.m_cpus = std::move(cpus);
+            return placement;
+        }
+
+        /**
+         * @brief 工作线程按NUMA节点分组
+         * @param nodeLocalQueues 是否启用节点本地队列：线程池开启工作窃取，空闲线程优先窃取同节点线程的任务，
+         *                        同节点都为空时才跨节点窃取（默认false）
+         * @note 工作线程按编号连续分块分配到各节点（线程数不能整除节点数时前面的节点多分一个）
+         */
+        static WorkerPlacement numa(bool nodeLocalQueues = false)
+        {
+            WorkerPlacement placement;
+            placement.m_mode = Mode::kNuma;
+            placement.m_nodeLocalQueues = nodeLocalQueues;
+            return placement;
+        }
+
+        Mode mode() const { return m_mode; }
+        bool nodeLocalQueues() const { return m_mode == Mode::kNuma && m_nodeLocalQueues; }
+
+        /**
+         * @brief 计算每个工作线程的放置结果
+         * @param workerNum 工作线程数
+         * @return 长度为workerNum的放置结果数组
+         */
+        std::vector<Slot> assign(size_t workerNum) const
+        {
+            std::vector<Slot> slots(workerNum, Slot{{}, -1});
+            switch (m_mode)
+            {
+            case Mode::kPinned:
+                for (size_t i = 0; i < workerNum; ++i) slots[i].cpus = {m_cpus[i % m_cpus.size()]};
+                break;
+            case Mode::kCpuSet:
+                for (auto& slot : slots) slot.cpus = m_cpus;
+                break;
+            case Mode::kNuma:
+            {
+                std::vector<NumaNode> nodes = getNumaNodes();
+                for (size_t i = 0; i < workerNum; ++i)
+                {
+                    const NumaNode& node = nodes[i * nodes.size() / workerNum];
+                    slots[i].cpus = node.cpus;
+                    slots[i].node = node.id;
+                }
+                break;
+            }
+            default:
+                break;
+            }
+            return slots;
+        }
+    };
+
+} // namespace ol
+
+#endif // !OL_AFFINITY_H
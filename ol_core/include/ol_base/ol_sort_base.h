@@ -4,15 +4,22 @@
 #include "ol_type_traits.h"
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <deque>
+#include <exception>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <iterator>
 #include <list>
 #include <memory>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace ol
@@ -411,6 +418,511 @@ namespace ol
         }
         // -----------------------------------------------------------------------
 
+        // Timsort（自适应稳定排序）相关实现
+        // -----------------------------------------------------------------------
+        constexpr ptrdiff_t TIM_MIN_MERGE = 32; ///< 小于该长度的数组直接用折半插入排序
+        constexpr ptrdiff_t TIM_MIN_GALLOP = 7; ///< 进入飞奔（galloping）模式的初始阈值
+
+        /**
+         * @brief 计算最小顺串长度minrun，使顺串个数等于或略小于2的幂，合并尽量平衡
+         */
+        inline ptrdiff_t tim_min_run_base(ptrdiff_t n)
+        {
+            ptrdiff_t r = 0; // n的低位中有1被移出时置1
+            while (n >= TIM_MIN_MERGE)
+            {
+                r |= (n & 1);
+                n >>= 1;
+            }
+            return n + r;
+        }
+
+        /**
+         * @brief 从first开始识别一个顺串：非降序直接返回，严格降序则原地反转（严格降序反转不破坏稳定性）
+         * @return 顺串长度
+         */
+        template <typename RandomIt, typename Compare>
+        ptrdiff_t tim_count_run_base(RandomIt first, RandomIt last, const Compare& comp)
+        {
+            RandomIt run_hi = first + 1;
+            if (run_hi == last) return 1;
+
+            if (comp(*run_hi, *first))
+            {
+                ++run_hi;
+                while (run_hi != last && comp(*run_hi, *(run_hi - 1))) ++run_hi;
+                std::reverse(first, run_hi);
+            }
+            else
+            {
+                ++run_hi;
+                while (run_hi != last && !comp(*run_hi, *(run_hi - 1))) ++run_hi;
+            }
+            return run_hi - first;
+        }
+
+        /**
+         * @brief 折半插入排序，[first, start)已有序，用upper_bound定位保证稳定
+         */
+        template <typename RandomIt, typename Compare>
+        void tim_binary_sort_base(RandomIt first, RandomIt last, RandomIt start, const Compare& comp)
+        {
+            for (; start < last; ++start)
+            {
+                auto pivot = std::move(*start);
+                RandomIt pos = std::upper_bound(first, start, pivot, comp);
+                std::move_backward(pos, start, start + 1);
+                *pos = std::move(pivot);
+            }
+        }
+
+        /**
+         * @brief 在有序区间[a, a+len)中从hint处指数搜索key的插入位置（相等元素之前）
+         * @return k，满足a[k-1] < key <= a[k]
+         */
+        template <typename T, typename It, typename Compare>
+        ptrdiff_t tim_gallop_left_base(const T& key, It a, ptrdiff_t len, ptrdiff_t hint, const Compare& comp)
+        {
+            ptrdiff_t last_ofs = 0, ofs = 1;
+            if (comp(a[hint], key))
+            {
+                // a[hint] < key：向右飞奔，直到a[hint+last_ofs] < key <= a[hint+ofs]
+                const ptrdiff_t max_ofs = len - hint;
+                while (ofs < max_ofs && comp(a[hint + ofs], key))
+                {
+                    last_ofs = ofs;
+                    ofs = (ofs << 1) + 1;
+                }
+                if (ofs > max_ofs) ofs = max_ofs;
+                last_ofs += hint;
+                ofs += hint;
+            }
+            else
+            {
+                // key <= a[hint]：向左飞奔，直到a[hint-ofs] < key <= a[hint-last_ofs]
+                const ptrdiff_t max_ofs = hint + 1;
+                while (ofs < max_ofs && !comp(a[hint - ofs], key))
+                {
+                    last_ofs = ofs;
+                    ofs = (ofs << 1) + 1;
+                }
+                if (ofs > max_ofs) ofs = max_ofs;
+                const ptrdiff_t tmp = last_ofs;
+                last_ofs = hint - ofs;
+                ofs = hint - tmp;
+            }
+
+            // a[last_ofs] < key <= a[ofs]，在(last_ofs, ofs]内二分
+            ++last_ofs;
+            while (last_ofs < ofs)
+            {
+                const ptrdiff_t m = last_ofs + ((ofs - last_ofs) >> 1);
+                if (comp(a[m], key))
+                    last_ofs = m + 1;
+                else
+                    ofs = m;
+            }
+            return ofs;
+        }
+
+        /**
+         * @brief 在有序区间[a, a+len)中从hint处指数搜索key的插入位置（相等元素之后）
+         * @return k，满足a[k-1] <= key < a[k]
+         */
+        template <typename T, typename It, typename Compare>
+        ptrdiff_t tim_gallop_right_base(const T& key, It a, ptrdiff_t len, ptrdiff_t hint, const Compare& comp)
+        {
+            ptrdiff_t last_ofs = 0, ofs = 1;
+            if (comp(key, a[hint]))
+            {
+                // key < a[hint]：向左飞奔
+                const ptrdiff_t max_ofs = hint + 1;
+                while (ofs < max_ofs && comp(key, a[hint - ofs]))
+                {
+                    last_ofs = ofs;
+                    ofs = (ofs << 1) + 1;
+                }
+                if (ofs > max_ofs) ofs = max_ofs;
+                const ptrdiff_t tmp = last_ofs;
+                last_ofs = hint - ofs;
+                ofs = hint - tmp;
+            }
+            else
+            {
+                // a[hint] <= key：向右飞奔
+                const ptrdiff_t max_ofs = len - hint;
+                while (ofs < max_ofs && !comp(key, a[hint + ofs]))
+                {
+                    last_ofs = ofs;
+                    ofs = (ofs << 1) + 1;
+                }
+                if (ofs > max_ofs) ofs = max_ofs;
+                last_ofs += hint;
+                ofs += hint;
+            }
+
+            ++last_ofs;
+            while (last_ofs < ofs)
+            {
+                const ptrdiff_t m = last_ofs + ((ofs - last_ofs) >> 1);
+                if (comp(key, a[m]))
+                    ofs = m;
+                else
+                    last_ofs = m + 1;
+            }
+            return ofs;
+        }
+
+        /**
+         * @brief Timsort的合并状态：待合并顺串栈、飞奔阈值和临时缓冲区
+         * @note 临时缓冲区只存放两个相邻顺串中较短的一个，最多n/2个元素，且在整个排序过程中复用
+         */
+        template <typename RandomIt, typename Compare>
+        class TimSortState
+        {
+        private:
+            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+            RandomIt m_a;                        ///< 待排序区间的起始位置，顺串用相对下标表示
+            const Compare& m_comp;               ///< 比较函数对象
+            ptrdiff_t m_min_gallop = TIM_MIN_GALLOP; ///< 当前飞奔阈值，随数据特征自适应调整
+            std::vector<ValueType> m_tmp;        ///< 合并用临时缓冲区
+            std::vector<ptrdiff_t> m_run_base;   ///< 待合并顺串的起始下标
+            std::vector<ptrdiff_t> m_run_len;    ///< 待合并顺串的长度
+
+        public:
+            TimSortState(RandomIt first, const Compare& comp) : m_a(first), m_comp(comp) {}
+
+            void push_run(ptrdiff_t base, ptrdiff_t len)
+            {
+                m_run_base.push_back(base);
+                m_run_len.push_back(len);
+            }
+
+            /**
+             * @brief 维持栈不变式：len[n-2] > len[n-1] + len[n]且len[n-1] > len[n]，
+             *        保证栈深度为O(log n)且每次合并的两个顺串长度接近
+             */
+            void merge_collapse()
+            {
+                while (m_run_len.size() > 1)
+                {
+                    ptrdiff_t n = static_cast<ptrdiff_t>(m_run_len.size()) - 2;
+                    if ((n > 0 && m_run_len[n - 1] <= m_run_len[n] + m_run_len[n + 1]) ||
+                        (n > 1 && m_run_len[n - 2] <= m_run_len[n] + m_run_len[n - 1]))
+                    {
+                        if (m_run_len[n - 1] < m_run_len[n + 1]) --n;
+                    }
+                    else if (m_run_len[n] > m_run_len[n + 1])
+                    {
+                        break;
+                    }
+                    merge_at(n);
+                }
+            }
+
+            // 合并栈中剩余的全部顺串
+            void merge_force_collapse()
+            {
+                while (m_run_len.size() > 1)
+                {
+                    ptrdiff_t n = static_cast<ptrdiff_t>(m_run_len.size()) - 2;
+                    if (n > 0 && m_run_len[n - 1] < m_run_len[n + 1]) --n;
+                    merge_at(n);
+                }
+            }
+
+        private:
+            // 合并栈中第i和i+1个顺串
+            void merge_at(ptrdiff_t i)
+            {
+                ptrdiff_t base1 = m_run_base[i], len1 = m_run_len[i];
+                const ptrdiff_t base2 = m_run_base[i + 1];
+                ptrdiff_t len2 = m_run_len[i + 1];
+
+                m_run_len[i] = len1 + len2;
+                m_run_base.erase(m_run_base.begin() + i + 1);
+                m_run_len.erase(m_run_len.begin() + i + 1);
+
+                // 顺串1中不大于run2[0]的前缀、顺串2中不小于run1末尾的后缀已在最终位置
+                const ptrdiff_t k = tim_gallop_right_base(m_a[base2], m_a + base1, len1, 0, m_comp);
+                base1 += k;
+                len1 -= k;
+                if (len1 == 0) return;
+
+                len2 = tim_gallop_left_base(m_a[base1 + len1 - 1], m_a + base2, len2, len2 - 1, m_comp);
+                if (len2 == 0) return;
+
+                if (len1 <= len2)
+                    merge_lo(base1, len1, base2, len2);
+                else
+                    merge_hi(base1, len1, base2, len2);
+            }
+
+            // 从左向右合并，len1 <= len2，顺串1移入临时缓冲区
+            void merge_lo(ptrdiff_t base1, ptrdiff_t len1, ptrdiff_t base2, ptrdiff_t len2)
+            {
+                m_tmp.assign(std::make_move_iterator(m_a + base1), std::make_move_iterator(m_a + base1 + len1));
+                auto tmp = m_tmp.begin();
+                ptrdiff_t cursor1 = 0, cursor2 = base2, dest = base1;
+
+                // merge_at保证run2[0]小于run1[0]，run1末尾是整体最大值
+                m_a[dest++] = std::move(m_a[cursor2++]);
+                if (--len2 == 0)
+                {
+                    std::move(tmp + cursor1, tmp + cursor1 + len1, m_a + dest);
+                    return;
+                }
+                if (len1 == 1)
+                {
+                    std::move(m_a + cursor2, m_a + cursor2 + len2, m_a + dest);
+                    m_a[dest + len2] = std::move(tmp[cursor1]);
+                    return;
+                }
+
+                ptrdiff_t min_gallop = m_min_gallop;
+                while (true)
+                {
+                    ptrdiff_t count1 = 0, count2 = 0; // 两个顺串各自连续胜出的次数
+
+                    // 逐个比较，直到某一方连续胜出min_gallop次
+                    bool done = false;
+                    do
+                    {
+                        if (m_comp(m_a[cursor2], tmp[cursor1]))
+                        {
+                            m_a[dest++] = std::move(m_a[cursor2++]);
+                            ++count2;
+                            count1 = 0;
+                            if (--len2 == 0) done = true;
+                        }
+                        else
+                        {
+                            m_a[dest++] = std::move(tmp[cursor1++]);
+                            ++count1;
+                            count2 = 0;
+                            if (--len1 == 1) done = true;
+                        }
+                    } while (!done && (count1 | count2) < min_gallop);
+                    if (done) break;
+
+                    // 飞奔模式：用指数搜索整段搬移，直到两边胜出的段长都小于TIM_MIN_GALLOP
+                    do
+                    {
+                        count1 = tim_gallop_right_base(m_a[cursor2], tmp + cursor1, len1, 0, m_comp);
+                        if (count1 != 0)
+                        {
+                            std::move(tmp + cursor1, tmp + cursor1 + count1, m_a + dest);
+                            dest += count1;
+                            cursor1 += count1;
+                            len1 -= count1;
+                            if (len1 <= 1)
+                            {
+                                done = true;
+                                break;
+                            }
+                        }
+                        m_a[dest++] = std::move(m_a[cursor2++]);
+                        if (--len2 == 0)
+                        {
+                            done = true;
+                            break;
+                        }
+
+                        count2 = tim_gallop_left_base(tmp[cursor1], m_a + cursor2, len2, 0, m_comp);
+                        if (count2 != 0)
+                        {
+                            std::move(m_a + cursor2, m_a + cursor2 + count2, m_a + dest);
+                            dest += count2;
+                            cursor2 += count2;
+                            len2 -= count2;
+                            if (len2 == 0)
+                            {
+                                done = true;
+                                break;
+                            }
+                        }
+                        m_a[dest++] = std::move(tmp[cursor1++]);
+                        if (--len1 == 1)
+                        {
+                            done = true;
+                            break;
+                        }
+                        --min_gallop;
+                    } while (count1 >= TIM_MIN_GALLOP || count2 >= TIM_MIN_GALLOP);
+                    if (done) break;
+
+                    // 飞奔收益不大，提高阈值（惩罚离开飞奔模式）
+                    if (min_gallop < 0) min_gallop = 0;
+                    min_gallop += 2;
+                }
+                m_min_gallop = min_gallop < 1 ? 1 : min_gallop;
+
+                if (len1 == 1)
+                {
+                    std::move(m_a + cursor2, m_a + cursor2 + len2, m_a + dest);
+                    m_a[dest + len2] = std::move(tmp[cursor1]);
+                }
+                else if (len1 > 0)
+                {
+                    // len1 == 0只会在比较器违反严格弱序时出现，此时剩余元素已在原位
+                    std::move(tmp + cursor1, tmp + cursor1 + len1, m_a + dest);
+                }
+            }
+
+            // 从右向左合并，len1 > len2，顺串2移入临时缓冲区（cursor可能为-1，只在有效时构造迭代器）
+            void merge_hi(ptrdiff_t base1, ptrdiff_t len1, ptrdiff_t base2, ptrdiff_t len2)
+            {
+                m_tmp.assign(std::make_move_iterator(m_a + base2), std::make_move_iterator(m_a + base2 + len2));
+                auto tmp = m_tmp.begin();
+                ptrdiff_t cursor1 = base1 + len1 - 1, cursor2 = len2 - 1, dest = base2 + len2 - 1;
+
+                // merge_at保证run1末尾大于run2末尾，run2[0]是整体最小值
+                m_a[dest--] = std::move(m_a[cursor1--]);
+                if (--len1 == 0)
+                {
+                    std::move(tmp, tmp + len2, m_a + (dest - (len2 - 1)));
+                    return;
+                }
+                if (len2 == 1)
+                {
+                    dest -= len1;
+                    cursor1 -= len1;
+                    std::move_backward(m_a + (cursor1 + 1), m_a + (cursor1 + 1 + len1), m_a + (dest + 1 + len1));
+                    m_a[dest] = std::move(tmp[cursor2]);
+                    return;
+                }
+
+                ptrdiff_t min_gallop = m_min_gallop;
+                while (true)
+                {
+                    ptrdiff_t count1 = 0, count2 = 0;
+
+                    bool done = false;
+                    do
+                    {
+                        if (m_comp(tmp[cursor2], m_a[cursor1]))
+                        {
+                            m_a[dest--] = std::move(m_a[cursor1--]);
+                            ++count1;
+                            count2 = 0;
+                            if (--len1 == 0) done = true;
+                        }
+                        else
+                        {
+                            m_a[dest--] = std::move(tmp[cursor2--]);
+                            ++count2;
+                            count1 = 0;
+                            if (--len2 == 1) done = true;
+                        }
+                    } while (!done && (count1 | count2) < min_gallop);
+                    if (done) break;
+
+                    do
+                    {
+                        count1 = len1 - tim_gallop_right_base(tmp[cursor2], m_a + base1, len1, len1 - 1, m_comp);
+                        if (count1 != 0)
+                        {
+                            dest -= count1;
+                            cursor1 -= count1;
+                            len1 -= count1;
+                            std::move_backward(m_a + (cursor1 + 1), m_a + (cursor1 + 1 + count1), m_a + (dest + 1 + count1));
+                            if (len1 == 0)
+                            {
+                                done = true;
+                                break;
+                            }
+                        }
+                        m_a[dest--] = std::move(tmp[cursor2--]);
+                        if (--len2 == 1)
+                        {
+                            done = true;
+                            break;
+                        }
+
+                        count2 = len2 - tim_gallop_left_base(m_a[cursor1], tmp, len2, len2 - 1, m_comp);
+                        if (count2 != 0)
+                        {
+                            dest -= count2;
+                            cursor2 -= count2;
+                            len2 -= count2;
+                            std::move(tmp + (cursor2 + 1), tmp + (cursor2 + 1 + count2), m_a + (dest + 1));
+                            if (len2 <= 1)
+                            {
+                                done = true;
+                                break;
+                            }
+                        }
+                        m_a[dest--] = std::move(m_a[cursor1--]);
+                        if (--len1 == 0)
+                        {
+                            done = true;
+                            break;
+                        }
+                        --min_gallop;
+                    } while (count1 >= TIM_MIN_GALLOP || count2 >= TIM_MIN_GALLOP);
+                    if (done) break;
+
+                    if (min_gallop < 0) min_gallop = 0;
+                    min_gallop += 2;
+                }
+                m_min_gallop = min_gallop < 1 ? 1 : min_gallop;
+
+                if (len2 == 1)
+                {
+                    dest -= len1;
+                    cursor1 -= len1;
+                    std::move_backward(m_a + (cursor1 + 1), m_a + (cursor1 + 1 + len1), m_a + (dest + 1 + len1));
+                    m_a[dest] = std::move(tmp[cursor2]);
+                }
+                else if (len2 > 0)
+                {
+                    std::move(tmp, tmp + len2, m_a + (dest - (len2 - 1)));
+                }
+            }
+        };
+
+        /**
+         * @brief Timsort入口：识别自然顺串，不足minrun的用折半插入排序补足，再按栈不变式合并
+         */
+        template <typename RandomIt, typename Compare>
+        void tim_sort_base(RandomIt first, RandomIt last, const Compare& comp)
+        {
+            ptrdiff_t remaining = last - first;
+            if (remaining < 2) return;
+
+            // 小数组：一个顺串加折半插入排序
+            if (remaining < TIM_MIN_MERGE)
+            {
+                const ptrdiff_t run_len = tim_count_run_base(first, last, comp);
+                tim_binary_sort_base(first, last, first + run_len, comp);
+                return;
+            }
+
+            TimSortState<RandomIt, Compare> state(first, comp);
+            const ptrdiff_t min_run = tim_min_run_base(remaining);
+            ptrdiff_t lo = 0;
+            do
+            {
+                ptrdiff_t run_len = tim_count_run_base(first + lo, last, comp);
+                if (run_len < min_run)
+                {
+                    const ptrdiff_t force = remaining < min_run ? remaining : min_run;
+                    tim_binary_sort_base(first + lo, first + lo + force, first + lo + run_len, comp);
+                    run_len = force;
+                }
+
+                state.push_run(lo, run_len);
+                state.merge_collapse();
+
+                lo += run_len;
+                remaining -= run_len;
+            } while (remaining != 0);
+
+            state.merge_force_collapse();
+        }
+        // -----------------------------------------------------------------------
+
         // 计数排序相关实现
         // -----------------------------------------------------------------------
         /**
@@ -464,6 +976,51 @@ namespace ol
             // 复制回原数组
             std::copy(output.begin(), output.end(), first);
         }
+
+        /**
+         * @brief 判断按数值重写结果的排序（radix256_sort、复用计数数组的counting_sort）的比较器表示升序还是降序（只支持std::less和std::greater）
+         */
+        template <typename Compare, typename Key>
+        struct radix_descending
+        {
+            static constexpr bool ascending = std::is_same<Compare, std::less<Key>>::value || std::is_same<Compare, std::less<>>::value;
+            static constexpr bool value = std::is_same<Compare, std::greater<Key>>::value || std::is_same<Compare, std::greater<>>::value;
+            static_assert(ascending || value, "radix256_sort and counting_sort with workspace support only std::less (ascending) and std::greater (descending)");
+        };
+
+        /**
+         * @brief 计数排序（复用计数数组）：统计每个值出现的次数后按值依次写回，不需要输出缓冲区
+         * @param counts 计数数组（调用方提供，容量不小于值域时不做任何堆分配）
+         * @note 相等的整数不可区分，按计数重写与稳定分发的结果相同；比较器只支持std::less和std::greater
+         */
+        template <typename RandomIt, typename Compare>
+        void counting_sort_counts_base(RandomIt first, RandomIt last, std::vector<size_t>& counts, const Compare& comp)
+        {
+            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+            constexpr bool descending = radix_descending<Compare, ValueType>::value;
+            (void)comp;
+            if (last - first <= 1) return;
+
+            auto extremes = std::minmax_element(first, last);
+            const ValueType min_val = *extremes.first;
+
+            // 在uint64_t上做差，任意宽度不超过64位的整数都不会溢出
+            const uint64_t base = static_cast<uint64_t>(min_val);
+            const uint64_t span = static_cast<uint64_t>(*extremes.second) - base;
+            if (span >= counts.max_size())
+                throw std::length_error("Value range is too large for counting_sort");
+            const size_t range = static_cast<size_t>(span) + 1;
+
+            counts.assign(range, 0);
+            for (RandomIt it = first; it != last; ++it) ++counts[static_cast<size_t>(static_cast<uint64_t>(*it) - base)];
+
+            RandomIt out = first;
+            for (size_t i = 0; i < range; ++i)
+            {
+                const size_t v = descending ? range - 1 - i : i;
+                out = std::fill_n(out, counts[v], static_cast<ValueType>(base + v));
+            }
+        }
         // -----------------------------------------------------------------------
 
         // 基数排序（LSD）相关实现
@@ -599,6 +1156,153 @@ namespace ol
         }
         // -----------------------------------------------------------------------
 
+        // 字节基数排序（radix 256）相关实现
+        // -----------------------------------------------------------------------
+        /**
+         * @brief 键值编码：把算术类型映射为同宽度的无符号整数，编码后的无符号大小顺序与原值的大小顺序一致
+         * @tparam Key 键类型（整数、bool、float、double）
+         * @note
+         * - 无符号整数：原样使用
+         * - 有符号整数：翻转符号位，负数排在非负数之前
+         * - IEEE浮点数：非负数翻转符号位，负数翻转所有位（负数的位模式越大值越小）；
+         *   结果中-0.0排在+0.0之前，符号位为1的NaN排在最前，符号位为0的NaN排在最后
+         */
+        template <typename Key, typename Enable = void>
+        struct radix_key_traits;
+
+        template <typename Key>
+        struct radix_key_traits<Key, typename std::enable_if<std::is_integral<Key>::value>::type>
+        {
+            using UKey = typename std::make_unsigned<typename std::conditional<std::is_same<Key, bool>::value, unsigned char, Key>::type>::type;
+
+            static UKey encode(Key key)
+            {
+                UKey u = static_cast<UKey>(key);
+                if (std::is_signed<Key>::value) u ^= static_cast<UKey>(UKey(1) << (sizeof(UKey) * 8 - 1));
+                return u;
+            }
+        };
+
+        template <typename Key>
+        struct radix_key_traits<Key, typename std::enable_if<std::is_floating_point<Key>::value>::type>
+        {
+            static_assert(sizeof(Key) == 4 || sizeof(Key) == 8, "radix256_sort supports 32-bit and 64-bit IEEE floating point keys only");
+            using UKey = typename std::conditional<sizeof(Key) == 4, uint32_t, uint64_t>::type;
+
+            static UKey encode(Key key)
+            {
+                UKey u;
+                std::memcpy(&u, &key, sizeof(u));
+                const UKey sign = static_cast<UKey>(UKey(1) << (sizeof(UKey) * 8 - 1));
+                return (u & sign) ? static_cast<UKey>(~u) : static_cast<UKey>(u ^ sign);
+            }
+        };
+
+        /**
+         * @brief 按当前字节把src中的元素稳定地分发到dst
+         * @param offsets 每个字节值在dst中的起始位置，分发过程中递增
+         */
+        template <typename SrcIt, typename DstIt, typename Encode>
+        void radix256_scatter_base(SrcIt src, SrcIt src_end, DstIt dst, size_t* offsets,
+                                   unsigned shift, const Encode& encode)
+        {
+            for (; src != src_end; ++src)
+            {
+                const size_t byte = static_cast<size_t>((encode(*src) >> shift) & 0xFF);
+                dst[static_cast<ptrdiff_t>(offsets[byte]++)] = std::move(*src);
+            }
+        }
+
+        /**
+         * @brief 字节基数排序核心实现（LSD，每趟处理一个字节）
+         *
+         * 算法逻辑：
+         * 1. 遍历一次数据，同时统计所有字节位置的直方图（不必每趟重新统计）
+         * 2. 某个字节位置上所有元素取值相同时，该趟不改变顺序，直接跳过（如小范围整数的高位字节）
+         * 3. 其余各趟在数据区间与scratch之间交替分发，结束时若结果在scratch中再移回数据区间
+         *
+         * @param scratch 缓冲区，大小不足时扩容，已有容量可跨调用复用以避免重复分配
+         * @param encode 元素到无符号编码键的映射，编码键的无符号顺序即排序顺序
+         */
+        template <typename RandomIt, typename Encode>
+        void radix256_sort_base(RandomIt first, RandomIt last,
+                                std::vector<typename std::iterator_traits<RandomIt>::value_type>& scratch,
+                                const Encode& encode)
+        {
+            using UKey = decltype(encode(*first));
+            constexpr size_t PASSES = sizeof(UKey);
+
+            const ptrdiff_t n = last - first;
+            if (n <= 1) return;
+
+            // 1. 一次遍历统计所有字节位置的直方图
+            std::array<std::array<size_t, 256>, PASSES> hist{};
+            for (RandomIt it = first; it != last; ++it)
+            {
+                const UKey u = encode(*it);
+                for (size_t p = 0; p < PASSES; ++p) ++hist[p][(u >> (p * 8)) & 0xFF];
+            }
+
+            if (scratch.size() < static_cast<size_t>(n)) scratch.resize(static_cast<size_t>(n));
+            auto buf = scratch.begin();
+            bool in_scratch = false;
+
+            for (size_t p = 0; p < PASSES; ++p)
+            {
+                // 2. 所有元素在该字节上相同：跳过
+                const size_t bucket = static_cast<size_t>((encode(in_scratch ? *buf : *first) >> (p * 8)) & 0xFF);
+                if (hist[p][bucket] == static_cast<size_t>(n)) continue;
+
+                // 3. 前缀和得到各字节值的起始位置，然后分发
+                size_t offsets[256];
+                size_t sum = 0;
+                for (size_t b = 0; b < 256; ++b)
+                {
+                    offsets[b] = sum;
+                    sum += hist[p][b];
+                }
+
+                const unsigned shift = static_cast<unsigned>(p * 8);
+                if (in_scratch)
+                    radix256_scatter_base(buf, buf + n, first, offsets, shift, encode);
+                else
+                    radix256_scatter_base(first, last, buf, offsets, shift, encode);
+                in_scratch = !in_scratch;
+            }
+
+            if (in_scratch) std::move(buf, buf + n, first);
+        }
+
+        /// 容器（或原生数组）的元素类型；与container_traits不同，对非容器类型是SFINAE友好的，可用于重载决议。
+        template <typename Container>
+        using range_value_t = typename std::decay<decltype(*std::begin(std::declval<Container&>()))>::type;
+
+        /// 键提取函数作用于元素后得到的键类型。
+        template <typename KeyFn, typename T>
+        using radix_key_t = typename std::decay<typename std::invoke_result<const KeyFn&, const T&>::type>::type;
+
+        /**
+         * @brief 按键提取函数得到的算术键进行字节基数排序
+         * @param key 键提取函数，每趟分发都会重新调用，应当廉价（如返回成员）
+         * @param comp std::less（升序）或std::greater（降序），降序通过翻转编码键的所有位实现，仍保持稳定
+         */
+        template <typename RandomIt, typename KeyFn, typename Compare>
+        void radix256_sort_by_key_base(RandomIt first, RandomIt last,
+                                       std::vector<typename std::iterator_traits<RandomIt>::value_type>& scratch,
+                                       const KeyFn& key, const Compare& comp)
+        {
+            (void)comp; // 只使用比较器的类型
+            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+            using Key = radix_key_t<KeyFn, ValueType>;
+            using traits = radix_key_traits<Key>;
+            using UKey = typename traits::UKey;
+
+            const UKey flip = radix_descending<Compare, Key>::value ? static_cast<UKey>(~UKey(0)) : UKey(0);
+            radix256_sort_base(first, last, scratch, [&key, flip](const ValueType& v)
+                               { return static_cast<UKey>(traits::encode(key(v)) ^ flip); });
+        }
+        // -----------------------------------------------------------------------
+
         // 基数排序（MSD）相关实现
         // -----------------------------------------------------------------------
         /**
@@ -633,11 +1337,11 @@ namespace ol
             using ValueType = typename std::iterator_traits<RandomIt>::value_type;
             std::vector<std::vector<ValueType>> buckets(radix + 1);
 
-            // 分配元素到对应桶（使用unsigned char避免符号扩展）
+            // 分配元素到对应桶（使用unsigned char避免符号扩展）；已到末尾的字符串放入0号桶，不再递归，
+            // 否则相同的字符串会在同一个桶里无限递归下去
             for (auto iter = first; iter != last; ++iter)
             {
-                unsigned char c = get_char(*iter, pos);
-                size_t bucket_idx = static_cast<size_t>(c) + 1; // +1避开索引0
+                size_t bucket_idx = pos < iter->size() ? static_cast<size_t>(get_char(*iter, pos)) + 1 : 0;
                 buckets[bucket_idx].push_back(*iter);
             }
 
@@ -787,93 +1491,998 @@ namespace ol
         }
         // -----------------------------------------------------------------------
 
-        // 桶排序相关实现
+        // 内省排序相关实现
         // -----------------------------------------------------------------------
+        constexpr ptrdiff_t INTRO_INSERTION_THRESHOLD = 24;   ///< 小于该长度的区间使用插入排序
+        constexpr ptrdiff_t INTRO_NINTHER_THRESHOLD = 128;    ///< 大于该长度的区间使用九数取中（ninther）选基准
+        constexpr ptrdiff_t INTRO_PARTIAL_INSERTION_LIMIT = 8; ///< 部分插入排序允许的最大元素移动次数
+        constexpr size_t INTRO_BLOCK_SIZE = 64;               ///< 无分支分区每块处理的元素数
+
         /**
-         * @brief 桶排序核心实现（适用于浮点数）
-         *
-         * 算法逻辑：
-         * 1. 根据数值范围划分桶（桶的划分基于数值大小，与比较器无关）
-         * 2. 将元素分配到对应桶中
-         * 3. 对每个桶内元素使用自定义比较器进行排序
-         * 4. 合并所有桶的结果
+         * @brief 判断是否可以使用无分支分区：元素为算术类型或指针，且比较器为std::less/std::greater
+         * @note 只有比较代价极低且结果不可预测时，用比较结果直接计算写入位置才比条件分支更快；
+         *       自定义比较器可能很昂贵，不启用
+         */
+        template <typename T, typename Compare>
+        struct is_branchless_sortable
+            : std::integral_constant<bool,
+                                     (std::is_arithmetic<T>::value || std::is_pointer<T>::value) &&
+                                         (std::is_same<Compare, std::less<T>>::value ||
+                                          std::is_same<Compare, std::greater<T>>::value ||
+                                          std::is_same<Compare, std::less<>>::value ||
+                                          std::is_same<Compare, std::greater<>>::value)>
+        {
+        };
+
+        /**
+         * @brief 对三个位置的元素排序（结果满足*a <= *b <= *c）
          */
         template <typename RandomIt, typename Compare>
-        void bucket_sort_float_base(RandomIt first, RandomIt last,
-                                    size_t num_buckets,
-                                    double min_val, double max_val,
-                                    const Compare& comp)
+        void sort3_base(RandomIt a, RandomIt b, RandomIt c, const Compare& comp)
         {
-            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
-            const ptrdiff_t n = std::distance(first, last);
-            if (n <= 1) return;
+            if (comp(*b, *a)) std::iter_swap(a, b);
+            if (comp(*c, *b)) std::iter_swap(b, c);
+            if (comp(*b, *a)) std::iter_swap(a, b);
+        }
 
-            // 创建桶容器
-            std::vector<std::vector<ValueType>> buckets(num_buckets);
-            const double range = max_val - min_val;
+        /**
+         * @brief 插入排序（移动语义版本）
+         * @param guarded false-调用方保证first之前的元素不大于区间内任何元素，内层循环可省去边界检查
+         */
+        template <typename RandomIt, typename Compare>
+        void intro_insertion_sort_base(RandomIt first, RandomIt last, const Compare& comp, bool guarded)
+        {
+            if (first == last) return;
 
-            // 分配元素到对应桶（桶的划分基于数值范围）
-            for (RandomIt it = first; it != last; ++it)
+            for (RandomIt cur = first + 1; cur != last; ++cur)
             {
-                size_t idx = static_cast<size_t>(((*it - min_val) / range) * num_buckets);
-                if (idx >= num_buckets) idx = num_buckets - 1;
-                buckets[idx].push_back(*it);
-            }
-
-            // 桶内排序：使用自定义比较器
-            for (auto& bucket : buckets)
-                insertion_sort_base(bucket.begin(), bucket.end(), comp);
+                RandomIt sift = cur;
+                RandomIt sift_1 = cur - 1;
+                if (!comp(*sift, *sift_1)) continue;
 
-            // 合并所有桶的结果
-            auto dest_it = first;
-            for (const auto& bucket : buckets)
-                dest_it = std::copy(bucket.begin(), bucket.end(), dest_it);
+                auto tmp = std::move(*sift);
+                if (guarded)
+                {
+                    do
+                    {
+                        *sift-- = std::move(*sift_1);
+                    } while (sift != first && comp(tmp, *--sift_1));
+                }
+                else
+                {
+                    do
+                    {
+                        *sift-- = std::move(*sift_1);
+                    } while (comp(tmp, *--sift_1));
+                }
+                *sift = std::move(tmp);
+            }
+        }
+
+        /**
+         * @brief 部分插入排序：移动次数超过INTRO_PARTIAL_INSERTION_LIMIT时放弃
+         * @return true-区间已排好序，false-区间离有序较远，已放弃（区间仍是原元素的某个排列）
+         * @note 用于分区后发现无需交换（输入可能已接近有序）时的快速收尾
+         */
+        template <typename RandomIt, typename Compare>
+        bool partial_insertion_sort_base(RandomIt first, RandomIt last, const Compare& comp)
+        {
+            if (first == last) return true;
+
+            ptrdiff_t moves = 0;
+            for (RandomIt cur = first + 1; cur != last; ++cur)
+            {
+                RandomIt sift = cur;
+                RandomIt sift_1 = cur - 1;
+                if (comp(*sift, *sift_1))
+                {
+                    auto tmp = std::move(*sift);
+                    do
+                    {
+                        *sift-- = std::move(*sift_1);
+                    } while (sift != first && comp(tmp, *--sift_1));
+                    *sift = std::move(tmp);
+                    moves += cur - sift;
+                }
+                if (moves > INTRO_PARTIAL_INSERTION_LIMIT) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief 以*first为基准分区，与基准相等的元素放在左侧
+         * @return 基准的最终位置，其左侧元素均等于基准（调用方保证区间内没有比基准更小的元素）
+         * @note 当基准与左侧相邻区间的元素相等时使用：本区间内与基准相等的元素一次性就位，
+         *       大量重复键的输入因此退化为线性时间
+         */
+        template <typename RandomIt, typename Compare>
+        RandomIt partition_left_base(RandomIt begin, RandomIt end, const Compare& comp)
+        {
+            auto pivot = std::move(*begin);
+            RandomIt first = begin;
+            RandomIt last = end;
+
+            while (comp(pivot, *--last));
+            if (last + 1 == end)
+                while (first < last && !comp(pivot, *++first));
+            else
+                while (!comp(pivot, *++first));
+
+            while (first < last)
+            {
+                std::iter_swap(first, last);
+                while (comp(pivot, *--last));
+                while (!comp(pivot, *++first));
+            }
+
+            RandomIt pivot_pos = last;
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return pivot_pos;
+        }
+
+        /**
+         * @brief 以*first为基准分区，与基准相等的元素放在右侧
+         * @return {基准的最终位置, 分区前区间是否已经分好（没有发生任何交换）}
+         * @note 调用方已用三数/九数取中把不小于基准的元素放在了末尾，内层扫描不会越界
+         */
+        template <typename RandomIt, typename Compare>
+        std::pair<RandomIt, bool> partition_right_base(RandomIt begin, RandomIt end, const Compare& comp)
+        {
+            auto pivot = std::move(*begin);
+            RandomIt first = begin;
+            RandomIt last = end;
+
+            while (comp(*++first, pivot));
+            if (first - 1 == begin)
+                while (first < last && !comp(*--last, pivot));
+            else
+                while (!comp(*--last, pivot));
+
+            const bool already_partitioned = first >= last;
+            while (first < last)
+            {
+                std::iter_swap(first, last);
+                while (comp(*++first, pivot));
+                while (!comp(*--last, pivot));
+            }
+
+            RandomIt pivot_pos = first - 1;
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        /**
+         * @brief 按偏移表交换左右两侧放错位置的元素
+         * @param use_swaps true-逐对交换，false-使用循环移动（每对元素少一次赋值，左右数量不等时才能使用）
+         */
+        template <typename RandomIt>
+        void swap_offsets_base(RandomIt first, RandomIt last,
+                               const unsigned char* offsets_l, const unsigned char* offsets_r,
+                               size_t num, bool use_swaps)
+        {
+            if (use_swaps)
+            {
+                // 左右数量相等时必须逐对交换，否则循环移动会把最后一个元素放错位置
+                for (size_t i = 0; i < num; ++i) std::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+            }
+            else if (num > 0)
+            {
+                RandomIt l = first + offsets_l[0];
+                RandomIt r = last - offsets_r[0];
+                auto tmp = std::move(*l);
+                *l = std::move(*r);
+                for (size_t i = 1; i < num; ++i)
+                {
+                    l = first + offsets_l[i];
+                    *r = std::move(*l);
+                    r = last - offsets_r[i];
+                    *l = std::move(*r);
+                }
+                *r = std::move(tmp);
+            }
+        }
+
+        /**
+         * @brief partition_right_base的无分支版本（BlockQuicksort块分区）
+         *
+         * 算法逻辑：
+         * 1. 左右两端各取一块（INTRO_BLOCK_SIZE个元素），只做比较，把放错位置的元素偏移写入偏移表；
+         *    写入位置由比较结果直接累加得到，没有依赖比较结果的条件分支，避免随机数据上的分支预测失败
+         * 2. 按偏移表成对交换左右两侧放错位置的元素，哪一侧的偏移表用完就再取一块
+         * 3. 剩余不足一块时按剩余长度处理，最后把残留的放错元素逐个换到分界处
+         */
+        template <typename RandomIt, typename Compare>
+        std::pair<RandomIt, bool> partition_right_branchless_base(RandomIt begin, RandomIt end, const Compare& comp)
+        {
+            auto pivot = std::move(*begin);
+            RandomIt first = begin;
+            RandomIt last = end;
+
+            while (comp(*++first, pivot));
+            if (first - 1 == begin)
+                while (first < last && !comp(*--last, pivot));
+            else
+                while (!comp(*--last, pivot));
+
+            const bool already_partitioned = first >= last;
+            if (!already_partitioned)
+            {
+                std::iter_swap(first, last);
+                ++first;
+
+                unsigned char offsets_l[INTRO_BLOCK_SIZE];
+                unsigned char offsets_r[INTRO_BLOCK_SIZE];
+                RandomIt offsets_l_base = first;
+                RandomIt offsets_r_base = last;
+                size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+                while (first < last)
+                {
+                    // 两侧偏移表都空时平分剩余元素，否则剩余元素全部分给偏移表为空的一侧
+                    const size_t num_unknown = static_cast<size_t>(last - first);
+                    const size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                    const size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+                    // 左侧：记录不小于基准（应去右侧）的元素偏移
+                    const size_t left_count = std::min(left_split, INTRO_BLOCK_SIZE);
+                    for (size_t i = 0; i < left_count; ++i)
+                    {
+                        offsets_l[num_l] = static_cast<unsigned char>(i);
+                        num_l += !comp(*first, pivot);
+                        ++first;
+                    }
+
+                    // 右侧：记录小于基准（应去左侧）的元素偏移，偏移从1开始，相对offsets_r_base向左计
+                    const size_t right_count = std::min(right_split, INTRO_BLOCK_SIZE);
+                    for (size_t i = 0; i < right_count;)
+                    {
+                        offsets_r[num_r] = static_cast<unsigned char>(++i);
+                        num_r += comp(*--last, pivot);
+                    }
+
+                    const size_t num = std::min(num_l, num_r);
+                    swap_offsets_base(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                                      num, num_l == num_r);
+                    num_l -= num;
+                    num_r -= num;
+                    start_l += num;
+                    start_r += num;
+
+                    if (num_l == 0)
+                    {
+                        start_l = 0;
+                        offsets_l_base = first;
+                    }
+                    if (num_r == 0)
+                    {
+                        start_r = 0;
+                        offsets_r_base = last;
+                    }
+                }
+
+                // 扫描结束后至多一侧还有放错的元素，逐个换到分界处
+                if (num_l)
+                {
+                    while (num_l--) std::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+                    first = last;
+                }
+                if (num_r)
+                {
+                    while (num_r--)
+                    {
+                        std::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+                        ++first;
+                    }
+                    last = first;
+                }
+            }
+
+            RandomIt pivot_pos = first - 1;
+            *begin = std::move(*pivot_pos);
+            *pivot_pos = std::move(pivot);
+            return {pivot_pos, already_partitioned};
+        }
+
+        /**
+         * @brief 选择基准并放到begin：大区间九数取中，小区间三数取中
+         * @note 同时保证末尾元素不小于基准，partition_right_base的内层扫描不会越界
+         */
+        template <typename RandomIt, typename Compare>
+        void intro_choose_pivot_base(RandomIt begin, RandomIt end, const Compare& comp)
+        {
+            const ptrdiff_t size = end - begin;
+            const ptrdiff_t s2 = size / 2;
+            if (size > INTRO_NINTHER_THRESHOLD)
+            {
+                sort3_base(begin, begin + s2, end - 1, comp);
+                sort3_base(begin + 1, begin + (s2 - 1), end - 2, comp);
+                sort3_base(begin + 2, begin + (s2 + 1), end - 3, comp);
+                sort3_base(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+                std::iter_swap(begin, begin + s2);
+            }
+            else
+            {
+                sort3_base(begin + s2, begin, end - 1, comp);
+            }
+        }
+
+        /**
+         * @brief 极不平衡的分区后打乱两侧部分元素，破坏导致不平衡的输入模式（如管风琴序列）
+         */
+        template <typename RandomIt>
+        void intro_break_patterns_base(RandomIt begin, RandomIt pivot_pos, RandomIt end)
+        {
+            const ptrdiff_t l_size = pivot_pos - begin;
+            const ptrdiff_t r_size = end - (pivot_pos + 1);
+            if (l_size >= INTRO_INSERTION_THRESHOLD)
+            {
+                std::iter_swap(begin, begin + l_size / 4);
+                std::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                if (l_size > INTRO_NINTHER_THRESHOLD)
+                {
+                    std::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                    std::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                    std::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                    std::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                }
+            }
+            if (r_size >= INTRO_INSERTION_THRESHOLD)
+            {
+                std::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                std::iter_swap(end - 1, end - r_size / 4);
+                if (r_size > INTRO_NINTHER_THRESHOLD)
+                {
+                    std::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                    std::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                    std::iter_swap(end - 2, end - (1 + r_size / 4));
+                    std::iter_swap(end - 3, end - (2 + r_size / 4));
+                }
+            }
+        }
+
+        /**
+         * @brief 内省排序主循环（pdqsort风格）
+         * @tparam Branchless 是否使用无分支分区
+         * @param bad_allowed 剩余允许的极不平衡分区次数，用完后改用堆排序，保证最坏O(n log n)
+         * @param leftmost 区间是否位于整个待排序区间的最左端（否则first之前的元素不大于区间内任何元素）
+         */
+        template <bool Branchless, typename RandomIt, typename Compare>
+        void intro_sort_loop_base(RandomIt begin, RandomIt end, const Compare& comp, int bad_allowed, bool leftmost)
+        {
+            while (true)
+            {
+                const ptrdiff_t size = end - begin;
+                if (size < INTRO_INSERTION_THRESHOLD)
+                {
+                    intro_insertion_sort_base(begin, end, comp, leftmost);
+                    return;
+                }
+
+                intro_choose_pivot_base(begin, end, comp);
+
+                // 基准与左侧相邻元素相等：本区间内没有比基准更小的元素，把与基准相等的元素一次分出，不再递归处理
+                if (!leftmost && !comp(*(begin - 1), *begin))
+                {
+                    begin = partition_left_base(begin, end, comp) + 1;
+                    continue;
+                }
+
+                std::pair<RandomIt, bool> part = Branchless ? partition_right_branchless_base(begin, end, comp)
+                                                            : partition_right_base(begin, end, comp);
+                RandomIt pivot_pos = part.first;
+                const ptrdiff_t l_size = pivot_pos - begin;
+                const ptrdiff_t r_size = end - (pivot_pos + 1);
+
+                if (l_size < size / 8 || r_size < size / 8)
+                {
+                    // 极不平衡的分区：次数用完时改用堆排序
+                    if (--bad_allowed == 0)
+                    {
+                        heap_sort_base(begin, end, comp);
+                        return;
+                    }
+
+                    intro_break_patterns_base(begin, pivot_pos, end);
+                }
+                else if (part.second && partial_insertion_sort_base(begin, pivot_pos, comp) &&
+                         partial_insertion_sort_base(pivot_pos + 1, end, comp))
+                {
+                    // 分区时没有发生交换且两侧都接近有序：已有序输入在线性时间内完成
+                    return;
+                }
+
+                // 递归处理较短的一侧，较长的一侧在本循环中继续（尾递归消除），递归深度不超过log2(n)
+                if (l_size < r_size)
+                {
+                    intro_sort_loop_base<Branchless>(begin, pivot_pos, comp, bad_allowed, leftmost);
+                    begin = pivot_pos + 1;
+                    leftmost = false;
+                }
+                else
+                {
+                    intro_sort_loop_base<Branchless>(pivot_pos + 1, end, comp, bad_allowed, false);
+                    end = pivot_pos;
+                }
+            }
+        }
+
+        /**
+         * @brief 内省排序入口
+         */
+        template <typename RandomIt, typename Compare>
+        void intro_sort_base(RandomIt first, RandomIt last, const Compare& comp)
+        {
+            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+            const ptrdiff_t n = last - first;
+            if (n <= 1) return;
+
+            // 允许的不平衡分区次数为log2(n)
+            int bad_allowed = 0;
+            for (ptrdiff_t m = n; m > 1; m >>= 1) ++bad_allowed;
+
+            intro_sort_loop_base<is_branchless_sortable<ValueType, Compare>::value>(first, last, comp, bad_allowed, true);
+        }
+        // -----------------------------------------------------------------------
+
+        // 部分排序与选择相关实现
+        // -----------------------------------------------------------------------
+        constexpr ptrdiff_t PARTIAL_SORT_HEAP_RATIO = 16; ///< k < n / 该值时部分排序使用堆选择，否则先选择再排序
+
+        /**
+         * @brief 堆选择：把[first, last)中按comp排在最前的middle - first个元素放入[first, middle)，
+         *        并组织成以comp为序的大顶堆（堆顶是其中最靠后的元素）
+         * @note 每个元素只与堆顶比较一次，k远小于n时绝大多数元素只需一次比较，时间复杂度O(n log k)
+         */
+        template <typename RandomIt, typename Compare>
+        void heap_select_base(RandomIt first, RandomIt middle, RandomIt last, const Compare& comp)
+        {
+            const size_t k = static_cast<size_t>(middle - first);
+            if (k == 0) return;
+
+            for (ptrdiff_t i = static_cast<ptrdiff_t>(k) / 2 - 1; i >= 0; --i)
+            {
+                heapify_base(first, k, static_cast<size_t>(i), comp);
+            }
+
+            for (RandomIt it = middle; it != last; ++it)
+            {
+                if (comp(*it, *first))
+                {
+                    std::iter_swap(it, first);
+                    heapify_base(first, k, 0, comp);
+                }
+            }
+        }
+
+        /**
+         * @brief 内省选择主循环：与intro_sort_loop_base相同的基准选择与分区，只进入包含nth的一侧
+         * @param bad_allowed 剩余允许的极不平衡分区次数，用完后改用堆选择，保证最坏O(n log n)
+         */
+        template <bool Branchless, typename RandomIt, typename Compare>
+        void nth_element_loop_base(RandomIt begin, RandomIt nth, RandomIt end, const Compare& comp, int bad_allowed)
+        {
+            bool leftmost = true;
+            while (true)
+            {
+                const ptrdiff_t size = end - begin;
+                if (size < INTRO_INSERTION_THRESHOLD)
+                {
+                    intro_insertion_sort_base(begin, end, comp, leftmost);
+                    return;
+                }
+
+                intro_choose_pivot_base(begin, end, comp);
+
+                // 基准与左侧相邻元素相等：与基准相等的元素一次分出，nth落在其中即已就位
+                if (!leftmost && !comp(*(begin - 1), *begin))
+                {
+                    begin = partition_left_base(begin, end, comp) + 1;
+                    if (nth < begin) return;
+                    continue;
+                }
+
+                std::pair<RandomIt, bool> part = Branchless ? partition_right_branchless_base(begin, end, comp)
+                                                            : partition_right_base(begin, end, comp);
+                RandomIt pivot_pos = part.first;
+                if (pivot_pos == nth) return;
+
+                const ptrdiff_t l_size = pivot_pos - begin;
+                const ptrdiff_t r_size = end - (pivot_pos + 1);
+                if (l_size < size / 8 || r_size < size / 8)
+                {
+                    if (--bad_allowed == 0)
+                    {
+                        // 堆顶即第nth个元素，其余较小的元素留在它前面
+                        RandomIt lo = nth < pivot_pos ? begin : pivot_pos + 1;
+                        RandomIt hi = nth < pivot_pos ? pivot_pos : end;
+                        heap_select_base(lo, nth + 1, hi, comp);
+                        std::iter_swap(lo, nth);
+                        return;
+                    }
+                    intro_break_patterns_base(begin, pivot_pos, end);
+                }
+
+                if (nth < pivot_pos)
+                {
+                    end = pivot_pos;
+                }
+                else
+                {
+                    begin = pivot_pos + 1;
+                    leftmost = false;
+                }
+            }
+        }
+
+        /**
+         * @brief 内省选择入口：重排后nth处是排序后应在该位置的元素，其前不大于它，其后不小于它
+         */
+        template <typename RandomIt, typename Compare>
+        void nth_element_base(RandomIt first, RandomIt nth, RandomIt last, const Compare& comp)
+        {
+            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+            const ptrdiff_t n = last - first;
+            if (n <= 1 || nth == last) return;
+
+            int bad_allowed = 0;
+            for (ptrdiff_t m = n; m > 1; m >>= 1) ++bad_allowed;
+
+            nth_element_loop_base<is_branchless_sortable<ValueType, Compare>::value>(first, nth, last, comp, bad_allowed);
+        }
+
+        /**
+         * @brief 部分排序入口：[first, middle)为整个区间中按comp排在最前的元素且有序，其余元素顺序不确定
+         * @note k较小时用堆选择加堆排序（O(n log k)），否则先内省选择再对前k个内省排序（平均O(n + k log k)）
+         */
+        template <typename RandomIt, typename Compare>
+        void partial_sort_base(RandomIt first, RandomIt middle, RandomIt last, const Compare& comp)
+        {
+            const ptrdiff_t k = middle - first;
+            const ptrdiff_t n = last - first;
+            if (k <= 0) return;
+            if (k >= n)
+            {
+                intro_sort_base(first, last, comp);
+                return;
+            }
+
+            if (k < n / PARTIAL_SORT_HEAP_RATIO)
+            {
+                heap_select_base(first, middle, last, comp);
+                for (ptrdiff_t i = k - 1; i > 0; --i)
+                {
+                    std::iter_swap(first, first + i);
+                    heapify_base(first, static_cast<size_t>(i), 0, comp);
+                }
+            }
+            else
+            {
+                nth_element_base(first, middle - 1, last, comp);
+                intro_sort_base(first, middle - 1, comp);
+            }
+        }
+        // -----------------------------------------------------------------------
+
+        // 桶排序相关实现
+        // -----------------------------------------------------------------------
+        /**
+         * @brief 桶排序公共实现：扁平存储，所有桶共用一块缓冲区
+         *
+         * 算法逻辑：
+         * 1. 第一遍统计每个桶的元素个数，前缀和得到各桶在缓冲区中的起始位置
+         * 2. 第二遍把元素分发到缓冲区中对应桶的位置（稳定）
+         * 3. 写回原区间后，对每个桶内元素使用自定义比较器进行插入排序
+         *
+         * @param offsets 桶偏移数组（调用方提供，结束时offsets[b]为第b个桶的结束位置）
+         * @param buffer 分发用缓冲区（调用方提供）
+         * @param bucket_of 计算元素所在桶的函数，返回值必须小于num_buckets
+         * @note 缓冲区容量足够时不做任何堆分配，重复排序时可复用同一组缓冲区
+         * @note buffer按元素个数resize后按下标分发，T需可默认构造（桶排序只接受整数/浮点数元素，总是满足）
+         */
+        template <typename RandomIt, typename T, typename BucketFn, typename Compare>
+        void bucket_sort_flat_base(RandomIt first, RandomIt last, size_t num_buckets,
+                                   std::vector<size_t>& offsets, std::vector<T>& buffer,
+                                   const BucketFn& bucket_of, const Compare& comp)
+        {
+            const size_t n = static_cast<size_t>(last - first);
+
+            offsets.assign(num_buckets + 1, 0);
+            for (RandomIt it = first; it != last; ++it) ++offsets[bucket_of(*it) + 1];
+            for (size_t b = 1; b <= num_buckets; ++b) offsets[b] += offsets[b - 1];
+
+            buffer.resize(n);
+            for (RandomIt it = first; it != last; ++it) buffer[offsets[bucket_of(*it)]++] = *it;
+            std::copy(buffer.begin(), buffer.end(), first);
+
+            // 分发后offsets[b]是第b个桶的结束位置、第b+1个桶的起始位置
+            size_t begin = 0;
+            for (size_t b = 0; b < num_buckets; ++b)
+            {
+                insertion_sort_base(first + begin, first + offsets[b], comp);
+                begin = offsets[b];
+            }
+        }
+
+        /**
+         * @brief 桶排序核心实现（适用于浮点数）
+         *
+         * 算法逻辑：
+         * 1. 根据数值范围划分桶（桶的划分基于数值大小，与比较器无关，降序比较器按相反的顺序编号桶），超出[min_val, max_val)的元素归入首/末桶
+         * 2. 将元素分配到对应桶中
+         * 3. 对每个桶内元素使用自定义比较器进行排序
+         * 4. 合并所有桶的结果
+         */
+        template <typename RandomIt, typename T, typename Compare>
+        void bucket_sort_float_base(RandomIt first, RandomIt last,
+                                    size_t num_buckets,
+                                    double min_val, double max_val,
+                                    std::vector<size_t>& offsets, std::vector<T>& buffer,
+                                    const Compare& comp)
+        {
+            if (last - first <= 1) return;
+
+            // 比较器为降序时按相反的顺序编号桶，桶之间的顺序与比较器一致
+            const bool descending = comp(static_cast<T>(max_val), static_cast<T>(min_val));
+            const double range = max_val - min_val;
+            auto bucket_of = [=](const T& value)
+            {
+                const double pos = ((value - min_val) / range) * num_buckets;
+                size_t idx = 0;
+                if (pos > 0) idx = static_cast<size_t>(pos);
+                if (idx >= num_buckets) idx = num_buckets - 1;
+                return descending ? num_buckets - 1 - idx : idx;
+            };
+            bucket_sort_flat_base(first, last, num_buckets, offsets, buffer, bucket_of, comp);
+        }
+
+        template <typename RandomIt, typename Compare>
+        void bucket_sort_float_base(RandomIt first, RandomIt last,
+                                    size_t num_buckets,
+                                    double min_val, double max_val,
+                                    const Compare& comp)
+        {
+            std::vector<size_t> offsets;
+            std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer;
+            bucket_sort_float_base(first, last, num_buckets, min_val, max_val, offsets, buffer, comp);
         }
 
         /**
          * @brief 桶排序核心实现（适用于整数）
          *
          * 与浮点数版本的区别：
-         * - 自动计算数据范围（无需手动指定min_val和max_val）
-         * - 使用比较器确定最值和桶内排序规则
+         * - 自动计算数据范围（无需手动指定min_val和max_val），范围按数值计算，与比较器无关
+         * - 使用比较器确定桶之间的顺序（升序/降序）和桶内排序规则
          */
-        template <typename RandomIt, typename Compare>
+        template <typename RandomIt, typename T, typename Compare>
         void bucket_sort_int_base(RandomIt first, RandomIt last,
                                   size_t num_buckets,
+                                  std::vector<size_t>& offsets, std::vector<T>& buffer,
                                   const Compare& comp)
         {
-            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
-            const ptrdiff_t n = std::distance(first, last);
-            if (n <= 1) return;
+            if (last - first <= 1) return;
 
-            // 使用比较器计算数据范围（找最值）
-            ValueType min_val = *first, max_val = *first;
+            // 按数值计算数据范围（与比较器无关，否则降序比较器会得到负的范围，所有元素落入同一个桶）
+            T min_val = *first, max_val = *first;
             for (RandomIt it = std::next(first); it != last; ++it)
             {
-                if (comp(*it, min_val)) min_val = *it;
-                if (comp(max_val, *it)) max_val = *it;
+                if (*it < min_val) min_val = *it;
+                if (max_val < *it) max_val = *it;
             }
 
-            // 创建桶并分配元素
-            std::vector<std::vector<ValueType>> buckets(num_buckets);
-            const ValueType range = max_val - min_val + 1;                         // +1 避免除零
-            const ValueType bucket_size = (range + num_buckets - 1) / num_buckets; // 向上取整
-
-            for (RandomIt it = first; it != last; ++it)
+            // 比较器为降序时按相反的顺序编号桶，桶之间的顺序与比较器一致
+            const bool descending = comp(max_val, min_val);
+            const T range = max_val - min_val + 1;                         // +1 避免除零
+            const T bucket_size = (range + num_buckets - 1) / num_buckets; // 向上取整
+            auto bucket_of = [=](const T& value)
             {
-                size_t idx = static_cast<size_t>((*it - min_val) / bucket_size);
+                size_t idx = static_cast<size_t>((value - min_val) / bucket_size);
                 if (idx >= num_buckets) idx = num_buckets - 1;
-                buckets[idx].push_back(*it);
+                return descending ? num_buckets - 1 - idx : idx;
+            };
+            bucket_sort_flat_base(first, last, num_buckets, offsets, buffer, bucket_of, comp);
+        }
+
+        template <typename RandomIt, typename Compare>
+        void bucket_sort_int_base(RandomIt first, RandomIt last,
+                                  size_t num_buckets,
+                                  const Compare& comp)
+        {
+            std::vector<size_t> offsets;
+            std::vector<typename std::iterator_traits<RandomIt>::value_type> buffer;
+            bucket_sort_int_base(first, last, num_buckets, offsets, buffer, comp);
+        }
+        // -----------------------------------------------------------------------
+
+        // 并行排序相关实现
+        // -----------------------------------------------------------------------
+        /// 并行排序中不再拆分任务的最小区间长度，更小的区间直接串行处理。
+        constexpr ptrdiff_t PARALLEL_SORT_CUTOFF = 8192;
+
+        /**
+         * @brief 计算并行排序使用的线程数
+         * @param thread_num 用户指定的线程数，0表示使用硬件并发数
+         * @param n 待排序元素数量
+         * @return 实际使用的线程数（至少为1，且保证每个线程至少分到PARALLEL_SORT_CUTOFF个元素）
+         */
+        inline size_t parallel_sort_threads(size_t thread_num, ptrdiff_t n)
+        {
+            if (thread_num == 0) thread_num = std::thread::hardware_concurrency();
+            const size_t limit = static_cast<size_t>(n / PARALLEL_SORT_CUTOFF);
+            return std::max<size_t>(1, std::min(thread_num, limit));
+        }
+
+        /**
+         * @brief 并行执行两个任务并等待二者完成
+         * @param depth 剩余可分叉层数，为0时两个任务在当前线程上依次执行
+         * @param left 在新线程上执行的任务
+         * @param right 在当前线程上执行的任务
+         * @note 任一任务抛出的异常会在两个任务都结束后重新抛出
+         */
+        template <typename Left, typename Right>
+        void parallel_invoke_base(int depth, const Left& left, const Right& right)
+        {
+            if (depth <= 0)
+            {
+                left();
+                right();
+                return;
             }
 
-            // 桶内排序：使用自定义比较器
-            for (auto& bucket : buckets)
-                insertion_sort_base(bucket.begin(), bucket.end(), comp);
+            std::future<void> fut = std::async(std::launch::async, [&left]()
+                                               { left(); });
+            try
+            {
+                right();
+            }
+            catch (...)
+            {
+                fut.wait();
+                throw;
+            }
+            fut.get();
+        }
 
-            // 合并所有桶的结果
-            auto dest_it = first;
-            for (const auto& bucket : buckets)
-                dest_it = std::copy(bucket.begin(), bucket.end(), dest_it);
+        /**
+         * @brief 启动count个线程（含当前线程）并行执行func(0)...func(count-1)，等待全部完成
+         * @note 第一个异常在所有线程结束后重新抛出
+         */
+        template <typename Func>
+        void parallel_blocks_base(size_t count, const Func& func)
+        {
+            std::vector<std::future<void>> futs;
+            futs.reserve(count);
+            for (size_t i = 1; i < count; ++i)
+                futs.push_back(std::async(std::launch::async, [&func, i]()
+                                          { func(i); }));
+
+            std::exception_ptr error;
+            try
+            {
+                func(0);
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+            for (auto& fut : futs)
+            {
+                try
+                {
+                    fut.get();
+                }
+                catch (...)
+                {
+                    if (!error) error = std::current_exception();
+                }
+            }
+            if (error) std::rethrow_exception(error);
+        }
+
+        /**
+         * @brief 并行稳定合并两个有序区间到输出区间（元素被移动）
+         *
+         * 算法逻辑：
+         * 1. 取较长区间的中点元素x，在另一区间中二分查找x的插入位置
+         * 2. x左侧的两段与右侧的两段分别构成独立的子合并，写入输出区间的不相交部分
+         * 3. 两个子合并并行执行，递归直到分叉层数用尽或区间足够小后串行合并
+         *
+         * 稳定性：相等元素中第一个区间的元素总排在前面。拆分第一个区间时在第二个区间用lower_bound，
+         * 拆分第二个区间时在第一个区间用upper_bound，保证相等元素不会跨越拆分点交换顺序。
+         */
+        template <typename It1, typename It2, typename OutIt, typename Compare>
+        void parallel_merge_base(It1 first1, It1 last1, It2 first2, It2 last2,
+                                 OutIt out, int depth, const Compare& comp)
+        {
+            const ptrdiff_t n1 = last1 - first1;
+            const ptrdiff_t n2 = last2 - first2;
+            if (depth <= 0 || n1 + n2 <= PARALLEL_SORT_CUTOFF)
+            {
+                std::merge(std::make_move_iterator(first1), std::make_move_iterator(last1),
+                           std::make_move_iterator(first2), std::make_move_iterator(last2),
+                           out, comp);
+                return;
+            }
+
+            It1 mid1;
+            It2 mid2;
+            if (n1 >= n2)
+            {
+                mid1 = first1 + n1 / 2;
+                mid2 = std::lower_bound(first2, last2, *mid1, comp);
+            }
+            else
+            {
+                mid2 = first2 + n2 / 2;
+                mid1 = std::upper_bound(first1, last1, *mid2, comp);
+            }
+            OutIt out_mid = out + ((mid1 - first1) + (mid2 - first2));
+
+            parallel_invoke_base(
+                depth,
+                [&]()
+                { parallel_merge_base(first1, mid1, first2, mid2, out, depth - 1, comp); },
+                [&]()
+                { parallel_merge_base(mid1, last1, mid2, last2, out_mid, depth - 1, comp); });
+        }
+
+        /**
+         * @brief 并行归并排序递归实现（两块缓冲区交替使用，避免每层都拷贝回原区间）
+         * @param first 数据区间起始
+         * @param last 数据区间结束
+         * @param buf 与数据区间等长的缓冲区起始
+         * @param to_buf true-结果写入缓冲区，false-结果留在数据区间
+         * @param depth 剩余可分叉层数
+         * @param comp 比较函数对象
+         */
+        template <typename RandomIt, typename BufIt, typename Compare>
+        void parallel_merge_sort_base(RandomIt first, RandomIt last, BufIt buf,
+                                      bool to_buf, int depth, const Compare& comp)
+        {
+            const ptrdiff_t n = last - first;
+            if (depth <= 0 || n <= PARALLEL_SORT_CUTOFF)
+            {
+                std::stable_sort(first, last, comp);
+                if (to_buf) std::move(first, last, buf);
+                return;
+            }
+
+            const ptrdiff_t half = n / 2;
+            RandomIt mid = first + half;
+            BufIt buf_mid = buf + half;
+
+            // 子区间的结果写到与本层目标相反的一侧，本层再合并回目标一侧
+            parallel_invoke_base(
+                depth,
+                [&]()
+                { parallel_merge_sort_base(first, mid, buf, !to_buf, depth - 1, comp); },
+                [&]()
+                { parallel_merge_sort_base(mid, last, buf_mid, !to_buf, depth - 1, comp); });
+
+            if (to_buf)
+                parallel_merge_base(first, mid, mid, last, buf, depth, comp);
+            else
+                parallel_merge_base(buf, buf_mid, buf_mid, buf + n, first, depth, comp);
+        }
+
+        /**
+         * @brief 并行归并排序入口
+         * @param thread_num 线程数，0表示使用硬件并发数
+         */
+        template <typename RandomIt, typename Compare>
+        void parallel_merge_sort(RandomIt first, RandomIt last, const Compare& comp, size_t thread_num)
+        {
+            const ptrdiff_t n = last - first;
+            if (n <= 1) return;
+
+            const size_t threads = parallel_sort_threads(thread_num, n);
+            if (threads <= 1)
+            {
+                std::stable_sort(first, last, comp);
+                return;
+            }
+
+            // 分叉层数取ceil(log2(threads))，叶子数不少于线程数
+            int depth = 0;
+            while ((static_cast<size_t>(1) << depth) < threads) ++depth;
+
+            std::vector<typename std::iterator_traits<RandomIt>::value_type> temp(n);
+            parallel_merge_sort_base(first, last, temp.begin(), false, depth, comp);
+        }
+
+        /**
+         * @brief 并行样本排序入口
+         *
+         * 算法逻辑：
+         * 1. 等距抽取threads*SAMPLE_OVERSAMPLING个样本并排序，从中等距选出threads-1个分隔元素
+         * 2. 每个线程负责一段连续输入，用二分查找确定每个元素所属的桶，并统计各桶元素数
+         * 3. 按"桶优先、输入段次之"的顺序计算前缀和，每个线程把自己的元素移动到缓冲区中对应桶的位置
+         * 4. 各线程领取桶，在缓冲区中排序后移动回原区间
+         *
+         * 与分隔元素相等的元素全部落入同一个桶，大量重复值会使该桶偏大，但不影响正确性。
+         * @param thread_num 线程数，0表示使用硬件并发数
+         */
+        template <typename RandomIt, typename Compare>
+        void parallel_sample_sort(RandomIt first, RandomIt last, const Compare& comp, size_t thread_num)
+        {
+            using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+            constexpr size_t SAMPLE_OVERSAMPLING = 32;
+
+            const ptrdiff_t n = last - first;
+            if (n <= 1) return;
+
+            const size_t threads = parallel_sort_threads(thread_num, n);
+            if (threads <= 1)
+            {
+                intro_sort_base(first, last, comp);
+                return;
+            }
+
+            // 1. 抽样并选出分隔元素
+            const size_t sample_num = threads * SAMPLE_OVERSAMPLING;
+            std::vector<ValueType> samples;
+            samples.reserve(sample_num);
+            for (size_t i = 0; i < sample_num; ++i)
+                samples.push_back(first[static_cast<ptrdiff_t>(i * static_cast<size_t>(n) / sample_num)]);
+            intro_sort_base(samples.begin(), samples.end(), comp);
+
+            const size_t bucket_num = threads;
+            std::vector<ValueType> splitters;
+            splitters.reserve(bucket_num - 1);
+            for (size_t i = 1; i < bucket_num; ++i)
+                splitters.push_back(std::move(samples[i * SAMPLE_OVERSAMPLING]));
+
+            auto block_begin = [n, threads](size_t b)
+            { return static_cast<ptrdiff_t>(b * static_cast<size_t>(n) / threads); };
+
+            // 2. 分类并计数：counts[b * bucket_num + k]为第b段输入中属于第k个桶的元素数
+            std::vector<uint32_t> bucket_of(static_cast<size_t>(n));
+            std::vector<size_t> counts(threads * bucket_num, 0);
+            parallel_blocks_base(threads, [&](size_t b)
+                                 {
+                size_t* count = &counts[b * bucket_num];
+                for (ptrdiff_t i = block_begin(b); i < block_begin(b + 1); ++i)
+                {
+                    const auto k = static_cast<uint32_t>(
+                        std::upper_bound(splitters.begin(), splitters.end(), first[i], comp) - splitters.begin());
+                    bucket_of[static_cast<size_t>(i)] = k;
+                    ++count[k];
+                } });
+
+            // 3. 计算各(输入段, 桶)在缓冲区中的写入位置，并行分发
+            std::vector<size_t> offsets(threads * bucket_num);
+            std::vector<size_t> bucket_begin(bucket_num + 1);
+            size_t pos = 0;
+            for (size_t k = 0; k < bucket_num; ++k)
+            {
+                bucket_begin[k] = pos;
+                for (size_t b = 0; b < threads; ++b)
+                {
+                    offsets[b * bucket_num + k] = pos;
+                    pos += counts[b * bucket_num + k];
+                }
+            }
+            bucket_begin[bucket_num] = pos;
+
+            std::vector<ValueType> temp(static_cast<size_t>(n));
+            parallel_blocks_base(threads, [&](size_t b)
+                                 {
+                size_t* offset = &offsets[b * bucket_num];
+                for (ptrdiff_t i = block_begin(b); i < block_begin(b + 1); ++i)
+                    temp[offset[bucket_of[static_cast<size_t>(i)]]++] = std::move(first[i]); });
+
+            // 4. 各线程领取桶排序后移回原区间（桶大小可能不均，按需领取以平衡负载）
+            std::atomic<size_t> next_bucket{0};
+            parallel_blocks_base(threads, [&](size_t)
+                                 {
+                for (size_t k = next_bucket++; k < bucket_num; k = next_bucket++)
+                {
+                    auto bucket_first = temp.begin() + static_cast<ptrdiff_t>(bucket_begin[k]);
+                    auto bucket_last = temp.begin() + static_cast<ptrdiff_t>(bucket_begin[k + 1]);
+                    intro_sort_base(bucket_first, bucket_last, comp);
+                    std::move(bucket_first, bucket_last, first + static_cast<ptrdiff_t>(bucket_begin[k]));
+                } });
         }
         // -----------------------------------------------------------------------
 
@@ -0,0 +1,430 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_coroutine.h
+ * 功能描述：基于C++20协程的协作式任务，挂起点在ol::ThreadPool的工作线程上恢复，特性包括：
+ *          - CoTask<T>：惰性启动的协程任务，co_await时才开始执行，完成后对称转移回等待方，异常原样传播
+ *          - spawn()：把协程任务投递到线程池执行，返回ol::Future<T>，与C++17的Future/then接口无缝衔接
+ *          - schedule()：co_await后协程在线程池工作线程上继续执行
+ *          - sleepFor()：基于ThreadPool::scheduleAfter的定时等待，挂起期间不占用任何工作线程
+ *          - co_await ol::Future<T>：在完成Future的线程（如线程池工作线程）上恢复
+ *          - 延续被线程池丢弃（已停止或队列满）时，协程在丢弃它的线程上恢复，co_await处抛出std::runtime_error，
+ *            不会永久挂起泄漏
+ *          - 等待EventLoop上fd就绪的可等待对象见ol_net/ol_FdAwaiter.h
+ * 作者：ol
+ * 适用标准：C++20及以上（需编译器支持协程，CMake中开启OL_ENABLE_COROUTINES）；
+ *          C++17下本头文件为空，原有接口不受影响
+ */
+/****************************************************************************************/
+
+#ifndef OL_COROUTINE_H
+#define OL_COROUTINE_H 1
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define OL_COROUTINE_ENABLED 1
+#endif
+
+#ifdef OL_COROUTINE_ENABLED
+
+#include "ol_Future.h"
+#include "ol_Task.h"
+#include "ol_ThreadPool.h"
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ol
+{
+    template <typename T = void>
+    class CoTask;
+
+    namespace base
+    {
+        /**
+         * @brief 一次性协程恢复器，作为任务投递给线程池或执行器
+         * @note 被调用时在当前线程恢复协程；未被调用就销毁（任务被丢弃）时先标记dropped，再在销毁它的线程上恢复，
+         *       由可等待对象的await_resume抛出异常，保证挂起的协程总能继续
+         */
+        class CoResumer
+        {
+        private:
+            std::coroutine_handle<> m_handle; ///< 待恢复的协程
+            bool* m_dropped;                  ///< 任务被丢弃的标记（位于可等待对象中）
+
+        public:
+            CoResumer(std::coroutine_handle<> handle, bool* dropped) noexcept : m_handle(handle), m_dropped(dropped) {}
+
+            CoResumer(CoResumer&& other) noexcept
+                : m_handle(std::exchange(other.m_handle, nullptr)), m_dropped(other.m_dropped) {}
+
+            CoResumer(const CoResumer&) = delete;
+            CoResumer& operator=(const CoResumer&) = delete;
+            CoResumer& operator=(CoResumer&&) = delete;
+
+            ~CoResumer()
+            {
+                if (m_handle)
+                {
+                    *m_dropped = true;
+                    std::exchange(m_handle, nullptr).resume();
+                }
+            }
+
+            void operator()()
+            {
+                if (m_handle) std::exchange(m_handle, nullptr).resume();
+            }
+        };
+
+        /**
+         * @brief CoTask的promise公共部分：保存等待方和异常
+         */
+        class CoPromiseBase
+        {
+        private:
+            // 最终挂起：对称转移到等待方，无等待方时返回noop
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    std::coroutine_handle<> continuation = handle.promise().m_continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+        protected:
+            std::coroutine_handle<> m_continuation; ///< 等待本任务的协程
+            std::exception_ptr m_exception;         ///< 协程体抛出的异常
+
+        public:
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+            void unhandled_exception() noexcept { m_exception = std::current_exception(); }
+            void setContinuation(std::coroutine_handle<> continuation) noexcept { m_continuation = continuation; }
+
+            void rethrowIfFailed()
+            {
+                if (m_exception) std::rethrow_exception(m_exception);
+            }
+        };
+
+        template <typename T>
+        class CoPromise : public CoPromiseBase
+        {
+        private:
+            std::optional<T> m_value; ///< 协程返回值
+
+        public:
+            CoTask<T> get_return_object() noexcept;
+
+            template <typename U = T, typename = std::enable_if_t<std::is_convertible_v<U&&, T>>>
+            void return_value(U&& value) { m_value.emplace(std::forward<U>(value)); }
+
+            T result()
+            {
+                rethrowIfFailed();
+                return std::move(*m_value);
+            }
+        };
+
+        template <>
+        class CoPromise<void> : public CoPromiseBase
+        {
+        public:
+            CoTask<void> get_return_object() noexcept;
+            void return_void() noexcept {}
+            void result() { rethrowIfFailed(); }
+        };
+
+        /**
+         * @brief 即发即弃的协程（spawn内部使用）：立即开始执行，结束时自动销毁协程帧
+         */
+        struct CoDetached
+        {
+            struct promise_type
+            {
+                CoDetached get_return_object() noexcept { return {}; }
+                std::suspend_never initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() noexcept {}
+                void unhandled_exception() noexcept { std::terminate(); }
+            };
+        };
+
+        [[noreturn]] inline void throwDropped()
+        {
+            throw std::runtime_error("[ol::ThreadPool] Task submission failed");
+        }
+    } // namespace base
+
+    /**
+     * @brief 惰性启动的协程任务
+     * @tparam T 返回值类型（可为void）
+     * @note 只可移动；被co_await时才开始执行，完成后在完成它的线程上直接恢复等待方（对称转移，不额外投递）
+     * @note 协程体抛出的异常在co_await处重新抛出
+     * @example ol::CoTask<int> add(ol::ThreadPool<>& pool, int a, int b) { co_await ol::schedule(pool); co_return a + b; }
+     */
+    template <typename T>
+    class CoTask
+    {
+    public:
+        using promise_type = base::CoPromise<T>;
+
+    private:
+        std::coroutine_handle<promise_type> m_handle; ///< 协程句柄（拥有协程帧）
+
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() const noexcept { return !handle || handle.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                handle.promise().setContinuation(continuation);
+                return handle;
+            }
+
+            T await_resume()
+            {
+                if (!handle) throw std::logic_error("[ol::CoTask] Awaiting an empty task");
+                return handle.promise().result();
+            }
+        };
+
+    public:
+        CoTask() noexcept = default;
+        explicit CoTask(std::coroutine_handle<promise_type> handle) noexcept : m_handle(handle) {}
+
+        CoTask(CoTask&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+
+        CoTask& operator=(CoTask&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_handle) m_handle.destroy();
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        CoTask(const CoTask&) = delete;
+        CoTask& operator=(const CoTask&) = delete;
+
+        ~CoTask()
+        {
+            if (m_handle) m_handle.destroy();
+        }
+
+        /**
+         * @brief 判断是否关联了协程
+         */
+        bool valid() const noexcept { return static_cast<bool>(m_handle); }
+
+        /**
+         * @brief 判断协程是否已执行完毕
+         */
+        bool isDone() const noexcept { return m_handle && m_handle.done(); }
+
+        Awaiter operator co_await() const& noexcept { return Awaiter{m_handle}; }
+        Awaiter operator co_await() const&& noexcept { return Awaiter{m_handle}; }
+    };
+
+    namespace base
+    {
+        template <typename T>
+        CoTask<T> CoPromise<T>::get_return_object() noexcept
+        {
+            return CoTask<T>(std::coroutine_handle<CoPromise<T>>::from_promise(*this));
+        }
+
+        inline CoTask<void> CoPromise<void>::get_return_object() noexcept
+        {
+            return CoTask<void>(std::coroutine_handle<CoPromise<void>>::from_promise(*this));
+        }
+
+        /**
+         * @brief 切换到线程池工作线程的可等待对象
+         */
+        template <bool IsDynamic>
+        class ScheduleAwaiter
+        {
+        private:
+            ThreadPool<IsDynamic>& m_pool; ///< 目标线程池
+            TaskPriority m_priority;       ///< 投递优先级
+            bool m_dropped;                ///< 延续是否被线程池丢弃
+
+        public:
+            ScheduleAwaiter(ThreadPool<IsDynamic>& pool, TaskPriority priority) noexcept
+                : m_pool(pool), m_priority(priority), m_dropped(false) {}
+
+            bool await_ready() const noexcept { return false; }
+
+            // 投递后不再访问this：工作线程可能在addTask返回前就已恢复协程并销毁本对象
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                m_pool.addTask([resumer = CoResumer(handle, &m_dropped)]() mutable
+                               { resumer(); },
+                               m_priority);
+            }
+
+            void await_resume() const
+            {
+                if (m_dropped) throwDropped();
+            }
+        };
+
+        /**
+         * @brief 定时等待的可等待对象（到期后在线程池工作线程上恢复）
+         */
+        template <bool IsDynamic>
+        class SleepAwaiter
+        {
+        private:
+            ThreadPool<IsDynamic>& m_pool;               ///< 负责定时和恢复的线程池
+            std::chrono::steady_clock::duration m_delay; ///< 等待时长
+            TaskPriority m_priority;                     ///< 到期投递优先级
+            bool m_dropped;                              ///< 延续是否被线程池丢弃
+
+        public:
+            SleepAwaiter(ThreadPool<IsDynamic>& pool, std::chrono::steady_clock::duration delay, TaskPriority priority) noexcept
+                : m_pool(pool), m_delay(delay), m_priority(priority), m_dropped(false) {}
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                m_pool.scheduleAfter(m_delay, [resumer = CoResumer(handle, &m_dropped)]() mutable
+                                     { resumer(); },
+                                     m_priority);
+            }
+
+            void await_resume() const
+            {
+                if (m_dropped) throwDropped();
+            }
+        };
+
+        /**
+         * @brief 等待ol::Future完成的可等待对象
+         */
+        template <typename T>
+        class FutureAwaiter
+        {
+        private:
+            Future<T> m_future; ///< 被等待的Future（co_await后被消费）
+
+        public:
+            explicit FutureAwaiter(Future<T>&& future) noexcept : m_future(std::move(future)) {}
+
+            bool await_ready() const { return !m_future.valid() || m_future.isReady(); }
+
+            // 已在await_ready之后完成时onReady会在当前线程直接恢复，同样正确
+            void await_suspend(std::coroutine_handle<> handle)
+            {
+                FutureAccess::state(m_future)->onReady([handle]()
+                                                       { handle.resume(); });
+            }
+
+            T await_resume()
+            {
+                if (!m_future.valid()) throw std::future_error(std::future_errc::no_state);
+                return m_future.get();
+            }
+        };
+
+        template <bool IsDynamic, typename T>
+        CoDetached spawnDetached(ThreadPool<IsDynamic>& pool, CoTask<T> task, Promise<T> promise)
+        {
+            try
+            {
+                co_await ScheduleAwaiter<IsDynamic>(pool, TaskPriority::kNormal);
+                if constexpr (std::is_void_v<T>)
+                {
+                    co_await task;
+                    promise.setValue();
+                }
+                else
+                {
+                    promise.setValue(co_await task);
+                }
+            }
+            catch (...)
+            {
+                promise.setException(std::current_exception());
+            }
+        }
+    } // namespace base
+
+    /**
+     * @brief 切换到线程池工作线程继续执行
+     * @param pool 目标线程池
+     * @param priority 投递优先级（默认普通优先级）
+     * @return 可等待对象，co_await后协程在工作线程上恢复
+     * @throw std::runtime_error（在co_await处）线程池拒绝任务时抛出，此时协程仍在原线程上
+     */
+    template <bool IsDynamic>
+    base::ScheduleAwaiter<IsDynamic> schedule(ThreadPool<IsDynamic>& pool, TaskPriority priority = TaskPriority::kNormal)
+    {
+        return base::ScheduleAwaiter<IsDynamic>(pool, priority);
+    }
+
+    /**
+     * @brief 挂起协程一段时间，到期后在线程池工作线程上恢复
+     * @param pool 负责定时的线程池（挂起期间不占用工作线程）
+     * @param delay 等待时长（<=0时尽快恢复）
+     * @param priority 到期后的投递优先级（默认普通优先级）
+     * @throw std::runtime_error（在co_await处）线程池已停止或到期时拒绝任务
+     */
+    template <bool IsDynamic, typename Rep, typename Period>
+    base::SleepAwaiter<IsDynamic> sleepFor(ThreadPool<IsDynamic>& pool, std::chrono::duration<Rep, Period> delay,
+                                           TaskPriority priority = TaskPriority::kNormal)
+    {
+        return base::SleepAwaiter<IsDynamic>(pool, std::chrono::duration_cast<std::chrono::steady_clock::duration>(delay), priority);
+    }
+
+    /**
+     * @brief 等待ol::Future完成：co_await future（Future被消费）
+     * @return 可等待对象，在完成Future的线程上恢复，结果或异常在co_await处返回/抛出
+     */
+    template <typename T>
+    base::FutureAwaiter<T> operator co_await(Future<T>&& future) noexcept
+    {
+        return base::FutureAwaiter<T>(std::move(future));
+    }
+
+    template <typename T>
+    base::FutureAwaiter<T> operator co_await(Future<T>& future) noexcept
+    {
+        return base::FutureAwaiter<T>(std::move(future));
+    }
+
+    /**
+     * @brief 在线程池上启动协程任务
+     * @param pool 执行协程的线程池（协程首先切换到其工作线程上开始执行）
+     * @param task 协程任务
+     * @return 协程结果的Future，then()延续默认投递回该线程池；线程池拒绝任务时得到std::runtime_error
+     * @note 非协程代码可通过返回的Future等待结果，协程内部挂起时不占用工作线程
+     */
+    template <bool IsDynamic, typename T>
+    Future<T> spawn(ThreadPool<IsDynamic>& pool, CoTask<T> task)
+    {
+        Promise<T> promise(pool.executor());
+        Future<T> future = promise.getFuture();
+        base::spawnDetached(pool, std::move(task), std::move(promise));
+        return future;
+    }
+
+} // namespace ol
+
+#endif // OL_COROUTINE_ENABLED
+
+#endif // !OL_COROUTINE_H
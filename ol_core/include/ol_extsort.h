@@ -0,0 +1,517 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_extsort.h
+ * 功能描述：外部排序（外存排序），对超出内存容量的文本文件按行排序，特性包括：
+ *          - 顺串生成：按内存上限分批读入行，批内排序后写成有序的临时顺串文件
+ *          - 可选并行：传入ThreadPool时，批内排序和顺串写出在线程池中进行，调用线程同时读取下一批
+ *          - 多路归并：败者树（loser tree）k路归并，每次取出最小行只需log2(k)次比较；
+ *            顺串超过单趟归并路数上限时分多趟归并
+ *          - 大块顺序IO：基于cifile/cofile按块读写，行切分在内存中完成，避免逐行系统调用
+ *          - 按字段排序：FieldKey按ccmdstr的方式拆分行并提取一个或多个字段作为排序键，支持按数值比较
+ *          - 稳定排序：键相等的行保持在输入文件中的先后顺序
+ *          - 输出先写临时文件，完成后重命名，输入文件与输出文件可以相同
+ * 作者：ol
+ * 适用标准：C++17及以上
+ */
+/****************************************************************************************/
+
+#ifndef OL_EXTSORT_H
+#define OL_EXTSORT_H 1
+
+#include "ol_ThreadPool.h"
+#include "ol_fstream.h"
+#include "ol_sort.h"
+#include "ol_string.h"
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ol
+{
+    // 外部排序参数
+    struct ExternalSortOptions
+    {
+        size_t memory_limit = 256 * 1024 * 1024; ///< 顺串生成阶段缓存行数据的内存上限（字节，估算值），并行时由所有在途批次分摊
+        size_t buffer_size = 1024 * 1024;        ///< 每个顺串的读缓冲和输出文件写缓冲的大小（字节）
+        size_t max_merge_ways = 64;              ///< 单趟归并最多同时打开的顺串数，顺串更多时分多趟归并
+        std::string tmp_dir;                     ///< 顺串临时文件所在目录，为空时使用输出文件所在目录
+    };
+
+    // 整行作为排序键（按字节序比较）。
+    struct LineKey
+    {
+        std::string_view operator()(const std::string& line) const { return line; }
+    };
+
+    /**
+     * @brief 按字段提取排序键：用ccmdstr按分隔符拆分行，取出指定字段并转换为对应类型
+     * @tparam Ts 各字段的类型，支持ccmdstr::getvalue支持的类型（std::string、int、unsigned int、long、
+     *            unsigned long、double、float、bool）
+     * @note 只有一个字段时键类型为该字段类型，多个字段时为std::tuple，按字段顺序依次比较；
+     *       字段不存在或转换失败时取该类型的默认值（空串或0）
+     * @example FieldKey<long>(",", {2})：按第3个字段的整数值排序
+     * @example FieldKey<std::string, double>("|", {0, 4}, true)：先按第1个字段、再按第5个字段的数值排序，字段去除首尾空格
+     */
+    template <typename... Ts>
+    class FieldKey
+    {
+        static_assert(sizeof...(Ts) > 0, "FieldKey requires at least one field");
+
+    private:
+        std::string m_sepstr;                         ///< 字段分隔符。
+        std::array<size_t, sizeof...(Ts)> m_fields;   ///< 各键字段的下标（从0开始）。
+        bool m_bdelspace;                             ///< 是否删除字段首尾的空格。
+
+    public:
+        using key_type = typename std::conditional<sizeof...(Ts) == 1,
+                                                   typename std::tuple_element<0, std::tuple<Ts...>>::type,
+                                                   std::tuple<Ts...>>::type;
+
+        FieldKey(std::string sepstr, std::array<size_t, sizeof...(Ts)> fields, bool bdelspace = false)
+            : m_sepstr(std::move(sepstr)), m_fields(fields), m_bdelspace(bdelspace) {}
+
+        key_type operator()(const std::string& line) const
+        {
+            ccmdstr cmdstr(line, m_sepstr, m_bdelspace);
+            std::tuple<Ts...> values{};
+            getvalues(cmdstr, values, std::index_sequence_for<Ts...>());
+
+            if constexpr (sizeof...(Ts) == 1)
+                return std::get<0>(std::move(values));
+            else
+                return values;
+        }
+
+    private:
+        template <size_t... I>
+        void getvalues(const ccmdstr& cmdstr, std::tuple<Ts...>& values, std::index_sequence<I...>) const
+        {
+            (cmdstr.getvalue(m_fields[I], std::get<I>(values)), ...);
+        }
+    };
+
+    namespace base
+    {
+        /// 键提取函数作用于一行后得到的键类型。
+        template <typename KeyFn>
+        using line_key_t = typename std::decay<typename std::invoke_result<const KeyFn&, const std::string&>::type>::type;
+
+        // 按块读取文本文件并切分成行（不含换行符）。
+        class LineReader
+        {
+        private:
+            cifile m_file;           ///< 底层文件。
+            std::vector<char> m_buf; ///< 读缓冲区。
+            size_t m_pos = 0;        ///< 缓冲区中下一个未处理字节的位置。
+            size_t m_len = 0;        ///< 缓冲区中有效数据的长度。
+            bool m_eof = false;      ///< 文件是否已读完。
+
+        public:
+            bool open(const std::string& filename, size_t bufsize)
+            {
+                m_buf.resize(std::max<size_t>(bufsize, 4096));
+                m_pos = m_len = 0;
+                m_eof = false;
+                return m_file.open(filename, std::ios::in | std::ios::binary);
+            }
+
+            /**
+             * @brief 读取下一行
+             * @param line 存放读取结果，不含行尾的'\n'
+             * @return true-成功，false-已到文件尾
+             */
+            bool getline(std::string& line)
+            {
+                line.clear();
+                while (true)
+                {
+                    if (m_pos == m_len)
+                    {
+                        if (m_eof) return !line.empty();
+                        m_len = m_file.read(m_buf.data(), m_buf.size());
+                        m_pos = 0;
+                        if (m_len < m_buf.size()) m_eof = true;
+                        if (m_len == 0) return !line.empty();
+                    }
+
+                    const char* begin = m_buf.data() + m_pos;
+                    const char* nl = static_cast<const char*>(std::memchr(begin, '\n', m_len - m_pos));
+                    if (nl != nullptr)
+                    {
+                        line.append(begin, static_cast<size_t>(nl - begin));
+                        m_pos += static_cast<size_t>(nl - begin) + 1;
+                        return true;
+                    }
+                    line.append(begin, m_len - m_pos);
+                    m_pos = m_len;
+                }
+            }
+
+            void close() { m_file.close(); }
+        };
+
+        // 把行累积到缓冲区，满一块后一次写入文件。
+        class LineWriter
+        {
+        private:
+            cofile m_file;      ///< 底层文件。
+            std::string m_buf;  ///< 写缓冲区。
+            size_t m_bufsize;   ///< 缓冲区达到该大小时写入文件。
+            bool m_ok = true;   ///< 之前的写入是否都成功。
+
+        public:
+            bool open(const std::string& filename, size_t bufsize, bool btmp)
+            {
+                m_bufsize = std::max<size_t>(bufsize, 4096);
+                m_buf.clear();
+                m_buf.reserve(m_bufsize + 256);
+                m_ok = true;
+                return m_file.open(filename, btmp, std::ios::out | std::ios::binary);
+            }
+
+            bool writeline(const std::string& line)
+            {
+                m_buf.append(line);
+                m_buf += '\n';
+                if (m_buf.size() >= m_bufsize) flush();
+                return m_ok;
+            }
+
+            // 写出剩余数据并关闭文件，使用临时文件时重命名为正式文件名；失败时删除临时文件。
+            bool closeandrename()
+            {
+                flush();
+                if (m_ok) return m_file.closeandrename();
+                m_file.close();
+                return false;
+            }
+
+        private:
+            void flush()
+            {
+                if (m_buf.empty()) return;
+                m_ok = m_file.write(&m_buf[0], m_buf.size()) && m_ok;
+                m_buf.clear();
+            }
+        };
+
+        /**
+         * @brief 败者树：k路归并中每次选出最小元素，更换该路元素后只需沿叶子到根的路径重赛一次
+         * @tparam Before 比较函数，before(a, b)为true表示第a路的当前元素应排在第b路之前（须为严格全序）
+         * @note 内部结点保存比赛的败者，m_tree[0]保存总冠军；构造时用编号k作为"最小"哨兵逐个插入叶子
+         */
+        template <typename Before>
+        class LoserTree
+        {
+        private:
+            size_t m_k;                 ///< 路数。
+            std::vector<size_t> m_tree; ///< m_tree[0]为胜者，m_tree[1..k-1]为各内部结点的败者。
+            Before m_before;            ///< 比较函数。
+
+        public:
+            LoserTree(size_t k, Before before) : m_k(k), m_tree(k, k), m_before(std::move(before))
+            {
+                for (size_t i = k; i-- > 0;) replay(i);
+            }
+
+            // 当前胜者的路号。
+            size_t winner() const { return m_tree[0]; }
+
+            // 第s路的当前元素变化后重新比赛。
+            void replay(size_t s)
+            {
+                for (size_t t = (s + m_k) / 2; t > 0; t /= 2)
+                {
+                    if (beats(m_tree[t], s)) std::swap(s, m_tree[t]);
+                }
+                m_tree[0] = s;
+            }
+
+        private:
+            bool beats(size_t a, size_t b) const
+            {
+                if (a == m_k) return true; // 哨兵胜过一切
+                if (b == m_k) return false;
+                return m_before(a, b);
+            }
+        };
+
+        /**
+         * @brief 对一批行排序并写出
+         * @param lines 待排序的行，排序通过下标进行，行本身不移动
+         * @param btmp 是否先写临时文件再重命名（写最终输出文件时使用）
+         * @return true-成功，false-写文件失败
+         * @note 键相等时按行在批内的先后顺序排列，保证稳定
+         */
+        template <typename KeyFn, typename Compare>
+        bool write_run_base(const std::vector<std::string>& lines, const std::string& filename, bool btmp,
+                            const KeyFn& key, const Compare& comp, size_t bufsize)
+        {
+            std::vector<line_key_t<KeyFn>> keys;
+            keys.reserve(lines.size());
+            for (const std::string& line : lines) keys.push_back(key(line));
+
+            std::vector<size_t> order(lines.size());
+            std::iota(order.begin(), order.end(), size_t(0));
+            intro_sort(order, [&keys, &comp](size_t a, size_t b)
+                       {
+                if (comp(keys[a], keys[b])) return true;
+                if (comp(keys[b], keys[a])) return false;
+                return a < b; });
+
+            LineWriter out;
+            if (!out.open(filename, bufsize, btmp)) return false;
+            for (size_t i : order) out.writeline(lines[i]);
+            return out.closeandrename();
+        }
+
+        /**
+         * @brief 用败者树把多个有序顺串归并为一个有序文件
+         * @return true-成功，false-打开或写文件失败
+         * @note 键相等时编号小的顺串优先；顺串按输入顺序编号，因此整体保持稳定
+         */
+        template <typename KeyFn, typename Compare>
+        bool merge_runs_base(const std::vector<std::string>& runs, const std::string& filename, bool btmp,
+                             const KeyFn& key, const Compare& comp, size_t bufsize)
+        {
+            const size_t k = runs.size();
+            std::vector<LineReader> readers(k);
+            std::vector<std::string> lines(k);
+            std::vector<line_key_t<KeyFn>> keys(k);
+            std::vector<char> live(k, 0);
+
+            for (size_t i = 0; i < k; ++i)
+            {
+                if (!readers[i].open(runs[i], bufsize)) return false;
+                live[i] = readers[i].getline(lines[i]);
+                if (live[i]) keys[i] = key(lines[i]);
+            }
+
+            // 已读完的顺串视为无穷大
+            auto before = [&](size_t a, size_t b)
+            {
+                if (!live[a] || !live[b]) return live[a] || (!live[b] && a < b);
+                if (comp(keys[a], keys[b])) return true;
+                if (comp(keys[b], keys[a])) return false;
+                return a < b;
+            };
+            LoserTree<decltype(before)> tree(k, before);
+
+            LineWriter out;
+            if (!out.open(filename, bufsize, btmp)) return false;
+            while (true)
+            {
+                const size_t w = tree.winner();
+                if (!live[w]) break;
+                out.writeline(lines[w]);
+                live[w] = readers[w].getline(lines[w]);
+                if (live[w]) keys[w] = key(lines[w]);
+                tree.replay(w);
+            }
+
+            for (LineReader& reader : readers) reader.close();
+            return out.closeandrename();
+        }
+
+        // 记录本次排序创建的顺串文件，析构时全部删除（包括出错或抛出异常时残留的文件）。
+        class RunFiles
+        {
+        private:
+            std::string m_prefix;            ///< 顺串文件名前缀。
+            std::vector<std::string> m_names; ///< 已分配的顺串文件名。
+
+        public:
+            explicit RunFiles(std::string prefix) : m_prefix(std::move(prefix)) {}
+            RunFiles(const RunFiles&) = delete;
+            RunFiles& operator=(const RunFiles&) = delete;
+            ~RunFiles()
+            {
+                for (const std::string& name : m_names) std::remove(name.c_str());
+            }
+
+            std::string next()
+            {
+                m_names.push_back(m_prefix + ".run" + std::to_string(m_names.size()));
+                return m_names.back();
+            }
+        };
+
+        /**
+         * @brief 外部排序实现
+         * @param pool 线程池指针，为nullptr时在调用线程上串行排序顺串
+         */
+        template <typename Pool, typename KeyFn, typename Compare>
+        bool external_sort_base(Pool* pool, const std::string& infile, const std::string& outfile,
+                                const KeyFn& key, const Compare& comp, const ExternalSortOptions& options)
+        {
+            if (options.buffer_size == 0)
+                throw std::invalid_argument("[ol::external_sort] buffer_size must be greater than 0");
+            if (options.max_merge_ways < 2)
+                throw std::invalid_argument("[ol::external_sort] max_merge_ways must be at least 2");
+
+            LineReader in;
+            if (!in.open(infile, options.buffer_size)) return false;
+
+            std::string prefix = outfile;
+            if (!options.tmp_dir.empty())
+            {
+                const size_t slash = outfile.find_last_of("/\\");
+                prefix = options.tmp_dir + "/" + (slash == std::string::npos ? outfile : outfile.substr(slash + 1));
+            }
+            RunFiles files(prefix);
+            std::vector<std::string> runs;
+
+            // 1. 生成顺串。并行时最多workers个批次在线程池中排序，调用线程同时读取下一批，内存上限由它们分摊
+            const size_t inflight = pool ? std::max<size_t>(1, pool->getWorkerNum()) : 0;
+            const size_t budget = std::max<size_t>(options.memory_limit / (inflight + 1), 1);
+            const size_t per_line = sizeof(std::string) + sizeof(line_key_t<KeyFn>) + sizeof(size_t);
+
+            std::deque<std::future<bool>> pending;
+            bool ok = true;
+            auto wait_front = [&pending, &ok]()
+            {
+                std::future<bool> fut = std::move(pending.front());
+                pending.pop_front();
+                ok = fut.get() && ok;
+            };
+
+            try
+            {
+                std::string line;
+                bool more = true;
+                while (more)
+                {
+                    auto chunk = std::make_shared<std::vector<std::string>>();
+                    size_t bytes = 0;
+                    while (bytes < budget && (more = in.getline(line)))
+                    {
+                        bytes += line.size() + per_line;
+                        chunk->push_back(std::move(line));
+                    }
+
+                    // 整个文件一批就能放下：直接排序写出到输出文件
+                    if (runs.empty() && !more)
+                    {
+                        in.close();
+                        return write_run_base(*chunk, outfile, true, key, comp, options.buffer_size);
+                    }
+                    if (chunk->empty()) break;
+
+                    runs.push_back(files.next());
+                    auto task = [chunk, name = runs.back(), &key, &comp, bufsize = options.buffer_size]()
+                    { return write_run_base(*chunk, name, false, key, comp, bufsize); };
+
+                    if (pool == nullptr)
+                    {
+                        ok = task() && ok;
+                        continue;
+                    }
+
+                    while (pending.size() >= inflight) wait_front();
+                    auto submitted = pool->submitTask(task);
+                    if (submitted.first)
+                        pending.push_back(std::move(submitted.second));
+                    else
+                        ok = task() && ok; // 线程池已停止或拒绝任务：在调用线程上完成
+                }
+
+                while (!pending.empty()) wait_front();
+            }
+            catch (...)
+            {
+                // 任务还引用着key/comp与顺串文件，必须等它们全部结束后再传播异常
+                for (auto& fut : pending) fut.wait();
+                throw;
+            }
+            in.close();
+            if (!ok) return false;
+
+            // 2. 多趟归并，直到顺串数不超过单趟归并路数；单趟路数同时受内存上限约束
+            const size_t ways = std::max<size_t>(2, std::min(options.max_merge_ways, options.memory_limit / options.buffer_size));
+            while (runs.size() > ways)
+            {
+                std::vector<std::string> merged;
+                for (size_t i = 0; i < runs.size(); i += ways)
+                {
+                    std::vector<std::string> group(runs.begin() + i, runs.begin() + std::min(runs.size(), i + ways));
+                    if (group.size() == 1)
+                    {
+                        merged.push_back(group[0]);
+                        continue;
+                    }
+                    merged.push_back(files.next());
+                    if (!merge_runs_base(group, merged.back(), false, key, comp, options.buffer_size)) return false;
+                    for (const std::string& name : group) std::remove(name.c_str());
+                }
+                runs.swap(merged);
+            }
+
+            return merge_runs_base(runs, outfile, true, key, comp, options.buffer_size);
+        }
+    } // namespace base
+
+    /**
+     * @brief 外部排序：按行对文本文件排序，适用于超出内存容量的大文件
+     * @tparam KeyFn 键提取函数类型，接受const std::string&（不含换行符的一行），返回排序键；需可被多个线程同时调用
+     * @tparam Compare 键的比较函数类型，需满足严格弱序，默认使用std::less
+     * @param infile 输入文件名
+     * @param outfile 输出文件名（可与输入文件相同），先写入"outfile.tmp"，完成后重命名
+     * @param key 键提取函数，如FieldKey<long>(",", {2})；顺串生成与每趟归并时每行各调用一次
+     * @param comp 键的比较函数对象，返回true表示第一个参数应排在前面
+     * @param options 内存上限、IO缓冲大小、归并路数与临时目录
+     * @return true-成功，false-打开或读写文件失败
+     * @throw std::invalid_argument buffer_size为0或max_merge_ways小于2时抛出；键提取函数或比较函数抛出的异常会传播给调用者
+     * @note
+     * 算法特性：
+     * - 稳定性：稳定排序（键相等的行保持输入中的先后顺序）
+     * - 时间复杂度：O(n log n)次比较；IO为1 + ceil(log_k(r))趟顺序读写，r为顺串数，k为单趟归并路数
+     * - 空间复杂度：内存约为memory_limit + k * buffer_size；磁盘需要与输入等大的临时空间
+     * - 输出的每一行都以'\n'结尾；行内容（包括'\r'）原样保留
+     * - 输入一批就能装下时不产生临时文件
+     */
+    template <typename KeyFn, typename Compare = std::less<base::line_key_t<KeyFn>>>
+    bool external_sort(const std::string& infile, const std::string& outfile, const KeyFn& key,
+                       const Compare& comp = Compare(), const ExternalSortOptions& options = ExternalSortOptions())
+    {
+        return base::external_sort_base(static_cast<ThreadPool<false>*>(nullptr), infile, outfile, key, comp, options);
+    }
+
+    /**
+     * @brief 外部排序（整行按字节序升序）
+     * @note 其余说明见external_sort(infile, outfile, key, comp, options)
+     */
+    inline bool external_sort(const std::string& infile, const std::string& outfile,
+                              const ExternalSortOptions& options = ExternalSortOptions())
+    {
+        return external_sort(infile, outfile, LineKey(), std::less<std::string_view>(), options);
+    }
+
+    /**
+     * @brief 外部排序（并行版本）：顺串的排序与写出在线程池中进行，调用线程同时读取下一批
+     * @param pool 线程池，最多getWorkerNum()个批次同时在途，memory_limit由在途批次与正在读取的批次分摊
+     * @note 线程池已停止或拒绝任务时在调用线程上完成；其余说明见串行版本
+     */
+    template <bool IsDynamic, typename KeyFn, typename Compare = std::less<base::line_key_t<KeyFn>>>
+    bool external_sort(ThreadPool<IsDynamic>& pool, const std::string& infile, const std::string& outfile,
+                       const KeyFn& key, const Compare& comp = Compare(),
+                       const ExternalSortOptions& options = ExternalSortOptions())
+    {
+        return base::external_sort_base(&pool, infile, outfile, key, comp, options);
+    }
+
+} // namespace ol
+
+#endif // !OL_EXTSORT_H
@@ -0,0 +1,431 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_parallel.h
+ * 功能描述：基于ol::ThreadPool的数据并行算法，特性包括：
+ *          - parallel_for：对区间内每个元素（或每个整数下标）并行执行函数
+ *          - parallel_reduce：并行归约，只要求归约操作满足结合律（不要求交换律）
+ *          - parallel_transform：并行变换，结果写入输出区间
+ *          - parallel_inclusive_scan：并行前缀和（两遍扫描：块内扫描 + 块偏移修正），支持原地计算
+ *          - 自适应分块：参与线程按"剩余量/(2*参与线程数)"动态领取区间（guided调度），块大小随剩余量递减，
+ *            既减少领取次数又保证尾部负载均衡；可通过grainSize指定最小块大小
+ *          - 调用线程参与计算，在线程池的工作线程内嵌套调用也不会死锁；线程池已停止或队列满时退化为串行执行
+ *          - 异常传播：任一分块抛出异常后剩余分块被跳过，调用返回前把第一个异常重新抛出
+ *          - 同时提供迭代器版本和容器版本（容器版本通过container_traits适配STL容器和原生数组，与ol_sort.h一致）
+ * 作者：ol
+ * 适用标准：C++17及以上
+ */
+/****************************************************************************************/
+
+#ifndef OL_PARALLEL_H
+#define OL_PARALLEL_H 1
+
+#include "ol_ThreadPool.h"
+#include "ol_type_traits.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ol
+{
+
+    // 并行算法实现 (内部实现)
+    // ===========================================================================
+    namespace base
+    {
+        /**
+         * @brief 一次并行调用的共享状态（调用线程与辅助任务共享）
+         * @note 辅助任务可能在调用返回后才被线程池调度，此时区间已领取完毕，辅助任务不会再访问调用方的栈对象
+         */
+        struct ParallelState
+        {
+            const size_t total;             ///< 总工作量（元素数或块数）
+            const size_t grain;             ///< 最小领取量
+            const size_t parts;             ///< 参与线程数（辅助任务数+调用线程）
+            std::atomic_size_t next;        ///< 下一个未领取的位置
+            std::atomic_size_t done;        ///< 已完成（或已跳过）的工作量
+            std::atomic_bool failed;        ///< 是否已有分块抛出异常
+            std::mutex mutex;               ///< 保护error并配合condVar等待
+            std::condition_variable condVar; ///< 全部完成时通知调用线程
+            std::exception_ptr error;       ///< 第一个异常
+
+            ParallelState(size_t total, size_t grain, size_t parts)
+                : total(total), grain(grain), parts(parts), next(0), done(0), failed(false) {}
+
+            /**
+             * @brief 循环领取区间并执行，直到全部领取完毕
+             * @param body 区间函数，签名为void(size_t begin, size_t end)
+             */
+            template <typename Body>
+            void run(const Body& body)
+            {
+                for (;;)
+                {
+                    size_t begin = next.load(std::memory_order_relaxed);
+                    size_t end;
+                    do
+                    {
+                        if (begin >= total) return;
+                        size_t remaining = total - begin;
+                        size_t chunk = std::max(grain, remaining / (2 * parts));
+                        end = begin + std::min(chunk, remaining);
+                    } while (!next.compare_exchange_weak(begin, end, std::memory_order_relaxed));
+
+                    // 已有异常时跳过剩余分块，但仍计入完成量，保证调用线程能够返回
+                    if (!failed.load(std::memory_order_relaxed))
+                    {
+                        try
+                        {
+                            body(begin, end);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (!error) error = std::current_exception();
+                            failed.store(true, std::memory_order_relaxed);
+                        }
+                    }
+
+                    size_t count = end - begin;
+                    if (done.fetch_add(count, std::memory_order_acq_rel) + count == total)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        condVar.notify_all();
+                    }
+                }
+            }
+
+            /**
+             * @brief 等待全部工作完成，有异常时重新抛出
+             */
+            void wait()
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condVar.wait(lock, [this]()
+                             { return done.load(std::memory_order_acquire) == total; });
+                if (error) std::rethrow_exception(error);
+            }
+        };
+
+        /**
+         * @brief 在线程池上并行执行[0, total)区间
+         * @param pool 线程池
+         * @param total 总工作量
+         * @param grainSize 最小领取量（0表示自动：约为每个参与线程16块）
+         * @param body 区间函数，签名为void(size_t begin, size_t end)
+         * @note 调用线程参与计算；未能投递的辅助任务由调用线程承担其工作量
+         */
+        template <bool IsDynamic, typename Body>
+        void parallel_run(ThreadPool<IsDynamic>& pool, size_t total, size_t grainSize, const Body& body)
+        {
+            if (total == 0) return;
+
+            size_t workers = pool.getWorkerNum();
+            size_t parts = workers + 1;
+            size_t grain = grainSize > 0 ? grainSize : std::max<size_t>(1, total / (parts * 16));
+
+            // 工作量不足两块时不值得跨线程
+            if (workers == 0 || total <= grain)
+            {
+                body(0, total);
+                return;
+            }
+
+            size_t helpers = std::min(workers, (total + grain - 1) / grain - 1);
+            auto state = std::make_shared<ParallelState>(total, grain, helpers + 1);
+
+            // 辅助任务只持有共享状态和body指针（均为平凡捕获，Task内联存储，不申请堆内存）
+            const Body* bodyPtr = &body;
+            std::vector<Task> tasks;
+            tasks.reserve(helpers);
+            for (size_t i = 0; i < helpers; ++i)
+                tasks.emplace_back([state, bodyPtr]()
+                                   { state->run(*bodyPtr); });
+            pool.addTasks(tasks.begin(), tasks.end());
+
+            state->run(body);
+            state->wait();
+        }
+
+        /**
+         * @brief 按固定块划分区间的块数（块大小不小于grainSize），供需要确定性结合顺序的归约和扫描使用
+         * @param total 元素数
+         * @param grainSize 最小块大小（0表示自动）
+         * @param workers 线程池工作线程数
+         * @return 块数（至少为1）
+         */
+        inline size_t parallel_block_num(size_t total, size_t grainSize, size_t workers)
+        {
+            size_t blocks = (workers + 1) * 4;
+            if (grainSize > 0) blocks = std::min(blocks, (total + grainSize - 1) / grainSize);
+            return std::max<size_t>(1, std::min(blocks, total));
+        }
+
+        /**
+         * @brief 判断类型是否可作为容器版本的参数（STL容器或原生数组），用于与迭代器/下标版本区分重载
+         */
+        template <typename Container, typename = void>
+        struct is_range : std::false_type
+        {
+        };
+
+        template <typename Container>
+        struct is_range<Container, std::void_t<decltype(std::begin(std::declval<Container&>()))>> : std::true_type
+        {
+        };
+
+        /**
+         * @brief 编译期检查迭代器是否为随机访问迭代器（分块需要O(1)定位）
+         */
+        template <typename Iterator>
+        void check_random_access()
+        {
+            static_assert(
+                std::is_base_of_v<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<Iterator>::iterator_category>,
+                "parallel algorithms require random access iterators");
+        }
+    } // namespace base
+    // ===========================================================================
+
+    // 用户接口 - 并行遍历
+    // ===========================================================================
+    /**
+     * @brief 并行遍历（迭代器版本），对[first, last)中每个元素调用func(*it)
+     * @tparam RandomIt 随机访问迭代器类型
+     * @tparam Func 函数类型，签名为void(reference)
+     * @param pool 执行计算的线程池
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param func 对每个元素执行的函数（可能被多个线程并发调用）
+     * @param grainSize 每次领取的最小元素数（0表示自动）
+     * @throw 任一元素上func抛出的第一个异常（其余未执行的元素被跳过）
+     */
+    template <bool IsDynamic, typename RandomIt, typename Func,
+              std::enable_if_t<!std::is_integral_v<RandomIt>, int> = 0>
+    void parallel_for(ThreadPool<IsDynamic>& pool, RandomIt first, RandomIt last, const Func& func, size_t grainSize = 0)
+    {
+        base::check_random_access<RandomIt>();
+
+        base::parallel_run(pool, static_cast<size_t>(last - first), grainSize, [first, &func](size_t begin, size_t end)
+                           {
+                               for (RandomIt it = first + begin, stop = first + end; it != stop; ++it) func(*it); });
+    }
+
+    /**
+     * @brief 并行遍历（下标版本），对[begin, end)中每个整数i调用func(i)
+     * @tparam Index 整数类型
+     * @param pool 执行计算的线程池
+     * @param begin 起始下标
+     * @param end 结束下标（小于等于begin时不执行）
+     * @param func 对每个下标执行的函数
+     * @param grainSize 每次领取的最小下标数（0表示自动）
+     */
+    template <bool IsDynamic, typename Index, typename Func,
+              std::enable_if_t<std::is_integral_v<Index>, int> = 0>
+    void parallel_for(ThreadPool<IsDynamic>& pool, Index begin, Index end, const Func& func, size_t grainSize = 0)
+    {
+        if (end <= begin) return;
+
+        base::parallel_run(pool, static_cast<size_t>(end - begin), grainSize, [begin, &func](size_t from, size_t to)
+                           {
+                               for (size_t i = from; i < to; ++i) func(static_cast<Index>(begin + static_cast<Index>(i))); });
+    }
+
+    /**
+     * @brief 并行遍历（容器版本）
+     * @param pool 执行计算的线程池
+     * @param container 容器（需支持随机访问迭代器）或原生数组
+     * @param func 对每个元素执行的函数
+     * @param grainSize 每次领取的最小元素数（0表示自动）
+     */
+    template <bool IsDynamic, typename Container, typename Func,
+              std::enable_if_t<base::is_range<Container>::value, int> = 0>
+    void parallel_for(ThreadPool<IsDynamic>& pool, Container& container, const Func& func, size_t grainSize = 0)
+    {
+        using traits = container_traits<Container>;
+        parallel_for(pool, traits::begin(container), traits::end(container), func, grainSize);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 并行归约
+    // ===========================================================================
+    /**
+     * @brief 并行归约（迭代器版本）
+     * @tparam T 结果类型
+     * @tparam BinaryOp 归约操作类型，签名为T(T, reference)，需满足结合律
+     * @param pool 执行计算的线程池
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param init 初始值（只参与一次归约）
+     * @param op 归约操作（默认std::plus<>）
+     * @param grainSize 最小块大小（0表示自动）
+     * @return init与所有元素按原顺序归约的结果
+     * @note 区间按固定块划分，块内顺序归约后再按块顺序合并：结合方式只取决于块划分，
+     *       同样的输入和线程数多次调用结果一致（浮点数求和也可复现），不要求op满足交换律
+     */
+    template <bool IsDynamic, typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+    T parallel_reduce(ThreadPool<IsDynamic>& pool, RandomIt first, RandomIt last, T init,
+                      const BinaryOp& op = BinaryOp(), size_t grainSize = 0)
+    {
+        base::check_random_access<RandomIt>();
+
+        size_t total = static_cast<size_t>(last - first);
+        if (total == 0) return init;
+
+        size_t blocks = base::parallel_block_num(total, grainSize, pool.getWorkerNum());
+        std::vector<std::optional<T>> partials(blocks);
+        base::parallel_run(pool, blocks, 1, [&](size_t from, size_t to)
+                           {
+                               for (size_t b = from; b < to; ++b)
+                               {
+                                   RandomIt it = first + total * b / blocks, stop = first + total * (b + 1) / blocks;
+                                   T acc = *it;
+                                   for (++it; it != stop; ++it) acc = op(std::move(acc), *it);
+                                   partials[b].emplace(std::move(acc));
+                               } });
+
+        for (auto& partial : partials) init = op(std::move(init), std::move(*partial));
+        return init;
+    }
+
+    /**
+     * @brief 并行归约（容器版本）
+     */
+    template <bool IsDynamic, typename Container, typename T, typename BinaryOp = std::plus<>,
+              std::enable_if_t<base::is_range<Container>::value, int> = 0>
+    T parallel_reduce(ThreadPool<IsDynamic>& pool, Container& container, T init,
+                      const BinaryOp& op = BinaryOp(), size_t grainSize = 0)
+    {
+        using traits = container_traits<Container>;
+        return parallel_reduce(pool, traits::begin(container), traits::end(container), std::move(init), op, grainSize);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 并行变换
+    // ===========================================================================
+    /**
+     * @brief 并行变换（迭代器版本），*(d_first + i) = op(*(first + i))
+     * @param pool 执行计算的线程池
+     * @param first 输入起始迭代器
+     * @param last 输入结束迭代器
+     * @param d_first 输出起始迭代器（随机访问，可与first相同）
+     * @param op 变换函数
+     * @param grainSize 每次领取的最小元素数（0表示自动）
+     * @return 输出区间的尾后迭代器
+     */
+    template <bool IsDynamic, typename RandomIt, typename OutputIt, typename UnaryOp>
+    OutputIt parallel_transform(ThreadPool<IsDynamic>& pool, RandomIt first, RandomIt last, OutputIt d_first,
+                                const UnaryOp& op, size_t grainSize = 0)
+    {
+        base::check_random_access<RandomIt>();
+        base::check_random_access<OutputIt>();
+
+        size_t total = static_cast<size_t>(last - first);
+        base::parallel_run(pool, total, grainSize, [first, d_first, &op](size_t begin, size_t end)
+                           {
+                               OutputIt out = d_first + begin;
+                               for (RandomIt it = first + begin, stop = first + end; it != stop; ++it, ++out) *out = op(*it); });
+        return d_first + total;
+    }
+
+    /**
+     * @brief 并行变换（容器版本）
+     */
+    template <bool IsDynamic, typename Container, typename OutputIt, typename UnaryOp,
+              std::enable_if_t<base::is_range<Container>::value, int> = 0>
+    OutputIt parallel_transform(ThreadPool<IsDynamic>& pool, Container& container, OutputIt d_first,
+                                const UnaryOp& op, size_t grainSize = 0)
+    {
+        using traits = container_traits<Container>;
+        return parallel_transform(pool, traits::begin(container), traits::end(container), d_first, op, grainSize);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 并行前缀和
+    // ===========================================================================
+    /**
+     * @brief 并行包含式前缀扫描（迭代器版本），*(d_first + i) = first[0] op first[1] op ... op first[i]
+     * @param pool 执行计算的线程池
+     * @param first 输入起始迭代器
+     * @param last 输入结束迭代器
+     * @param d_first 输出起始迭代器（随机访问，可与first相同实现原地扫描）
+     * @param op 二元操作（默认std::plus<>），需满足结合律
+     * @param grainSize 最小块大小（0表示自动）
+     * @return 输出区间的尾后迭代器
+     * @note 第一遍各块独立扫描并写出块内前缀，串行计算块偏移后，第二遍把偏移合并到除第一块外的各块
+     */
+    template <bool IsDynamic, typename RandomIt, typename OutputIt, typename BinaryOp = std::plus<>>
+    OutputIt parallel_inclusive_scan(ThreadPool<IsDynamic>& pool, RandomIt first, RandomIt last, OutputIt d_first,
+                                     const BinaryOp& op = BinaryOp(), size_t grainSize = 0)
+    {
+        base::check_random_access<RandomIt>();
+        base::check_random_access<OutputIt>();
+        using T = typename std::iterator_traits<RandomIt>::value_type;
+
+        size_t total = static_cast<size_t>(last - first);
+        if (total == 0) return d_first;
+
+        size_t blocks = base::parallel_block_num(total, grainSize, pool.getWorkerNum());
+        auto blockBegin = [total, blocks](size_t b)
+        { return total * b / blocks; };
+
+        // 第一遍：块内扫描
+        base::parallel_run(pool, blocks, 1, [&](size_t from, size_t to)
+                           {
+                               for (size_t b = from; b < to; ++b)
+                               {
+                                   size_t begin = blockBegin(b), end = blockBegin(b + 1);
+                                   T acc = first[begin];
+                                   d_first[begin] = acc;
+                                   for (size_t i = begin + 1; i < end; ++i)
+                                   {
+                                       acc = op(std::move(acc), first[i]);
+                                       d_first[i] = acc;
+                                   }
+                               } });
+        if (blocks == 1) return d_first + total;
+
+        // 串行计算每块的偏移（前面所有块的归约结果）
+        std::vector<std::optional<T>> offsets(blocks);
+        offsets[1].emplace(d_first[blockBegin(1) - 1]);
+        for (size_t b = 2; b < blocks; ++b)
+            offsets[b].emplace(op(*offsets[b - 1], d_first[blockBegin(b) - 1]));
+
+        // 第二遍：合并偏移
+        base::parallel_run(pool, blocks - 1, 1, [&](size_t from, size_t to)
+                           {
+                               for (size_t b = from + 1; b < to + 1; ++b)
+                               {
+                                   const T& offset = *offsets[b];
+                                   for (size_t i = blockBegin(b), end = blockBegin(b + 1); i < end; ++i)
+                                       d_first[i] = op(offset, d_first[i]);
+                               } });
+        return d_first + total;
+    }
+
+    /**
+     * @brief 并行包含式前缀扫描（容器版本）
+     */
+    template <bool IsDynamic, typename Container, typename OutputIt, typename BinaryOp = std::plus<>,
+              std::enable_if_t<base::is_range<Container>::value, int> = 0>
+    OutputIt parallel_inclusive_scan(ThreadPool<IsDynamic>& pool, Container& container, OutputIt d_first,
+                                     const BinaryOp& op = BinaryOp(), size_t grainSize = 0)
+    {
+        using traits = container_traits<Container>;
+        return parallel_inclusive_scan(pool, traits::begin(container), traits::end(container), d_first, op, grainSize);
+    }
+    // ===========================================================================
+
+} // namespace ol
+
+#endif // !OL_PARALLEL_H
@@ -4,6 +4,12 @@
  * 功能描述：排序算法工具类，提供高效的排序实现，支持多种容器类型与自定义排序规则，特性包括：
  *          - 容器特性萃取：适配STL容器（vector、deque等）和原生数组，统一迭代器操作接口
  *          - 多种排序算法：插入排序、快速排序、希尔排序、冒泡排序、选择排序、堆排序、归并排序等
+ *          - 自适应稳定排序tim_sort：识别自然顺串并飞奔合并，接近有序的数据接近线性时间
+ *          - 内省排序intro_sort（pdqsort风格，最坏O(n log n)），通用场景推荐使用
+ *          - 部分排序与选择：partial_sort、nth_element（内省选择）、流式Top-K累加器TopK/top_k（可跨线程合并）
+ *          - 计数排序/桶排序可传入可复用的工作区SortWorkspace，反复排序时不做堆分配
+ *          - 字节基数排序radix256_sort：整数/浮点数/按数值键排序记录，支持复用缓冲区
+ *          - 并行排序：并行归并排序（稳定，含并行合并）与并行样本排序（不稳定），适合大规模数据
  *          - 自定义比较器：支持传入符合严格弱序（Strict Weak Ordering）的比较函数/对象
  *          - 提供容器打印功能（调试用），支持所有可范围遍历的容器类型
  * 作者：ol
@@ -315,6 +321,7 @@ namespace ol
      * - 时间复杂度：O(n log n)，与初始有序度无关
      * - 空间复杂度：O(n)，需要额外的存储空间
      * - 适用场景：中等至大规模数据，需要稳定排序的场景
+     * - 数据部分有序时推荐使用tim_sort，临时空间也更少
      */
     template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
     void merge_sort(RandomIt first, RandomIt last, const Compare& comp = Compare())
@@ -349,6 +356,90 @@ namespace ol
     }
     // ===========================================================================
 
+    // 用户接口 - Timsort（自适应稳定排序）
+    // ===========================================================================
+    /**
+     * @brief Timsort自适应稳定排序（迭代器版本，支持默认比较器）
+     * @tparam RandomIt 随机访问迭代器类型
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @note
+     * 算法特性：
+     * - 稳定性：稳定排序（相等元素保持原有顺序）
+     * - 时间复杂度：最坏O(n log n)；已有序/逆序/由少量有序段拼接的输入接近O(n)
+     * - 空间复杂度：临时缓冲区最多n/2个元素，元素只需可移动，无需默认构造
+     * - 适用场景：需要稳定排序且数据部分有序的场景（如按时间追加、局部乱序的时间序列）
+     *
+     * 实现要点：
+     * - 顺串识别：扫描自然有序段，严格降序段原地反转
+     * - minrun：过短的顺串用折半插入排序补足到minrun（32~64），使顺串个数接近2的幂
+     * - 栈不变式：按长度规则合并相邻顺串，保证合并平衡且栈深度为O(log n)
+     * - 飞奔合并：一侧连续胜出达到阈值后改用指数搜索整段搬移，阈值随数据自适应调整
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    void tim_sort(RandomIt first, RandomIt last, const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "tim_sort requires random access iterators");
+
+        base::tim_sort_base(first, last, comp);
+    }
+
+    /**
+     * @brief Timsort自适应稳定排序（容器版本，支持默认比较器）
+     * @tparam Container 容器类型（需支持随机访问迭代器）
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param container 待排序的容器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @note
+     * 算法特性：
+     * - 稳定性：稳定排序（相等元素保持原有顺序）
+     * - 时间复杂度：最坏O(n log n)；接近有序的输入接近O(n)
+     * - 空间复杂度：临时缓冲区最多n/2个元素
+     * - 适用场景：需要稳定排序且数据部分有序的场景
+     */
+    template <typename Container, typename Compare = std::less<typename container_traits<Container>::value_type>>
+    void tim_sort(Container& container, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        tim_sort(traits::begin(container), traits::end(container), comp);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 排序工作区
+    // ===========================================================================
+    /**
+     * @brief 计数排序/桶排序的可复用工作区
+     * @tparam T 待排序元素类型
+     * @note
+     * - 反复排序同规模数据（如滑动窗口）时，把同一个工作区传给counting_sort/bucket_sort，
+     *   缓冲区容量足够后每次排序都不再做任何堆分配
+     * - 非线程安全：每个线程使用各自的工作区
+     */
+    template <typename T>
+    struct SortWorkspace
+    {
+        std::vector<size_t> counts; ///< 计数排序的计数数组 / 桶排序的桶偏移数组
+        std::vector<T> buffer;      ///< 桶排序的扁平分发缓冲区（所有桶共用，排序时resize到元素个数，要求T可默认构造）
+
+        /**
+         * @brief 预留容量，之后规模不超过n、值域/桶数不超过counts_size的排序都不会分配内存
+         * @param n 元素个数
+         * @param counts_size 计数排序的值域大小（最大值-最小值+1），或桶排序的桶数+1
+         */
+        void reserve(size_t n, size_t counts_size)
+        {
+            buffer.reserve(n);
+            counts.reserve(counts_size);
+        }
+    };
+    // ===========================================================================
+
     // 用户接口 - 计数排序
     // ===========================================================================
     /**
@@ -398,6 +489,47 @@ namespace ol
         using traits = container_traits<Container>;
         counting_sort(traits::begin(container), traits::end(container), comp);
     }
+
+    /**
+     * @brief 计数排序（迭代器版本，复用工作区，不分配内存）
+     * @tparam RandomIt 随机访问迭代器类型（元素类型为整数）
+     * @tparam Compare 比较器类型，仅支持std::less（升序）和std::greater（降序）
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param workspace 工作区，只使用其中的计数数组；容量不小于值域时不做任何堆分配
+     * @param comp 比较器，std::less为升序，std::greater为降序
+     * @throw std::length_error 当值域超过计数数组的max_size()时抛出
+     * @throw std::bad_alloc 当值域未超过max_size()但内存不足以分配计数数组时抛出（由counts.assign()抛出）
+     * @note
+     * - 时间复杂度：O(n + k)，k为数值范围；不需要输出缓冲区（按计数直接重写原区间）
+     * - 适用场景：在循环中反复对值域较小的整数窗口排序
+     */
+    template <typename RandomIt, typename T, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    typename std::enable_if<std::is_integral<typename std::iterator_traits<RandomIt>::value_type>::value, void>::type
+    counting_sort(RandomIt first, RandomIt last, SortWorkspace<T>& workspace, const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "counting_sort requires random access iterators");
+
+        base::counting_sort_counts_base(first, last, workspace.counts, comp);
+    }
+
+    /**
+     * @brief 计数排序（容器版本，复用工作区，不分配内存）
+     * @param container 待排序的容器（元素为整数）
+     * @param workspace 工作区
+     * @param comp 比较器，std::less为升序，std::greater为降序
+     */
+    template <typename Container, typename T, typename Compare = std::less<T>>
+    typename std::enable_if<std::is_integral<T>::value, void>::type
+    counting_sort(Container& container, SortWorkspace<T>& workspace, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        counting_sort(traits::begin(container), traits::end(container), workspace, comp);
+    }
     // ===========================================================================
 
     // 用户接口 - 基数排序（LSD）
@@ -468,6 +600,147 @@ namespace ol
     }
     // ===========================================================================
 
+    // 用户接口 - 字节基数排序（radix 256）
+    // ===========================================================================
+    /**
+     * @brief 字节基数排序（迭代器版本，使用调用方提供的缓冲区）
+     * @tparam RandomIt 随机访问迭代器类型，元素为整数、bool、float或double
+     * @tparam Compare 比较器类型，仅支持std::less（升序）和std::greater（降序）
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param scratch 缓冲区，大小不足时自动扩容；反复排序时传入同一个缓冲区可避免每次分配
+     * @param comp 比较器，std::less为升序，std::greater为降序
+     * @note
+     * 算法特性：
+     * - 非比较型排序，每趟按一个字节（256个桶）分发，64位键最多8趟
+     * - 稳定性：稳定排序（相等元素保持原始相对顺序，降序同样稳定）
+     * - 时间复杂度：O(k*n)，k为键的字节数；所有元素在某字节上取值相同的趟被跳过
+     * - 空间复杂度：O(n)，即scratch
+     * - 有符号整数和IEEE浮点数通过保序的键变换处理，-0.0排在+0.0之前，NaN按符号位排在两端
+     * - 适用场景：大量整数/浮点数排序，64位键时通常比比较型排序快数倍
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    typename std::enable_if<std::is_arithmetic<typename std::iterator_traits<RandomIt>::value_type>::value, void>::type
+    radix256_sort(RandomIt first, RandomIt last,
+                  std::vector<typename std::iterator_traits<RandomIt>::value_type>& scratch,
+                  const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "radix256_sort requires random access iterators");
+
+        using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+        base::radix256_sort_by_key_base(first, last, scratch, [](const ValueType& v)
+                                        { return v; }, comp);
+    }
+
+    /**
+     * @brief 字节基数排序（迭代器版本，内部分配缓冲区）
+     *
+     * 与使用调用方缓冲区的版本特性一致，每次调用分配一个与输入等长的临时缓冲区。
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    typename std::enable_if<std::is_arithmetic<typename std::iterator_traits<RandomIt>::value_type>::value, void>::type
+    radix256_sort(RandomIt first, RandomIt last, const Compare& comp = Compare())
+    {
+        std::vector<typename std::iterator_traits<RandomIt>::value_type> scratch;
+        radix256_sort(first, last, scratch, comp);
+    }
+
+    /**
+     * @brief 字节基数排序（容器版本，使用调用方提供的缓冲区）
+     * @tparam Container 容器类型（需支持随机访问迭代器，元素为整数、bool、float或double）
+     * @tparam Compare 比较器类型，仅支持std::less（升序）和std::greater（降序）
+     * @param container 待排序的容器
+     * @param scratch 缓冲区，大小不足时自动扩容；反复排序时传入同一个缓冲区可避免每次分配
+     * @param comp 比较器，std::less为升序，std::greater为降序
+     * @note 算法特性见迭代器版本
+     */
+    template <typename Container, typename T, typename Compare = std::less<T>>
+    typename std::enable_if<std::is_arithmetic<T>::value, void>::type
+    radix256_sort(Container& container, std::vector<T>& scratch, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        radix256_sort(traits::begin(container), traits::end(container), scratch, comp);
+    }
+
+    /**
+     * @brief 字节基数排序（容器版本，内部分配缓冲区）
+     */
+    template <typename Container, typename Compare = std::less<typename container_traits<Container>::value_type>>
+    typename std::enable_if<std::is_arithmetic<base::range_value_t<Container>>::value, void>::type
+    radix256_sort(Container& container, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        radix256_sort(traits::begin(container), traits::end(container), comp);
+    }
+
+    /**
+     * @brief 按键字节基数排序（迭代器版本，使用调用方提供的缓冲区）
+     * @tparam RandomIt 随机访问迭代器类型，元素需可移动赋值且可默认构造
+     * @tparam KeyFn 键提取函数类型，接受const元素引用，返回整数、bool、float或double
+     * @tparam Compare 比较器类型，仅支持键类型的std::less（升序）和std::greater（降序）
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param key 键提取函数，每趟分发都会调用，应当廉价（如返回成员）
+     * @param scratch 缓冲区，大小不足时自动扩容；反复排序时传入同一个缓冲区可避免每次分配
+     * @param comp 比较器，std::less为升序，std::greater为降序
+     * @note
+     * - 用于按数值键排序记录，如(key, payload)对：radix256_sort_by_key(v, [](const auto& p) { return p.first; })
+     * - 稳定排序，其余特性与radix256_sort相同；元素整体随键移动，大记录可改为排序(键, 下标)对
+     */
+    template <typename RandomIt, typename KeyFn,
+              typename Compare = std::less<base::radix_key_t<KeyFn, typename std::iterator_traits<RandomIt>::value_type>>>
+    void radix256_sort_by_key(RandomIt first, RandomIt last, const KeyFn& key,
+                              std::vector<typename std::iterator_traits<RandomIt>::value_type>& scratch,
+                              const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "radix256_sort_by_key requires random access iterators");
+
+        base::radix256_sort_by_key_base(first, last, scratch, key, comp);
+    }
+
+    /**
+     * @brief 按键字节基数排序（迭代器版本，内部分配缓冲区）
+     */
+    template <typename RandomIt, typename KeyFn,
+              typename Compare = std::less<base::radix_key_t<KeyFn, typename std::iterator_traits<RandomIt>::value_type>>>
+    void radix256_sort_by_key(RandomIt first, RandomIt last, const KeyFn& key, const Compare& comp = Compare())
+    {
+        std::vector<typename std::iterator_traits<RandomIt>::value_type> scratch;
+        radix256_sort_by_key(first, last, key, scratch, comp);
+    }
+
+    /**
+     * @brief 按键字节基数排序（容器版本，使用调用方提供的缓冲区）
+     * @note 参数与特性见迭代器版本
+     */
+    template <typename Container, typename KeyFn, typename T, typename Compare = std::less<base::radix_key_t<KeyFn, T>>>
+    void radix256_sort_by_key(Container& container, const KeyFn& key, std::vector<T>& scratch,
+                              const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        radix256_sort_by_key(traits::begin(container), traits::end(container), key, scratch, comp);
+    }
+
+    /**
+     * @brief 按键字节基数排序（容器版本，内部分配缓冲区）
+     */
+    template <typename Container, typename KeyFn,
+              typename Compare = std::less<base::radix_key_t<KeyFn, typename container_traits<Container>::value_type>>>
+    void radix256_sort_by_key(Container& container, const KeyFn& key, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        radix256_sort_by_key(traits::begin(container), traits::end(container), key, comp);
+    }
+    // ===========================================================================
+
     // 用户接口 - 基数排序（MSD）
     // ===========================================================================
     /**
@@ -586,6 +859,7 @@ namespace ol
      * - 引入阈值优化：当待排序区间长度小于等于16时，自动切换为插入排序
      * - 挖坑填数法替代传统交换，减少元素交换次数
      * - 对相等元素进行特殊处理，平衡左右分区
+     * - 没有递归深度限制，对抗性输入可能退化为O(n²)，通用场景请使用intro_sort
      */
     template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
     void quick_sort(RandomIt first, RandomIt last, const Compare& comp = Compare())
@@ -626,6 +900,334 @@ namespace ol
     }
     // ===========================================================================
 
+    // 用户接口 - 内省排序
+    // ===========================================================================
+    /**
+     * @brief 内省排序（迭代器版本，通用场景推荐使用）
+     * @tparam RandomIt 随机访问迭代器类型
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @note
+     * 算法特性：
+     * - 稳定性：不稳定排序（相等元素可能改变相对顺序）
+     * - 时间复杂度：平均O(n log n)，最坏O(n log n)；已有序/逆序输入接近O(n)，少量不同键值的输入接近O(n·k)
+     * - 空间复杂度：O(log n)，递归深度不超过log2(n)
+     * - 适用场景：通用排序的首选，对管风琴序列、大量重复值等对抗性输入同样稳健
+     *
+     * 实现优化（pattern-defeating quicksort）：
+     * - 深度保护：极不平衡的分区累计超过log2(n)次后切换为堆排序，保证最坏O(n log n)
+     * - 尾递归消除：只递归处理较短的一侧，较长的一侧循环处理，超大数组也不会栈溢出
+     * - 基准选择：长度大于128时九数取中（ninther），否则三数取中；不平衡时打乱部分元素破坏输入模式
+     * - 等值分区：基准与左侧相邻区间的元素相等时，把等于基准的元素一次分出，重复键值不再递归
+     * - 有序检测：分区时未发生交换则尝试有限次数的插入排序收尾
+     * - 无分支分区：算术类型/指针配合std::less/std::greater时使用块分区，避免随机数据上的分支预测失败
+     * - 小区间（少于24个元素）使用插入排序
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    void intro_sort(RandomIt first, RandomIt last, const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "intro_sort requires random access iterators");
+
+        base::intro_sort_base(first, last, comp);
+    }
+
+    /**
+     * @brief 内省排序（容器版本，通用场景推荐使用）
+     * @tparam Container 容器类型（需支持随机访问迭代器）
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param container 待排序的容器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @note
+     * 算法特性：
+     * - 稳定性：不稳定排序（相等元素可能改变相对顺序）
+     * - 时间复杂度：平均O(n log n)，最坏O(n log n)；已有序/逆序输入接近O(n)
+     * - 空间复杂度：O(log n)，递归深度不超过log2(n)
+     * - 适用场景：通用排序的首选，对管风琴序列、大量重复值等对抗性输入同样稳健
+     */
+    template <typename Container, typename Compare = std::less<typename container_traits<Container>::value_type>>
+    void intro_sort(Container& container, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        intro_sort(traits::begin(container), traits::end(container), comp);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 部分排序
+    // ===========================================================================
+    /**
+     * @brief 部分排序（迭代器版本，支持默认比较器）
+     * @tparam RandomIt 随机访问迭代器类型
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param first 起始迭代器
+     * @param middle 排序部分的结束迭代器，排序后[first, middle)为整个区间中排在最前的元素且有序
+     * @param last 结束迭代器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @note
+     * 算法特性：
+     * - 稳定性：不稳定排序；[middle, last)中元素的顺序不确定
+     * - 时间复杂度：k = middle - first，k < n/16时O(n log k)（堆选择），否则平均O(n + k log k)（内省选择+内省排序）
+     * - 空间复杂度：O(log n)
+     * - 适用场景：只需要最前面的k个元素有序（如取前100名），比完整排序快得多
+     * - 与std::partial_sort同名，命名空间ol和std同时引入时请用ol::partial_sort限定调用
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    void partial_sort(RandomIt first, RandomIt middle, RandomIt last, const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "partial_sort requires random access iterators");
+
+        base::partial_sort_base(first, middle, last, comp);
+    }
+
+    /**
+     * @brief 部分排序（容器版本，支持默认比较器）
+     * @tparam Container 容器类型（需支持随机访问迭代器）
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param container 待排序的容器
+     * @param k 需要有序的元素个数，大于等于容器大小时对整个容器排序
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @note 排序后容器前k个元素为整个容器中排在最前的k个元素且有序，其余元素顺序不确定
+     */
+    template <typename Container, typename Compare = std::less<typename container_traits<Container>::value_type>>
+    void partial_sort(Container& container, size_t k, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        auto first = traits::begin(container);
+        auto last = traits::end(container);
+        const size_t n = static_cast<size_t>(last - first);
+        ol::partial_sort(first, first + static_cast<ptrdiff_t>(k < n ? k : n), last, comp);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 选择第n个元素
+    // ===========================================================================
+    /**
+     * @brief 选择第n个元素（迭代器版本，内省选择）
+     * @tparam RandomIt 随机访问迭代器类型
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param first 起始迭代器
+     * @param nth 目标位置，重排后该位置是整个区间排序后应在此处的元素
+     * @param last 结束迭代器；nth == last时不做任何操作
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @note
+     * 算法特性：
+     * - 重排后[first, nth)中的元素都不排在*nth之后，(nth, last)中的元素都不排在*nth之前，两侧内部顺序不确定
+     * - 时间复杂度：平均O(n)，最坏O(n log n)（极不平衡的分区累计超过log2(n)次后改用堆选择）
+     * - 空间复杂度：O(1)
+     * - 适用场景：求中位数、分位数，或把前k个元素分出而不关心它们的顺序
+     * - 与std::nth_element同名，命名空间ol和std同时引入时请用ol::nth_element限定调用
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    void nth_element(RandomIt first, RandomIt nth, RandomIt last, const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "nth_element requires random access iterators");
+
+        base::nth_element_base(first, nth, last, comp);
+    }
+
+    /**
+     * @brief 选择第n个元素（容器版本，内省选择）
+     * @tparam Container 容器类型（需支持随机访问迭代器）
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param container 待处理的容器
+     * @param n 目标位置（从0开始）
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @throw std::invalid_argument 当n大于等于容器大小时抛出
+     */
+    template <typename Container, typename Compare = std::less<typename container_traits<Container>::value_type>>
+    void nth_element(Container& container, size_t n, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        auto first = traits::begin(container);
+        auto last = traits::end(container);
+        if (n >= static_cast<size_t>(last - first))
+            throw std::invalid_argument("n must be less than the container size");
+
+        ol::nth_element(first, first + static_cast<ptrdiff_t>(n), last, comp);
+    }
+    // ===========================================================================
+
+    // 用户接口 - Top-K选择
+    // ===========================================================================
+    /**
+     * @brief 流式Top-K累加器：逐个接收元素，只保留按comp排在最前的k个
+     * @tparam T 元素类型
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less（保留最小的k个；
+     *                 保留最大的k个请使用std::greater）
+     * @note
+     * - 内部是大小不超过k的堆，堆顶是已保留元素中最靠后的一个；新元素只与堆顶比较一次，
+     *   多数元素被直接丢弃，处理n个元素的时间复杂度为O(n log k)，空间复杂度为O(k)
+     * - 非线程安全：多线程时每个线程各自累加，最后用merge()合并，结果与单线程累加相同
+     * - 相等元素之间保留哪一个不确定
+     */
+    template <typename T, typename Compare = std::less<T>>
+    class TopK
+    {
+    private:
+        static constexpr size_t kMaxInitialReserve = 4096; ///< 构造时最多预留的元素个数，更大的k由堆按需增长
+
+        size_t m_k;             ///< 最多保留的元素个数
+        Compare m_comp;         ///< 比较函数对象
+        std::vector<T> m_heap;  ///< 以m_comp为序的大顶堆
+
+    public:
+        /**
+         * @brief 构造函数
+         * @param k 最多保留的元素个数，为0时不保留任何元素，SIZE_MAX表示不限个数
+         * @param comp 比较函数对象
+         * @note 只预先分配min(k, kMaxInitialReserve)个元素的空间，k很大时不会一次性分配
+         */
+        explicit TopK(size_t k, const Compare& comp = Compare()) : m_k(k), m_comp(comp)
+        {
+            m_heap.reserve(std::min(m_k, kMaxInitialReserve));
+        }
+
+        /**
+         * @brief 接收一个元素
+         * @return true-元素被保留，false-元素被丢弃
+         */
+        bool push(const T& value)
+        {
+            return emplace_value(value);
+        }
+
+        bool push(T&& value)
+        {
+            return emplace_value(std::move(value));
+        }
+
+        /**
+         * @brief 接收[first, last)中的所有元素
+         */
+        template <typename InputIt>
+        void push(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first) emplace_value(*first);
+        }
+
+        /**
+         * @brief 合并另一个累加器保留的元素（如其他线程的局部结果）
+         */
+        void merge(const TopK& other)
+        {
+            push(other.m_heap.begin(), other.m_heap.end());
+        }
+
+        void merge(TopK&& other)
+        {
+            if (m_heap.empty() && other.m_k == m_k)
+            {
+                m_heap.swap(other.m_heap);
+            }
+            else
+            {
+                for (T& value : other.m_heap) emplace_value(std::move(value));
+            }
+            other.m_heap.clear();
+        }
+
+        // 已保留的元素个数（不超过k）
+        size_t size() const { return m_heap.size(); }
+
+        // 最多保留的元素个数
+        size_t k() const { return m_k; }
+
+        bool empty() const { return m_heap.empty(); }
+
+        /**
+         * @brief 已保留元素中最靠后的一个（已满k个时，之后的元素必须排在它前面才会被保留）
+         * @note 累加器为空时调用是未定义行为
+         */
+        const T& threshold() const { return m_heap.front(); }
+
+        /**
+         * @brief 返回已保留元素按comp排序后的副本，累加器内容不变
+         */
+        std::vector<T> sorted() const
+        {
+            std::vector<T> result(m_heap);
+            ol::intro_sort(result.begin(), result.end(), m_comp);
+            return result;
+        }
+
+        /**
+         * @brief 取出已保留元素（按comp排序），累加器随后为空，可继续使用
+         */
+        std::vector<T> take_sorted()
+        {
+            std::vector<T> result;
+            result.swap(m_heap);
+            ol::intro_sort(result.begin(), result.end(), m_comp);
+            m_heap.reserve(std::min(m_k, kMaxInitialReserve));
+            return result;
+        }
+
+        void clear() { m_heap.clear(); }
+
+    private:
+        template <typename U>
+        bool emplace_value(U&& value)
+        {
+            if (m_heap.size() < m_k)
+            {
+                m_heap.push_back(std::forward<U>(value));
+                std::push_heap(m_heap.begin(), m_heap.end(), m_comp);
+                return true;
+            }
+            if (m_k == 0 || !m_comp(value, m_heap.front())) return false;
+
+            // 替换堆顶后下沉一次
+            m_heap.front() = std::forward<U>(value);
+            base::heapify_base(m_heap.begin(), m_heap.size(), 0, m_comp);
+            return true;
+        }
+    };
+
+    /**
+     * @brief 求区间中按comp排在最前的k个元素（迭代器版本，不修改输入）
+     * @tparam InputIt 输入迭代器类型（只需单次遍历，可用于流式数据）
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less（取最小的k个）
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param k 需要的元素个数
+     * @param comp 比较函数对象
+     * @return 按comp排序的至多k个元素
+     * @note 时间复杂度O(n log k)，额外空间O(k)；需要原地处理且允许修改输入时可使用partial_sort
+     */
+    template <typename InputIt, typename Compare = std::less<typename std::iterator_traits<InputIt>::value_type>>
+    std::vector<typename std::iterator_traits<InputIt>::value_type> top_k(InputIt first, InputIt last, size_t k,
+                                                                        const Compare& comp = Compare())
+    {
+        TopK<typename std::iterator_traits<InputIt>::value_type, Compare> acc(k, comp);
+        acc.push(first, last);
+        return acc.take_sorted();
+    }
+
+    /**
+     * @brief 求容器中按comp排在最前的k个元素（容器版本，不修改输入）
+     * @return 按comp排序的至多k个元素
+     */
+    template <typename Container, typename Compare = std::less<base::range_value_t<const Container>>>
+    std::vector<base::range_value_t<const Container>> top_k(const Container& container, size_t k,
+                                                            const Compare& comp = Compare())
+    {
+        return top_k(std::begin(container), std::end(container), k, comp);
+    }
+    // ===========================================================================
+
     // 用户接口 - 桶排序
     // ===========================================================================
     /**
@@ -745,6 +1347,205 @@ namespace ol
         using traits = container_traits<Container>;
         bucket_sort(traits::begin(container), traits::end(container), num_buckets, comp);
     }
+
+    /**
+     * @brief 桶排序（迭代器版本，适用于浮点数，复用工作区）
+     * @param workspace 工作区：桶偏移数组与扁平分发缓冲区，容量足够时不做任何堆分配
+     * @note 结果与不带工作区的版本完全相同；所有桶共用一块缓冲区（先计数、前缀和定位、再分发），
+     *       不再为每个桶单独分配std::vector
+     * @throw std::invalid_argument 当桶数量小于1或min_val >= max_val时抛出
+     */
+    template <typename RandomIt, typename T, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    typename std::enable_if<
+        std::is_floating_point<typename std::iterator_traits<RandomIt>::value_type>::value,
+        void>::type
+    bucket_sort(RandomIt first, RandomIt last, SortWorkspace<T>& workspace,
+                size_t num_buckets = 10,
+                double min_val = 0.0, double max_val = 1.0,
+                const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "bucket_sort requires random access iterators");
+        static_assert(std::is_same_v<T, typename std::iterator_traits<RandomIt>::value_type>,
+                      "SortWorkspace element type must match the range value type");
+
+        if (num_buckets < 1)
+            throw std::invalid_argument("Number of buckets must be at least 1");
+        if (min_val >= max_val)
+            throw std::invalid_argument("min_val must be less than max_val");
+
+        base::bucket_sort_float_base(first, last, num_buckets, min_val, max_val, workspace.counts, workspace.buffer, comp);
+    }
+
+    /**
+     * @brief 桶排序（迭代器版本，适用于整数，复用工作区）
+     * @param workspace 工作区：桶偏移数组与扁平分发缓冲区，容量足够时不做任何堆分配
+     * @note 结果与不带工作区的版本完全相同
+     * @throw std::invalid_argument 当桶数量小于1时抛出
+     */
+    template <typename RandomIt, typename T, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    typename std::enable_if<
+        std::is_integral<typename std::iterator_traits<RandomIt>::value_type>::value,
+        void>::type
+    bucket_sort(RandomIt first, RandomIt last, SortWorkspace<T>& workspace,
+                size_t num_buckets = 10,
+                const Compare& comp = Compare())
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "bucket_sort requires random access iterators");
+        static_assert(std::is_same_v<T, typename std::iterator_traits<RandomIt>::value_type>,
+                      "SortWorkspace element type must match the range value type");
+
+        if (num_buckets < 1)
+            throw std::invalid_argument("Number of buckets must be at least 1");
+
+        base::bucket_sort_int_base(first, last, num_buckets, workspace.counts, workspace.buffer, comp);
+    }
+
+    /**
+     * @brief 桶排序（容器版本，适用于浮点数，复用工作区）
+     */
+    template <typename Container, typename T, typename Compare = std::less<T>>
+    typename std::enable_if<std::is_floating_point<T>::value, void>::type
+    bucket_sort(Container& container, SortWorkspace<T>& workspace,
+                size_t num_buckets = 10,
+                double min_val = 0.0, double max_val = 1.0,
+                const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        bucket_sort(traits::begin(container), traits::end(container), workspace, num_buckets, min_val, max_val, comp);
+    }
+
+    /**
+     * @brief 桶排序（容器版本，适用于整数，复用工作区）
+     */
+    template <typename Container, typename T, typename Compare = std::less<T>>
+    typename std::enable_if<std::is_integral<T>::value, void>::type
+    bucket_sort(Container& container, SortWorkspace<T>& workspace, size_t num_buckets = 10, const Compare& comp = Compare())
+    {
+        using traits = container_traits<Container>;
+        bucket_sort(traits::begin(container), traits::end(container), workspace, num_buckets, comp);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 并行归并排序
+    // ===========================================================================
+    /**
+     * @brief 并行归并排序（迭代器版本，支持默认比较器）
+     * @tparam RandomIt 随机访问迭代器类型
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @param thread_num 最多使用的线程数（含调用线程），0表示使用硬件并发数
+     * @note
+     * 算法特性：
+     * - 稳定性：稳定排序（相等元素保持原有顺序）
+     * - 时间复杂度：O(n log n)，p个线程时约为O(n log n / p)
+     * - 空间复杂度：O(n)，需要与输入等长的缓冲区
+     * - 适用场景：大规模数据（数十万元素以上）且需要稳定排序的场景；元素少于8192个时退化为串行std::stable_sort
+     *
+     * 实现说明：
+     * - 递归二分区间，左右子区间在不同线程上排序，分叉层数为ceil(log2(线程数))
+     * - 合并同样并行：按较长区间的中点二分切分两个有序区间，两半独立合并
+     * - 数据区间与缓冲区逐层交替作为输出，不需要每层把结果拷贝回原区间
+     * - 线程由std::async临时创建，不依赖线程池；比较器抛出的异常会传播给调用者，此时区间内容未指定
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    void parallel_merge_sort(RandomIt first, RandomIt last, const Compare& comp = Compare(), size_t thread_num = 0)
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "parallel_merge_sort requires random access iterators");
+
+        base::parallel_merge_sort(first, last, comp, thread_num);
+    }
+
+    /**
+     * @brief 并行归并排序（容器版本，支持默认比较器）
+     * @tparam Container 容器类型（需支持随机访问迭代器）
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param container 待排序的容器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @param thread_num 最多使用的线程数（含调用线程），0表示使用硬件并发数
+     * @note
+     * 算法特性：
+     * - 稳定性：稳定排序（相等元素保持原有顺序）
+     * - 时间复杂度：O(n log n)，p个线程时约为O(n log n / p)
+     * - 空间复杂度：O(n)，需要与输入等长的缓冲区
+     * - 适用场景：大规模数据（数十万元素以上）且需要稳定排序的场景；元素少于8192个时退化为串行std::stable_sort
+     */
+    template <typename Container, typename Compare = std::less<typename container_traits<Container>::value_type>>
+    void parallel_merge_sort(Container& container, const Compare& comp = Compare(), size_t thread_num = 0)
+    {
+        using traits = container_traits<Container>;
+        parallel_merge_sort(traits::begin(container), traits::end(container), comp, thread_num);
+    }
+    // ===========================================================================
+
+    // 用户接口 - 并行样本排序
+    // ===========================================================================
+    /**
+     * @brief 并行样本排序（迭代器版本，支持默认比较器）
+     * @tparam RandomIt 随机访问迭代器类型
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param first 起始迭代器
+     * @param last 结束迭代器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @param thread_num 最多使用的线程数（含调用线程），0表示使用硬件并发数
+     * @note
+     * 算法特性：
+     * - 稳定性：不稳定排序（相等元素可能改变相对顺序）
+     * - 时间复杂度：期望O(n log n / p)，p为线程数；分隔元素选取不均或大量重复值时个别桶偏大
+     * - 空间复杂度：O(n)，需要与输入等长的缓冲区及每个元素一个桶编号
+     * - 适用场景：超大规模数据、不要求稳定性的场景；元素少于8192个时退化为串行intro_sort
+     *
+     * 实现说明：
+     * - 过采样选出p-1个分隔元素，把输入划分为p个值域互不重叠的桶
+     * - 分类、分发、桶内排序三个阶段都由p个线程并行完成，每个元素只被移动两次，
+     *   没有归并排序逐层合并的开销
+     * - 线程由std::async临时创建，不依赖线程池；比较器抛出的异常会传播给调用者，此时区间内容未指定
+     */
+    template <typename RandomIt, typename Compare = std::less<typename std::iterator_traits<RandomIt>::value_type>>
+    void parallel_sample_sort(RandomIt first, RandomIt last, const Compare& comp = Compare(), size_t thread_num = 0)
+    {
+        static_assert(
+            std::is_same_v<
+                typename std::iterator_traits<RandomIt>::iterator_category,
+                std::random_access_iterator_tag>,
+            "parallel_sample_sort requires random access iterators");
+
+        base::parallel_sample_sort(first, last, comp, thread_num);
+    }
+
+    /**
+     * @brief 并行样本排序（容器版本，支持默认比较器）
+     * @tparam Container 容器类型（需支持随机访问迭代器）
+     * @tparam Compare 比较函数类型，需满足严格弱序，默认使用std::less
+     * @param container 待排序的容器
+     * @param comp 比较函数对象，返回true表示第一个参数应排在前面
+     * @param thread_num 最多使用的线程数（含调用线程），0表示使用硬件并发数
+     * @note
+     * 算法特性：
+     * - 稳定性：不稳定排序（相等元素可能改变相对顺序）
+     * - 时间复杂度：期望O(n log n / p)，p为线程数
+     * - 空间复杂度：O(n)，需要与输入等长的缓冲区及每个元素一个桶编号
+     * - 适用场景：超大规模数据、不要求稳定性的场景；元素少于8192个时退化为串行intro_sort
+     */
+    template <typename Container, typename Compare = std::less<typename container_traits<Container>::value_type>>
+    void parallel_sample_sort(Container& container, const Compare& comp = Compare(), size_t thread_num = 0)
+    {
+        using traits = container_traits<Container>;
+        parallel_sample_sort(traits::begin(container), traits::end(container), comp, thread_num);
+    }
     // ===========================================================================
 
     // 打印容器（调试用）
@@ -0,0 +1,199 @@
+#include "ol_Future.h"
+#include "ol_ThreadPool.h"
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ol;
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+int main()
+{
+    std::cout << "=== Promise/Future基本测试 ===" << std::endl;
+    {
+        Promise<int> promise;
+        Future<int> future = promise.getFuture();
+        TEST(future.valid() && !future.isReady());
+        promise.setValue(42);
+        TEST(future.isReady());
+        TEST(future.get() == 42);
+        TEST(!future.valid());
+
+        Future<std::string> broken;
+        {
+            Promise<std::string> dropped;
+            broken = dropped.getFuture();
+        }
+        bool threw = false;
+        try
+        {
+            broken.get();
+        }
+        catch (const std::future_error& e)
+        {
+            threw = e.code() == std::future_errc::broken_promise;
+        }
+        TEST(threw);
+    }
+
+    std::cout << "\n=== then延续测试（无执行器） ===" << std::endl;
+    {
+        Promise<int> promise;
+        Future<std::string> chained = promise.getFuture()
+                                          .then([](int v)
+                                                { return v * 2; })
+                                          .then([](int v)
+                                                { return std::to_string(v); });
+        promise.setValue(21);
+        TEST(chained.get() == "42");
+
+        Future<int> failed = makeReadyFuture(1)
+                                 .then([](int) -> int
+                                       { throw std::runtime_error("boom"); })
+                                 .then([](int v)
+                                       { return v + 1; });
+        bool threw = false;
+        try
+        {
+            failed.get();
+        }
+        catch (const std::runtime_error& e)
+        {
+            threw = std::string(e.what()) == "boom";
+        }
+        TEST(threw);
+
+        int hits = 0;
+        makeReadyFuture().then([&hits]()
+                               { ++hits; })
+            .get();
+        TEST(hits == 1);
+    }
+
+    std::cout << "\n=== 线程池集成测试 ===" << std::endl;
+    {
+        ThreadPool<false> pool(2);
+
+        Future<int> result = pool.submitAsync([](int a, int b)
+                                              { return a + b; },
+                                              1, 2)
+                                 .then([](int v)
+                                       { return v * 10; });
+        TEST(result.get() == 30);
+
+        // 延续在线程池的工作线程上执行
+        std::thread::id caller = std::this_thread::get_id();
+        std::thread::id ranOn = pool.submitAsync([]() {})
+                                    .then([]()
+                                          { return std::this_thread::get_id(); })
+                                    .get();
+        TEST(ranOn != caller);
+
+        // 指定执行器
+        Future<int> onExecutor = makeReadyFuture(5).then(pool.executor(TaskPriority::kHigh), [](int v)
+                                                          { return v + 1; });
+        TEST(onExecutor.get() == 6);
+    }
+
+    std::cout << "\n=== 单线程扇出/扇入测试（不阻塞工作线程） ===" << std::endl;
+    {
+        ThreadPool<false> pool(1);
+        const int N = 16;
+
+        // 在唯一的工作线程内扇出N个任务并汇聚：若延续阻塞在get()上，单线程池必然死锁
+        Future<long long> total = pool.submitAsync([&pool]()
+                                                   {
+                                                       std::vector<Future<long long>> parts;
+                                                       for (int i = 1; i <= N; ++i)
+                                                           parts.push_back(pool.submitAsync([i]() { return (long long)i * i; }));
+                                                       return parts; })
+                                      .then([](std::vector<Future<long long>> parts)
+                                            { return when_all(parts); })
+                                      .get()
+                                      .then([](std::vector<Future<long long>> parts)
+                                            {
+                                                long long sum = 0;
+                                                for (auto& part : parts) sum += part.get();
+                                                return sum; });
+        TEST(total.get() == (long long)N * (N + 1) * (2 * N + 1) / 6);
+    }
+
+    std::cout << "\n=== when_all/when_any测试 ===" << std::endl;
+    {
+        ThreadPool<false> pool(4);
+
+        std::vector<Future<int>> futures;
+        for (int i = 0; i < 8; ++i)
+            futures.push_back(pool.submitAsync([i]()
+                                               { return i; }));
+        std::vector<Future<int>> all = when_all(futures).get();
+        TEST(all.size() == 8);
+        int sum = 0;
+        for (auto& f : all) sum += f.get();
+        TEST(sum == 28);
+
+        auto mixed = when_all(pool.submitAsync([]()
+                                               { return 1; }),
+                              pool.submitAsync([]()
+                                               { return std::string("two"); }),
+                              pool.submitAsync([]() {}))
+                         .get();
+        TEST(std::get<0>(mixed).get() == 1);
+        TEST(std::get<1>(mixed).get() == "two");
+        std::get<2>(mixed).get();
+
+        Promise<int> never, winner;
+        std::vector<Future<int>> racers;
+        racers.push_back(never.getFuture());
+        racers.push_back(winner.getFuture());
+        Future<WhenAnyResult<std::vector<Future<int>>>> any = when_any(racers);
+        TEST(!any.isReady());
+        winner.setValue(7);
+        WhenAnyResult<std::vector<Future<int>>> first = any.get();
+        TEST(first.index == 1);
+        TEST(first.futures[1].get() == 7);
+        TEST(!first.futures[0].isReady());
+
+        std::vector<Future<int>> none;
+        TEST(when_all(none).get().empty());
+        TEST(when_any(none).get().index == static_cast<size_t>(-1));
+    }
+
+    std::cout << "\n=== 提交失败测试 ===" << std::endl;
+    {
+        ThreadPool<false> pool(1);
+        pool.stop();
+        Future<int> rejected = pool.submitAsync([]()
+                                                { return 1; });
+        bool threw = false;
+        try
+        {
+            rejected.get();
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        TEST(threw);
+    }
+
+    std::cout << "\nAll tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,151 @@
+#include "ol_MPMCQueue.h"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ol;
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+// 统计存活对象数的元素类型
+struct Tracked
+{
+    static std::atomic_int alive;
+    int value;
+
+    explicit Tracked(int v = 0) noexcept : value(v) { ++alive; }
+    Tracked(const Tracked& other) noexcept : value(other.value) { ++alive; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++alive; }
+    Tracked& operator=(const Tracked&) noexcept = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() { --alive; }
+};
+std::atomic_int Tracked::alive{0};
+
+int main()
+{
+    std::cout << "=== 基本操作测试 ===" << std::endl;
+    {
+        MPMCQueue<int> queue(4);
+        TEST(queue.capacity() == 4);
+        TEST(queue.empty());
+
+        int v = -1;
+        TEST(!queue.tryPop(v) && v == -1);
+        for (int i = 0; i < 4; ++i) TEST(queue.tryPush(i));
+        TEST(!queue.tryPush(4));
+        TEST(queue.size() == 4);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            TEST(queue.tryPop(v));
+            TEST(v == i);
+        }
+        TEST(queue.empty());
+
+        bool threw = false;
+        try
+        {
+            MPMCQueue<int> invalid(0);
+        }
+        catch (const std::invalid_argument&)
+        {
+            threw = true;
+        }
+        TEST(threw);
+    }
+
+    std::cout << "\n=== 非2的幂容量与回绕测试 ===" << std::endl;
+    {
+        MPMCQueue<int> queue(3);
+        int v = 0, expected = 0, next = 0;
+        for (int round = 0; round < 100; ++round)
+        {
+            while (queue.tryPush(next)) ++next;
+            TEST(queue.size() == 3);
+            TEST(queue.tryPop(v) && v == expected++);
+            TEST(queue.tryPop(v) && v == expected++);
+        }
+    }
+
+    std::cout << "\n=== 只可移动类型与析构测试 ===" << std::endl;
+    {
+        MPMCQueue<std::unique_ptr<int>> queue(2);
+        auto p = std::make_unique<int>(7);
+        TEST(queue.tryPush(std::move(p)));
+        TEST(!p);
+        auto full = std::make_unique<int>(8);
+        TEST(queue.tryPush(std::make_unique<int>(9)));
+        TEST(!queue.tryPush(std::move(full)));
+        TEST(full && *full == 8); // 入队失败时参数保持不变
+
+        std::unique_ptr<int> out;
+        TEST(queue.tryPop(out) && *out == 7);
+
+        {
+            MPMCQueue<Tracked> tracked(8);
+            for (int i = 0; i < 5; ++i) tracked.tryEmplace(i);
+            Tracked t;
+            tracked.tryPop(t);
+            TEST(Tracked::alive == 5);
+        }
+        TEST(Tracked::alive == 0);
+    }
+
+    std::cout << "\n=== 多生产者多消费者测试 ===" << std::endl;
+    {
+        const int PRODUCERS = 4, CONSUMERS = 4, PER_PRODUCER = 50000;
+        MPMCQueue<long long> queue(1000);
+        std::atomic_llong sum{0};
+        std::atomic_int consumed{0};
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < PRODUCERS; ++p)
+            threads.emplace_back([&queue, p]()
+                                 {
+                                     for (int i = 1; i <= PER_PRODUCER; ++i)
+                                         while (!queue.tryPush((long long)p * PER_PRODUCER + i)) std::this_thread::yield(); });
+        for (int c = 0; c < CONSUMERS; ++c)
+            threads.emplace_back([&]()
+                                 {
+                                     long long v;
+                                     while (consumed.load() < PRODUCERS * PER_PRODUCER)
+                                     {
+                                         if (queue.tryPop(v))
+                                         {
+                                             sum += v;
+                                             ++consumed;
+                                         }
+                                         else
+                                         {
+                                             std::this_thread::yield();
+                                         }
+                                     } });
+        for (auto& t : threads) t.join();
+
+        long long n = (long long)PRODUCERS * PER_PRODUCER;
+        TEST(consumed.load() == n);
+        TEST(sum.load() == n * (n + 1) / 2);
+        TEST(queue.empty());
+    }
+
+    std::cout << "\nAll tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include "ol_Task.h"
+#include <array>
+#include <cassert>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+
+using namespace ol;
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+// 统计构造/析构次数的可调用对象
+struct Counted
+{
+    static int alive;
+    int* hits;
+
+    explicit Counted(int* h) : hits(h) { ++alive; }
+    Counted(const Counted& other) : hits(other.hits) { ++alive; }
+    Counted(Counted&& other) noexcept : hits(other.hits) { ++alive; }
+    ~Counted() { --alive; }
+
+    void operator()() { ++*hits; }
+};
+int Counted::alive = 0;
+
+int g_calls = 0;
+void freeFunc() { ++g_calls; }
+
+int main()
+{
+    std::cout << "=== 基本测试 ===" << std::endl;
+    TEST(sizeof(Task) == 64);
+
+    Task empty;
+    TEST(!empty);
+    bool threw = false;
+    try
+    {
+        empty();
+    }
+    catch (const std::bad_function_call&)
+    {
+        threw = true;
+    }
+    TEST(threw);
+
+    int value = 0;
+    Task task([&value]()
+              { value += 1; });
+    TEST(static_cast<bool>(task));
+    task();
+    task();
+    TEST(value == 2);
+
+    std::cout << "\n=== 内联/堆存储测试 ===" << std::endl;
+    auto small = [&value]()
+    { ++value; };
+    std::array<char, 128> payload{};
+    auto big = [&value, payload]()
+    { value += payload[0] + 1; };
+    TEST(Task::isInlinable<decltype(small)>());
+    TEST(!Task::isInlinable<decltype(big)>());
+    TEST(Task::isInlinable<std::packaged_task<int()>>());
+
+    Task bigTask(big);
+    value = 0;
+    bigTask();
+    TEST(value == 1);
+
+    std::cout << "\n=== 移动语义测试 ===" << std::endl;
+    int hits = 0;
+    {
+        Task a{Counted(&hits)};
+        TEST(Counted::alive == 1);
+        Task b(std::move(a));
+        TEST(!a && static_cast<bool>(b));
+        TEST(Counted::alive == 1);
+        b();
+        Task c;
+        c = std::move(b);
+        c();
+        TEST(hits == 2);
+        c = nullptr;
+        TEST(Counted::alive == 0);
+
+        Task d{Counted(&hits)};
+        Task e(std::move(bigTask));
+        d.swap(e);
+        value = 0;
+        d();
+        e();
+        TEST(value == 1 && hits == 3);
+    }
+    TEST(Counted::alive == 0);
+
+    std::cout << "\n=== 只可移动对象测试 ===" << std::endl;
+    std::packaged_task<int()> pt([]()
+                                 { return 42; });
+    std::future<int> future = pt.get_future();
+    Task ptTask([pt = std::move(pt)]() mutable
+                { pt(); });
+    ptTask();
+    TEST(future.get() == 42);
+
+    auto ptr = std::make_unique<int>(7);
+    Task uniqueTask([p = std::move(ptr), &value]()
+                    { value = *p; });
+    uniqueTask();
+    TEST(value == 7);
+
+    std::cout << "\n=== 队列存储测试 ===" << std::endl;
+    std::queue<Task> queue;
+    value = 0;
+    for (int i = 0; i < 100; ++i)
+        queue.push([&value, i]()
+                   { value += i; });
+    while (!queue.empty())
+    {
+        Task t = std::move(queue.front());
+        queue.pop();
+        t();
+    }
+    TEST(value == 4950);
+
+    std::cout << "\n=== 空可调用对象测试 ===" << std::endl;
+    Task nullFuncPtr((void (*)())nullptr);
+    TEST(!nullFuncPtr); // 空函数指针构造出空任务，ThreadPool的if (task)会跳过它
+    Task emptyFunction(std::function<void()>{});
+    TEST(!emptyFunction); // 空std::function构造出空任务
+    Task funcPtr(&freeFunc);
+    TEST(static_cast<bool>(funcPtr));
+    funcPtr();
+    Task function{std::function<void()>(&freeFunc)};
+    TEST(static_cast<bool>(function));
+    function();
+    TEST(g_calls == 2);
+
+    std::cout << "\nAll tests passed!" << std::endl;
+    return 0;
+}
@@ -1,11 +1,16 @@
 #include "ol_ThreadPool.h"
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <mutex>
 #include <numeric>
 #include <string>
 #include <type_traits>
+#include <thread>
 #include <vector>
 #include <assert.h>
 
@@ -16,6 +21,17 @@
 #include <windows.h>
 #endif
 
+// 不受NDEBUG影响的检查：Release构建下同样生效，失败时打印位置和条件并终止进程
+#define CHECK(condition)                                                                    \
+    do                                                                                      \
+    {                                                                                       \
+        if (!(condition))                                                                   \
+        {                                                                                   \
+            fprintf(stderr, "Check failed at %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            std::abort();                                                                   \
+        }                                                                                   \
+    } while (0)
+
 // 全局输出互斥锁，确保多线程输出不交错
 std::mutex g_printMutex;
 
@@ -465,6 +481,464 @@ void testFixedStopBehavior(size_t threadNum, size_t maxQueueSize)
     assert(!repeatStopPool.isRunning() && "重复stop() 状态错误");
 }
 
+// 固定模式工作窃取测试
+void testFixedWorkStealing(size_t threadNum, size_t maxQueueSize)
+{
+    const std::string poolType = "固定模式(工作窃取)";
+
+    // 测试1：外部提交的大量短任务（走共享注入队列）
+    safePrint("\n=== %s 外部提交短任务测试 ===\n", poolType.c_str());
+    std::function<void(int)> spawn; // 先于线程池定义，保证线程池析构（等待工作线程退出）时仍然有效
+    ol::ThreadPool<false> pool(threadNum, 0, true);
+    std::atomic_int counter{0};
+    const int SHORT_TASK_COUNT = 10000;
+    for (int i = 0; i < SHORT_TASK_COUNT; ++i)
+    {
+        bool success = pool.addTask([&counter]()
+                                    { counter.fetch_add(1, std::memory_order_relaxed); });
+        CHECK(success && "工作窃取模式任务添加失败");
+    }
+
+    // 测试2：任务内部递归派生子任务（走本地队列，空闲线程窃取）
+    safePrint("\n=== %s 任务内派生子任务测试 ===\n", poolType.c_str());
+    std::atomic_int spawned{0};
+    const int FAN_OUT = 8;
+    spawn = [&](int depth)
+    {
+        spawned.fetch_add(1, std::memory_order_relaxed);
+        if (depth == 0) return;
+        for (int i = 0; i < FAN_OUT; ++i)
+            pool.addTask([&spawn, depth]()
+                         { spawn(depth - 1); });
+    };
+    pool.addTask([&spawn]()
+                 { spawn(3); });
+    const int SPAWN_EXPECTED = 1 + 8 + 64 + 512;
+
+    // 测试3：带返回值任务
+    std::vector<std::future<long long>> sumFutures;
+    for (int i = 0; i < 8; ++i)
+        sumFutures.emplace_back(pool.submitTask(sumRange, i * 1000, i * 1000 + 999).second);
+    for (int i = 0; i < 8; ++i)
+    {
+        long long start = i * 1000, end = start + 999;
+        CHECK(sumFutures[i].get() == (start + end) * (end - start + 1) / 2 && "工作窃取模式区间求和结果错误");
+    }
+
+    for (int wait_ms = 0; wait_ms < 5000 && (counter.load() < SHORT_TASK_COUNT || spawned.load() < SPAWN_EXPECTED); wait_ms += 10)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    safePrint("短任务完成 %d 个（预期%d），派生任务完成 %d 个（预期%d）\n",
+              counter.load(), SHORT_TASK_COUNT, spawned.load(), SPAWN_EXPECTED);
+    CHECK(counter.load() == SHORT_TASK_COUNT && "工作窃取模式短任务未全部执行");
+    CHECK(spawned.load() == SPAWN_EXPECTED && "工作窃取模式派生任务未全部执行");
+    CHECK(pool.getTaskNum() == 0 && "工作窃取模式任务未执行完毕");
+
+    // 测试4：队列满策略在工作窃取模式下依然有效
+    safePrint("\n=== %s 队列满策略测试 ===\n", poolType.c_str());
+    ol::ThreadPool<false> boundedPool(threadNum, maxQueueSize, true);
+    boundedPool.setRejectPolicy();
+    int rejected = 0;
+    for (int i = 0; i < (int)(threadNum + maxQueueSize) * 2; ++i)
+    {
+        if (!boundedPool.addTask(std::bind(longRunningTask, i))) ++rejected;
+    }
+    safePrint("拒绝策略：被拒绝 %d 个任务\n", rejected);
+    CHECK(rejected > 0 && "工作窃取模式拒绝策略未生效");
+
+    boundedPool.setTimeoutPolicy(std::chrono::milliseconds(2000));
+    auto [success, future] = boundedPool.submitTask(add1000, 1);
+    CHECK(success && "工作窃取模式超时策略任务添加失败");
+    CHECK(future.get() == 1001 && "工作窃取模式超时策略结果错误");
+}
+
+// 固定模式批量提交测试
+void testFixedBatchSubmit(size_t threadNum, size_t maxQueueSize)
+{
+    const std::string poolType = "固定模式";
+
+    // 测试1：addTasks批量添加无返回值任务
+    safePrint("\n=== %s 批量添加任务测试 ===\n", poolType.c_str());
+    ol::ThreadPool<false> pool(threadNum);
+    std::atomic_int counter{0};
+    std::vector<std::function<void()>> tasks;
+    const int BATCH_COUNT = 1000;
+    for (int i = 0; i < BATCH_COUNT; ++i)
+        tasks.emplace_back([&counter]()
+                           { counter.fetch_add(1, std::memory_order_relaxed); });
+    size_t added = pool.addTasks(tasks);
+    CHECK(added == BATCH_COUNT && "addTasks批量添加数量错误");
+
+    // 测试2：submitBatch批量提交带返回值任务
+    safePrint("\n=== %s 批量提交带返回值任务测试 ===\n", poolType.c_str());
+    std::vector<std::function<int()>> calcs;
+    for (int i = 0; i < 100; ++i)
+        calcs.emplace_back([i]()
+                           { return i * i; });
+    auto [submitted, futures] = pool.submitBatch(calcs.begin(), calcs.end());
+    CHECK(submitted == 100 && futures.size() == 100 && "submitBatch批量提交数量错误");
+    for (int i = 0; i < 100; ++i)
+        CHECK(futures[i].get() == i * i && "submitBatch计算结果错误");
+
+    for (int wait_ms = 0; wait_ms < 5000 && counter.load() < BATCH_COUNT; wait_ms += 10)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    safePrint("批量任务完成 %d 个（预期%d）\n", counter.load(), BATCH_COUNT);
+    CHECK(counter.load() == BATCH_COUNT && "批量任务未全部执行");
+
+    // 测试3：队列满时批量提交（拒绝策略只入队前若干个，其余future携带异常）
+    safePrint("\n=== %s 批量提交队列满测试 ===\n", poolType.c_str());
+    ol::ThreadPool<false> boundedPool(threadNum, maxQueueSize);
+    boundedPool.setRejectPolicy();
+    std::vector<std::function<int()>> slowCalcs;
+    const size_t SLOW_COUNT = (threadNum + maxQueueSize) * 2;
+    for (size_t i = 0; i < SLOW_COUNT; ++i)
+        slowCalcs.emplace_back([i]()
+                               { std::this_thread::sleep_for(std::chrono::milliseconds(100)); return (int)i; });
+    auto [boundedAdded, boundedFutures] = boundedPool.submitBatch(slowCalcs);
+    safePrint("拒绝策略：批量入队 %zu 个（共%zu个）\n", boundedAdded, SLOW_COUNT);
+    CHECK(boundedAdded >= maxQueueSize && boundedAdded < SLOW_COUNT && "批量提交拒绝策略入队数量错误");
+    for (size_t i = 0; i < SLOW_COUNT; ++i)
+    {
+        try
+        {
+            int result = boundedFutures[i].get();
+            CHECK(result == (int)i && i < boundedAdded && "批量提交结果错误");
+        }
+        catch (const std::runtime_error&)
+        {
+            CHECK(i >= boundedAdded && "已入队的任务不应携带异常");
+        }
+    }
+
+    // 测试4：阻塞策略下批量提交超过容量的任务应全部入队
+    boundedPool.setBlockPolicy();
+    counter = 0;
+    std::vector<std::function<void()>> blockTasks(SLOW_COUNT, [&counter]()
+                                                  { counter.fetch_add(1, std::memory_order_relaxed); });
+    added = boundedPool.addTasks(blockTasks);
+    CHECK(added == SLOW_COUNT && "阻塞策略批量添加数量错误");
+    for (int wait_ms = 0; wait_ms < 5000 && counter.load() < (int)SLOW_COUNT; wait_ms += 10)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    CHECK(counter.load() == (int)SLOW_COUNT && "阻塞策略批量任务未全部执行");
+}
+
+// 固定模式任务优先级测试
+void testFixedTaskPriority()
+{
+    const std::string poolType = "固定模式";
+    safePrint("\n=== %s 任务优先级测试 ===\n", poolType.c_str());
+
+    // 单线程线程池：先用一个闸门任务占住线程，再按 低 -> 普通 -> 高 的顺序入队
+    ol::ThreadPool<false> pool(1);
+    std::promise<void> gate, gateEntered;
+    std::shared_future<void> gateFuture = gate.get_future().share();
+    pool.addTask([gateFuture, &gateEntered]()
+                 { gateEntered.set_value(); gateFuture.wait(); });
+    gateEntered.get_future().wait();
+
+    std::mutex orderMutex;
+    std::vector<char> order;
+    auto record = [&](char tag)
+    {
+        return [&, tag]()
+        {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            order.push_back(tag);
+        };
+    };
+
+    const int LOW_COUNT = 20, NORMAL_COUNT = 40, HIGH_COUNT = 4;
+    for (int i = 0; i < LOW_COUNT; ++i) pool.addTask(record('L'), ol::TaskPriority::kLow);
+    for (int i = 0; i < NORMAL_COUNT; ++i) pool.addTask(record('N'));
+    std::vector<std::future<int>> highFutures;
+    for (int i = 0; i < HIGH_COUNT; ++i)
+        highFutures.emplace_back(pool.submitTask(ol::TaskPriority::kHigh, [&, i]()
+                                                 { record('H')(); return i; })
+                                     .second);
+    CHECK(pool.getTaskNum() == LOW_COUNT + NORMAL_COUNT + HIGH_COUNT && "优先级通道任务数统计错误");
+
+    gate.set_value();
+    for (int i = 0; i < HIGH_COUNT; ++i)
+    {
+        int result = highFutures[i].get();
+        CHECK(result == i && "高优先级任务结果错误");
+    }
+    for (int wait_ms = 0; wait_ms < 5000 && pool.getTaskNum() > 0; wait_ms += 10)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    std::lock_guard<std::mutex> lock(orderMutex);
+    std::string sequence(order.begin(), order.end());
+    safePrint("执行顺序: %s\n", sequence.c_str());
+    CHECK(order.size() == LOW_COUNT + NORMAL_COUNT + HIGH_COUNT && "优先级任务未全部执行");
+    CHECK(sequence.substr(0, HIGH_COUNT) == std::string(HIGH_COUNT, 'H') && "高优先级任务未被优先执行");
+
+    // 防饥饿：低优先级任务不应全部排在普通任务之后
+    size_t firstLow = sequence.find('L');
+    size_t lastNormal = sequence.rfind('N');
+    CHECK(firstLow < lastNormal && "低优先级任务被饿死");
+}
+
+// 固定模式定时任务测试
+void testFixedScheduling()
+{
+    const std::string poolType = "固定模式";
+    safePrint("\n=== %s 定时任务测试 ===\n", poolType.c_str());
+
+    ol::ThreadPool<false> pool(2);
+
+    // 延迟任务：到期后执行一次
+    std::promise<std::chrono::steady_clock::time_point> firedPromise;
+    auto firedFuture = firedPromise.get_future();
+    auto start = std::chrono::steady_clock::now();
+    ol::TimerHandle once = pool.scheduleAfter(std::chrono::milliseconds(50), [&firedPromise]()
+                                              { firedPromise.set_value(std::chrono::steady_clock::now()); });
+    CHECK(once.valid() && "延迟任务提交失败");
+    auto firedAt = firedFuture.get();
+    CHECK(firedAt - start >= std::chrono::milliseconds(50) && "延迟任务提前执行");
+    safePrint("延迟任务执行延迟: %lldms\n",
+              (long long)std::chrono::duration_cast<std::chrono::milliseconds>(firedAt - start).count());
+
+    // 取消的延迟任务不执行
+    std::atomic_int cancelledRuns{0};
+    ol::TimerHandle cancelled = pool.scheduleAfter(std::chrono::milliseconds(50), [&cancelledRuns]()
+                                                   { cancelledRuns++; });
+    bool cancelOk = cancelled.cancel();
+    CHECK(cancelOk && cancelled.isCancelled() && "取消延迟任务失败");
+    cancelOk = cancelled.cancel();
+    CHECK(!cancelOk && "重复取消应返回false");
+
+    // 周期任务：重复执行，取消后停止
+    std::atomic_int ticks{0};
+    ol::TimerHandle every = pool.scheduleEvery(std::chrono::milliseconds(10), [&ticks]()
+                                               { ticks++; });
+    for (int wait_ms = 0; wait_ms < 5000 && ticks.load() < 5; wait_ms += 5)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CHECK(ticks.load() >= 5 && "周期任务未重复执行");
+    every.cancel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    int ticksAfterCancel = ticks.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    CHECK(ticks.load() == ticksAfterCancel && "周期任务取消后仍在执行");
+    CHECK(cancelledRuns.load() == 0 && "已取消的延迟任务被执行");
+    safePrint("周期任务执行次数: %d\n", ticksAfterCancel);
+
+    // 非法周期
+    bool threw = false;
+    try
+    {
+        pool.scheduleEvery(std::chrono::milliseconds(0), []() {});
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    CHECK(threw && "非法周期未抛出异常");
+
+    // 定时任务析构时再调用线程池的定时接口：析构发生在定时锁之外，不死锁
+    struct TimerGuard
+    {
+        ol::ThreadPool<false>* pool;
+        std::atomic_int* destroyed;
+        TimerGuard(ol::ThreadPool<false>* p, std::atomic_int* d) : pool(p), destroyed(d) {}
+        ~TimerGuard()
+        {
+            pool->getTimerNum();
+            pool->scheduleAfter(std::chrono::seconds(10), []() {});
+            (*destroyed)++;
+        }
+    };
+    std::atomic_int guardsDestroyed{0};
+    {
+        auto guard = std::make_shared<TimerGuard>(&pool, &guardsDestroyed);
+        ol::TimerHandle doomed = pool.scheduleAfter(std::chrono::milliseconds(10), [guard]() {});
+        guard.reset();
+        doomed.cancel(); // 到期时定时线程丢弃最后一份引用
+    }
+    for (int wait_ms = 0; wait_ms < 5000 && guardsDestroyed.load() < 1; wait_ms += 5)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CHECK(guardsDestroyed.load() == 1 && "已取消定时任务未被丢弃");
+
+    // 停止后未到期的定时任务被丢弃，新提交返回无效句柄
+    std::atomic_int lateRuns{0};
+    pool.scheduleAfter(std::chrono::seconds(10), [&lateRuns]()
+                       { lateRuns++; });
+    pool.scheduleAfter(std::chrono::seconds(10), [guard = std::make_shared<TimerGuard>(&pool, &guardsDestroyed)]() {});
+    pool.stop();
+    CHECK(guardsDestroyed.load() == 2 && "停止时未丢弃定时任务");
+    CHECK(pool.getTimerNum() == 0 && "停止后定时任务未清空");
+    ol::TimerHandle afterStop = pool.scheduleAfter(std::chrono::milliseconds(1), []() {});
+    CHECK(!afterStop.valid() && "停止后仍可提交定时任务");
+    CHECK(lateRuns.load() == 0 && "停止后定时任务仍被执行");
+}
+
+// 固定模式有界无锁队列并发测试
+void testFixedBoundedQueue(size_t threadNum, size_t maxQueueSize)
+{
+    const std::string poolType = "固定模式";
+    safePrint("\n=== %s 有界无锁队列并发测试 ===\n", poolType.c_str());
+
+    ol::ThreadPool<false> pool(threadNum, maxQueueSize);
+    pool.setBlockPolicy();
+
+    // 多个生产者在阻塞策略下高频提交，队列容量远小于任务总数
+    const int PRODUCERS = 4, PER_PRODUCER = 20000;
+    std::atomic_llong sum{0};
+    std::atomic_int highRuns{0};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p)
+    {
+        producers.emplace_back([&pool, &sum, &highRuns, p]()
+                               {
+                                   for (int i = 1; i <= PER_PRODUCER; ++i)
+                                   {
+                                       long long value = (long long)p * PER_PRODUCER + i;
+                                       bool added = pool.addTask([&sum, value]()
+                                                                 { sum += value; });
+                                       CHECK(added && "阻塞策略下任务提交失败");
+                                       if (i % 1000 == 0)
+                                           pool.addTask([&highRuns]()
+                                                        { highRuns++; },
+                                                        ol::TaskPriority::kHigh);
+                                   } });
+    }
+    for (auto& t : producers) t.join();
+
+    // 批量提交走无锁入队
+    std::vector<std::function<void()>> batch;
+    for (int i = 0; i < 100; ++i)
+        batch.emplace_back([&sum]()
+                           { sum += 1; });
+    size_t batchAdded = pool.addTasks(batch);
+    CHECK(batchAdded == batch.size() && "阻塞策略下批量提交不完整");
+
+    for (int wait_ms = 0; wait_ms < 10000 && pool.getTaskNum() > 0; wait_ms += 10)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pool.stop();
+
+    long long n = (long long)PRODUCERS * PER_PRODUCER;
+    safePrint("累计和: %lld（期望 %lld），高优先级任务执行 %d 次\n", sum.load(), n * (n + 1) / 2 + 100, highRuns.load());
+    CHECK(sum.load() == n * (n + 1) / 2 + 100 && "有界无锁队列任务丢失或重复执行");
+    CHECK(highRuns.load() == PRODUCERS * PER_PRODUCER / 1000 && "有界无锁模式高优先级任务丢失");
+
+    // 拒绝策略：队列满时立即失败，不阻塞
+    ol::ThreadPool<false> rejectPool(1, 2);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture = gate.get_future().share();
+    int accepted = 0;
+    for (int i = 0; i < 10; ++i)
+        accepted += rejectPool.addTask([gateFuture]()
+                                       { gateFuture.wait(); });
+    gate.set_value();
+    safePrint("拒绝策略接受任务数: %d\n", accepted);
+    CHECK(accepted >= 2 && accepted <= 3 && "有界无锁队列容量限制错误");
+}
+
+// 固定模式CPU亲和性测试
+void testFixedAffinity()
+{
+    const std::string poolType = "固定模式";
+    safePrint("\n=== %s CPU亲和性测试 ===\n", poolType.c_str());
+
+    // 目标CPU取调用线程允许运行的最后一个在线CPU（taskset或容器cpuset可能排除部分在线CPU，固定到这些CPU会失败）
+    std::vector<int> cpus = ol::getOnlineCpus();
+    int target = cpus.back();
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+        for (int cpu : cpus)
+            if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) target = cpu;
+#endif
+
+    // 逐核固定：所有工作线程都固定到同一个CPU，任务只能在该CPU上运行
+    ol::ThreadPool<false> pinnedPool(2, 0, false, ol::WorkerPlacement::pinned({target}));
+    for (int i = 0; i < 4; ++i)
+    {
+        int cpu = pinnedPool.submitTask([]()
+                                        { return ol::getCurrentCpu(); })
+                      .second.get();
+        CHECK((cpu == target || cpu == -1) && "工作线程未固定到指定CPU");
+    }
+
+    // NUMA分组 + 节点本地队列：自动启用工作窃取，递归提交的任务全部完成
+    std::atomic_int counter{0};
+    std::function<void(int)> spawn;
+    ol::ThreadPool<false> numaPool(4, 0, false, ol::WorkerPlacement::numa(true));
+    spawn = [&](int depth)
+    {
+        counter++;
+        if (depth > 0)
+            for (int i = 0; i < 2; ++i)
+                numaPool.addTask([&spawn, depth]()
+                                 { spawn(depth - 1); });
+    };
+    numaPool.addTask([&spawn]()
+                     { spawn(8); });
+    for (int wait_ms = 0; wait_ms < 5000 && counter.load() < 511; wait_ms += 5)
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    numaPool.stop();
+    safePrint("NUMA分组线程池执行任务数: %d\n", counter.load());
+    CHECK(counter.load() == 511 && "NUMA节点本地队列任务丢失");
+}
+
+// 固定模式运行指标测试
+void testFixedMetrics()
+{
+    const std::string poolType = "固定模式";
+    safePrint("\n=== %s 运行指标测试 ===\n", poolType.c_str());
+
+    ol::ThreadPool<false> pool(2);
+
+    // 未开启指标时不统计
+    pool.submitTask([]() {}).second.get();
+    CHECK(pool.getStats().completed == 0 && "未开启指标时不应统计");
+
+    pool.enableMetrics();
+    CHECK(pool.isMetricsEnabled());
+    const int TASKS = 20;
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < TASKS; ++i)
+        futures.push_back(pool.submitTask([]()
+                                          { std::this_thread::sleep_for(std::chrono::milliseconds(2)); })
+                              .second);
+    for (auto& f : futures) f.get();
+
+    // future就绪时工作线程可能还未写入最后一个任务的指标，轮询直到样本数到齐（最多5秒）
+    ol::ThreadPoolStats stats = pool.getStats();
+    for (int wait_ms = 0; wait_ms < 5000 && (stats.completed < TASKS || stats.execTime.count < TASKS || stats.queueLatency.count < TASKS); wait_ms += 5)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        stats = pool.getStats();
+    }
+    safePrint("完成 %llu 个，执行耗时 p50=%lluns p99=%lluns，排队延迟 p99=%lluns，忙碌比例 %.2f\n",
+              (unsigned long long)stats.completed,
+              (unsigned long long)stats.execTime.percentileNs(0.5),
+              (unsigned long long)stats.execTime.percentileNs(0.99),
+              (unsigned long long)stats.queueLatency.percentileNs(0.99),
+              stats.busyRatio);
+    CHECK(stats.completed == TASKS && "完成数统计错误");
+    CHECK(stats.execTime.count == TASKS && stats.queueLatency.count == TASKS && "直方图样本数错误");
+    CHECK(stats.execTime.percentileNs(0.5) >= 1000000 && "执行耗时统计错误");
+    CHECK(stats.execTime.meanNs() >= 2000000.0 && "平均执行耗时统计错误");
+    CHECK(stats.workers.size() == 2 && "工作线程指标数量错误");
+    CHECK(stats.busyRatio > 0.0 && stats.busyRatio <= 1.0 && "忙碌比例超出范围");
+    uint64_t perWorker = 0;
+    for (const auto& w : stats.workers) perWorker += w.completed;
+    CHECK(perWorker == TASKS && "工作线程完成数汇总错误");
+
+    // 拒绝计数
+    ol::ThreadPool<false> rejectPool(1, 1);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture = gate.get_future().share();
+    int accepted = 0;
+    for (int i = 0; i < 5; ++i)
+        accepted += rejectPool.addTask([gateFuture]()
+                                       { gateFuture.wait(); });
+    gate.set_value();
+    uint64_t rejected = rejectPool.getStats().rejected;
+    CHECK(rejected == uint64_t(5 - accepted) && "拒绝计数错误");
+}
+
 // 动态模式stop方法测试
 void testDynamicStopBehavior(size_t minThreadNum, size_t maxThreadNum,
                              size_t maxQueueSize, std::chrono::seconds checkInterval)
@@ -569,8 +1043,8 @@ void testDynamicScaling()
     for (int i = 0; i < BATCH_SIZE; ++i)
         dynamicPool.addTask(std::bind(lightTask, i));
 
-    // 等待5个检查周期（确保管理者线程检查并扩容）
-    std::this_thread::sleep_for(std::chrono::seconds(5));
+    // 管理者按毫秒级采样，积压期间（80个任务在2个线程上约需8秒）应已完成扩容
+    std::this_thread::sleep_for(std::chrono::seconds(1));
     safePrint("扩容后线程数: %zu（预期3-5）\n", dynamicPool.getWorkerNum());
     safePrint("扩容后空闲线程数: %zu\n", dynamicPool.getIdleThreadNum());
     assert(dynamicPool.getWorkerNum() >= 3 && dynamicPool.getWorkerNum() <= 5 && "未正常扩容");
@@ -608,6 +1082,80 @@ void testDynamicScaling()
     safePrint("\n动态线程池扩缩容测试完成\n");
 }
 
+// 动态模式自适应扩缩容测试：突发负载的反应速度与自定义策略
+void testDynamicAutoscaling()
+{
+    safePrint("\n=== 动态线程池自适应扩缩容测试 ===\n");
+
+    // 突发负载：默认策略应在毫秒级扩容，负载消失并经过冷却时间后缩回
+    {
+        ol::ThreadPool<true> pool(1, 4, 0, std::chrono::seconds(1));
+        std::atomic_int done{0};
+        const int TASKS = 40;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < TASKS; ++i)
+            pool.addTask([&done]()
+                         {
+                             std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                             ++done; });
+
+        while (pool.getWorkerNum() < 2 && std::chrono::steady_clock::now() - start < std::chrono::seconds(2))
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        auto reaction = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        safePrint("突发负载后 %lld 毫秒扩容到 %zu 个线程\n", (long long)reaction.count(), pool.getWorkerNum());
+        CHECK(pool.getWorkerNum() >= 2 && reaction < std::chrono::milliseconds(500) && "突发负载未及时扩容");
+
+        while (done.load() < TASKS) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+        safePrint("负载消失后线程数: %zu（预期1）\n", pool.getWorkerNum());
+        CHECK(pool.getWorkerNum() == 1 && "负载消失后未缩容");
+    }
+
+    // 自定义策略：直接指定目标线程数
+    {
+        struct FixedTargetPolicy : ol::ScalingPolicy
+        {
+            std::atomic_size_t target{1};
+            std::atomic_size_t samples{0};
+            size_t decide(const ol::ScalingSample&) override
+            {
+                ++samples;
+                return target.load();
+            }
+        };
+
+        ol::ThreadPool<true> pool(1, 3);
+        auto policy = std::make_shared<FixedTargetPolicy>();
+        pool.setScalingPolicy(policy);
+        pool.setSampleInterval(std::chrono::milliseconds(5));
+        pool.setCheckInterval(std::chrono::seconds(0));
+
+        policy->target = 10; // 超过上限，应被限制为3
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        safePrint("自定义策略扩容后线程数: %zu（预期3）\n", pool.getWorkerNum());
+        CHECK(pool.getWorkerNum() == 3 && "自定义策略扩容错误");
+
+        policy->target = 0; // 低于下限，应被限制为1
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        safePrint("自定义策略缩容后线程数: %zu（预期1），采样次数: %zu\n", pool.getWorkerNum(), policy->samples.load());
+        CHECK(pool.getWorkerNum() == 1 && "自定义策略缩容错误");
+        CHECK(policy->samples.load() > 10 && "采样次数过少");
+
+        bool threw = false;
+        try
+        {
+            pool.setSampleInterval(std::chrono::milliseconds(0));
+        }
+        catch (const std::invalid_argument&)
+        {
+            threw = true;
+        }
+        CHECK(threw && "非法采样间隔未抛出异常");
+    }
+
+    safePrint("\n动态线程池自适应扩缩容测试完成\n");
+}
+
 int main()
 {
     try
@@ -618,6 +1166,13 @@ int main()
         runFixedCommonTests(3, 10);
         testFixedQueuePolicies(3, 10);
         testFixedStopBehavior(2, 10);
+        testFixedWorkStealing(4, 4);
+        testFixedBatchSubmit(3, 10);
+        testFixedTaskPriority();
+        testFixedScheduling();
+        testFixedBoundedQueue(4, 64);
+        testFixedAffinity();
+        testFixedMetrics();
 
         // 测试动态模式线程池（通用功能）
         runDynamicCommonTests(2, 5, 10, std::chrono::seconds(1));
@@ -626,6 +1181,7 @@ int main()
 
         // 测试动态模式特有功能（扩缩容）
         testDynamicScaling();
+        testDynamicAutoscaling();
 
         safePrint("\n===== 所有测试均成功完成! =====");
     }
@@ -0,0 +1,88 @@
+#include "ol_affinity.h"
+#include <cassert>
+#include <iostream>
+#include <set>
+
+using namespace ol;
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+int main()
+{
+    std::cout << "=== cpulist解析测试 ===" << std::endl;
+    TEST(parseCpuList("0-3,8,10-11\n") == std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+    TEST(parseCpuList("5,1,1,2-3") == std::vector<int>({1, 2, 3, 5}));
+    TEST(parseCpuList("").empty());
+    TEST(parseCpuList("x,3-1,7") == std::vector<int>({7}));
+    TEST(parseCpuList("0-2000000000,4") == std::vector<int>({4})); // 超出编号上限的片段被忽略，不展开
+    TEST(parseCpuList(std::to_string(kMaxCpuNum) + ",99999999999999999999,2").size() == 1);
+    TEST(parseCpuList("0-" + std::to_string(kMaxCpuNum - 1)).size() == static_cast<size_t>(kMaxCpuNum));
+
+    std::cout << "\n=== 拓扑读取测试 ===" << std::endl;
+    std::vector<int> online = getOnlineCpus();
+    std::vector<NumaNode> nodes = getNumaNodes();
+    TEST(!online.empty());
+    TEST(!nodes.empty());
+    size_t nodeCpuNum = 0;
+    for (const auto& node : nodes)
+    {
+        std::cout << "node" << node.id << ": " << node.cpus.size() << " cpus" << std::endl;
+        nodeCpuNum += node.cpus.size();
+    }
+    TEST(nodeCpuNum >= 1);
+
+    std::cout << "\n=== 放置策略测试 ===" << std::endl;
+    auto none = WorkerPlacement().assign(3);
+    TEST(none.size() == 3 && none[0].cpus.empty() && none[2].node == -1);
+
+    auto pinned = WorkerPlacement::pinned({4, 6}).assign(3);
+    TEST(pinned[0].cpus == std::vector<int>({4}));
+    TEST(pinned[1].cpus == std::vector<int>({6}));
+    TEST(pinned[2].cpus == std::vector<int>({4}));
+
+    auto cpuSet = WorkerPlacement::cpuSet({1, 2}).assign(2);
+    TEST(cpuSet[1].cpus == std::vector<int>({1, 2}));
+
+    WorkerPlacement numaPlacement = WorkerPlacement::numa(true);
+    TEST(numaPlacement.nodeLocalQueues());
+    auto numa = numaPlacement.assign(5);
+    std::set<int> usedNodes;
+    for (const auto& slot : numa)
+    {
+        TEST(slot.node >= 0 && !slot.cpus.empty());
+        usedNodes.insert(slot.node);
+    }
+    TEST(usedNodes.size() == std::min<size_t>(nodes.size(), 5));
+    TEST(!WorkerPlacement::numa().nodeLocalQueues());
+
+#ifdef __linux__
+    std::cout << "\n=== 绑核测试 ===" << std::endl;
+    TEST(setCurrentThreadAffinity({online.front()}));
+    TEST(getCurrentCpu() == online.front());
+    TEST(!setCurrentThreadAffinity({}));
+    TEST(!setCurrentThreadAffinity({-1}));
+
+    int ranOn = -1;
+    std::thread thread([&ranOn]()
+                       { ranOn = getCurrentCpu(); });
+    thread.join();
+    TEST(ranOn == online.front()); // 新线程继承创建者的亲和性
+    TEST(setCurrentThreadAffinity(online));
+#endif // __linux__
+
+    std::cout << "\nAll tests passed!" << std::endl;
+    return 0;
+}
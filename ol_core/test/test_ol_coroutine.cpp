@@ -0,0 +1,169 @@
+#include "ol_coroutine.h"
+#include <cassert>
+#include <iostream>
+
+#ifdef OL_COROUTINE_ENABLED
+#include "ol_ThreadPool.h"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#endif // OL_COROUTINE_ENABLED
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+#ifdef OL_COROUTINE_ENABLED
+using namespace ol;
+
+CoTask<int> square(ThreadPool<false>& pool, int v)
+{
+    co_await schedule(pool);
+    co_return v * v;
+}
+
+CoTask<int> sumOfSquares(ThreadPool<false>& pool, int n)
+{
+    int sum = 0;
+    for (int i = 1; i <= n; ++i) sum += co_await square(pool, i);
+    co_return sum;
+}
+
+CoTask<std::thread::id> workerId(ThreadPool<false>& pool)
+{
+    co_await schedule(pool);
+    co_return std::this_thread::get_id();
+}
+
+CoTask<void> failing(ThreadPool<false>& pool)
+{
+    co_await schedule(pool);
+    throw std::runtime_error("coroutine failure");
+}
+
+CoTask<std::string> catchFailure(ThreadPool<false>& pool)
+{
+    try
+    {
+        co_await failing(pool);
+    }
+    catch (const std::runtime_error& e)
+    {
+        co_return std::string(e.what());
+    }
+    co_return std::string();
+}
+
+CoTask<int> napThenAdd(ThreadPool<false>& pool, std::atomic_int& inFlight, std::atomic_int& maxInFlight)
+{
+    int now = ++inFlight;
+    int prev = maxInFlight.load();
+    while (now > prev && !maxInFlight.compare_exchange_weak(prev, now)) {}
+    co_await sleepFor(pool, std::chrono::milliseconds(50));
+    --inFlight;
+    co_return 1;
+}
+
+CoTask<int> awaitFuture(ThreadPool<false>& pool)
+{
+    int a = co_await pool.submitAsync([]()
+                                      { return 20; });
+    Future<int> b = pool.submitAsync([]()
+                                     { return 22; });
+    co_return a + co_await b;
+}
+#endif // OL_COROUTINE_ENABLED
+
+int main()
+{
+#ifdef OL_COROUTINE_ENABLED
+    ThreadPool<false> pool(2);
+
+    std::cout << "=== CoTask/spawn基本测试 ===" << std::endl;
+    {
+        TEST(spawn(pool, square(pool, 7)).get() == 49);
+        TEST(spawn(pool, sumOfSquares(pool, 10)).get() == 385);
+        TEST(spawn(pool, workerId(pool)).get() != std::this_thread::get_id());
+
+        // spawn返回的Future可以继续then
+        Future<std::string> text = spawn(pool, square(pool, 3)).then([](int v)
+                                                                     { return std::to_string(v); });
+        TEST(text.get() == "9");
+    }
+
+    std::cout << "\n=== 异常传播测试 ===" << std::endl;
+    {
+        TEST(spawn(pool, catchFailure(pool)).get() == "coroutine failure");
+
+        bool threw = false;
+        try
+        {
+            spawn(pool, failing(pool)).get();
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        TEST(threw);
+    }
+
+    std::cout << "\n=== 定时等待多路复用测试 ===" << std::endl;
+    {
+        // 2个工作线程同时挂起200个各睡眠50毫秒的协程：挂起期间不占用线程，总耗时远小于串行的10秒
+        const int N = 200;
+        std::atomic_int inFlight{0}, maxInFlight{0};
+        auto start = std::chrono::steady_clock::now();
+        std::vector<Future<int>> futures;
+        for (int i = 0; i < N; ++i) futures.push_back(spawn(pool, napThenAdd(pool, inFlight, maxInFlight)));
+        int total = 0;
+        for (auto& f : futures) total += f.get();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "最大同时挂起数: " << maxInFlight.load() << ", 耗时(ms): "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << std::endl;
+        TEST(total == N);
+        TEST(maxInFlight.load() > 2);
+        TEST(elapsed < std::chrono::seconds(3));
+    }
+
+    std::cout << "\n=== co_await Future测试 ===" << std::endl;
+    {
+        TEST(spawn(pool, awaitFuture(pool)).get() == 42);
+    }
+
+    std::cout << "\n=== 线程池停止后测试 ===" << std::endl;
+    {
+        ThreadPool<false> stopped(1);
+        stopped.stop();
+        bool threw = false;
+        try
+        {
+            spawn(stopped, square(stopped, 2)).get();
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        TEST(threw);
+    }
+
+    std::cout << "\nAll tests passed!" << std::endl;
+#else
+    std::cout << "Coroutine support disabled (configure with -DOL_ENABLE_COROUTINES=ON), skipped." << std::endl;
+    TEST(true);
+#endif // OL_COROUTINE_ENABLED
+    return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ *  程序名：test_ol_extsort.cpp，此程序测试外部排序（external_sort），数据文件放在/tmp/ol_extsort目录中。
+ *  作者：ol
+ */
+#include "ol_extsort.h"
+#include "ol_chrono.h"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ol;
+using namespace std;
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+const string TEST_DIR = "/tmp/ol_extsort";
+
+// 写入文本文件，每行以'\n'结尾
+void write_lines(const string& filename, const vector<string>& lines)
+{
+    cofile ofile;
+    ofile.open(filename, false);
+    for (const string& line : lines) ofile << line << "\n";
+    ofile.closeandrename();
+}
+
+// 读出文本文件的所有行
+vector<string> read_lines(const string& filename)
+{
+    vector<string> lines;
+    cifile ifile;
+    if (!ifile.open(filename)) return lines;
+    string line;
+    while (ifile.readline(line)) lines.push_back(line);
+    return lines;
+}
+
+// 生成"编号,名称,分数"格式的CSV行，分数有大量重复以便检查稳定性
+vector<string> generate_csv(size_t n, unsigned seed)
+{
+    mt19937 gen(seed);
+    uniform_int_distribution<int> score(-500, 500);
+    vector<string> lines;
+    lines.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        lines.push_back(to_string(i) + ",name" + to_string(gen() % 1000) + "," + to_string(score(gen)));
+    return lines;
+}
+
+// 目录中是否残留顺串临时文件
+bool has_run_files(const string& dir)
+{
+    cdir d;
+    d.opendir(dir, "*.run*");
+    return d.size() > 0;
+}
+
+void test_basic()
+{
+    cout << "=== 整行排序与边界情况 ===" << endl;
+
+    vector<string> lines = {"pear", "apple", "", "banana", "apple", "cherry"};
+    write_lines(TEST_DIR + "/small.txt", lines);
+    TEST(external_sort(TEST_DIR + "/small.txt", TEST_DIR + "/small.sorted"));
+    vector<string> expected = lines;
+    sort(expected.begin(), expected.end());
+    TEST(read_lines(TEST_DIR + "/small.sorted") == expected);
+
+    // 空文件
+    write_lines(TEST_DIR + "/empty.txt", {});
+    TEST(external_sort(TEST_DIR + "/empty.txt", TEST_DIR + "/empty.sorted"));
+    TEST(read_lines(TEST_DIR + "/empty.sorted").empty());
+
+    // 最后一行没有换行符
+    cofile ofile;
+    ofile.open(TEST_DIR + "/nonl.txt", false);
+    ofile << "b\na";
+    ofile.closeandrename();
+    TEST(external_sort(TEST_DIR + "/nonl.txt", TEST_DIR + "/nonl.sorted"));
+    TEST((read_lines(TEST_DIR + "/nonl.sorted") == vector<string>{"a", "b"}));
+
+    // 输入文件不存在
+    TEST(!external_sort(TEST_DIR + "/missing.txt", TEST_DIR + "/missing.sorted"));
+
+    // 非法参数
+    ExternalSortOptions bad;
+    bad.max_merge_ways = 1;
+    bool threw = false;
+    try
+    {
+        external_sort(TEST_DIR + "/small.txt", TEST_DIR + "/small.sorted", bad);
+    }
+    catch (const invalid_argument&)
+    {
+        threw = true;
+    }
+    TEST(threw);
+}
+
+void test_field_keys()
+{
+    cout << "\n=== 按字段排序（多顺串、多趟归并） ===" << endl;
+
+    const size_t N = 200000;
+    vector<string> lines = generate_csv(N, 42);
+    write_lines(TEST_DIR + "/data.csv", lines);
+
+    // 内存上限很小，迫使生成大量顺串并分多趟归并
+    ExternalSortOptions options;
+    options.memory_limit = 256 * 1024;
+    options.buffer_size = 16 * 1024;
+    options.max_merge_ways = 4;
+
+    FieldKey<long> score_key(",", {2});
+    auto score_of = [](const string& line)
+    { return stol(line.substr(line.rfind(',') + 1)); };
+
+    // 按分数升序，分数相同保持输入顺序
+    ctimer timer;
+    TEST(external_sort(TEST_DIR + "/data.csv", TEST_DIR + "/by_score.csv", score_key, less<long>(), options));
+    cout << "external_sort (" << N << "行): " << timer.elapsed() << " 秒" << endl;
+    vector<string> expected = lines;
+    stable_sort(expected.begin(), expected.end(), [&](const string& a, const string& b)
+                { return score_of(a) < score_of(b); });
+    TEST(read_lines(TEST_DIR + "/by_score.csv") == expected);
+    TEST(!has_run_files(TEST_DIR));
+
+    // 按分数降序
+    TEST(external_sort(TEST_DIR + "/data.csv", TEST_DIR + "/by_score_desc.csv", score_key, greater<long>(), options));
+    expected = lines;
+    stable_sort(expected.begin(), expected.end(), [&](const string& a, const string& b)
+                { return score_of(a) > score_of(b); });
+    TEST(read_lines(TEST_DIR + "/by_score_desc.csv") == expected);
+
+    // 多字段：先按名称，再按分数
+    FieldKey<string, long> name_score_key(",", {1, 2});
+    TEST(external_sort(TEST_DIR + "/data.csv", TEST_DIR + "/by_name_score.csv", name_score_key, less<tuple<string, long>>(), options));
+    expected = lines;
+    stable_sort(expected.begin(), expected.end(), [&](const string& a, const string& b)
+                { return name_score_key(a) < name_score_key(b); });
+    TEST(read_lines(TEST_DIR + "/by_name_score.csv") == expected);
+
+    // 临时目录与原地排序（输出文件即输入文件）
+    options.tmp_dir = TEST_DIR + "/tmp";
+    newdir(options.tmp_dir, false);
+    vector<string> copy_lines(lines.begin(), lines.begin() + 50000);
+    write_lines(TEST_DIR + "/inplace.csv", copy_lines);
+    TEST(external_sort(TEST_DIR + "/inplace.csv", TEST_DIR + "/inplace.csv", score_key, less<long>(), options));
+    expected = copy_lines;
+    stable_sort(expected.begin(), expected.end(), [&](const string& a, const string& b)
+                { return score_of(a) < score_of(b); });
+    TEST(read_lines(TEST_DIR + "/inplace.csv") == expected);
+    TEST(!has_run_files(options.tmp_dir));
+}
+
+void test_parallel()
+{
+    cout << "\n=== 线程池并行生成顺串 ===" << endl;
+
+    const size_t N = 200000;
+    vector<string> lines = generate_csv(N, 7);
+    write_lines(TEST_DIR + "/par.csv", lines);
+
+    ExternalSortOptions options;
+    options.memory_limit = 1024 * 1024;
+    options.buffer_size = 64 * 1024;
+
+    ThreadPool<false> pool(4);
+    ctimer timer;
+    TEST(external_sort(pool, TEST_DIR + "/par.csv", TEST_DIR + "/par.sorted", FieldKey<long>(",", {2}), less<long>(), options));
+    cout << "并行external_sort (" << N << "行, 4线程): " << timer.elapsed() << " 秒" << endl;
+
+    auto score_of = [](const string& line)
+    { return stol(line.substr(line.rfind(',') + 1)); };
+    vector<string> expected = lines;
+    stable_sort(expected.begin(), expected.end(), [&](const string& a, const string& b)
+                { return score_of(a) < score_of(b); });
+    TEST(read_lines(TEST_DIR + "/par.sorted") == expected);
+    TEST(!has_run_files(TEST_DIR));
+
+    // 键提取函数抛出异常：传播给调用者并清理临时文件
+    bool threw = false;
+    try
+    {
+        external_sort(pool, TEST_DIR + "/par.csv", TEST_DIR + "/par.fail", [](const string& line)
+                      {
+            if (line.rfind("199999,", 0) == 0) throw runtime_error("bad line");
+            return line.size(); }, less<size_t>(), options);
+    }
+    catch (const runtime_error&)
+    {
+        threw = true;
+    }
+    TEST(threw);
+    TEST(!has_run_files(TEST_DIR));
+}
+
+int main()
+{
+    newdir(TEST_DIR, false);
+
+    test_basic();
+    test_field_keys();
+    test_parallel();
+
+    cout << "\nAll tests passed!" << endl;
+    return 0;
+}
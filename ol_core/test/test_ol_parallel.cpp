@@ -0,0 +1,164 @@
+#include "ol_parallel.h"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ol;
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+int main()
+{
+    ThreadPool<false> pool(4);
+
+    std::cout << "=== parallel_for测试 ===" << std::endl;
+    {
+        std::vector<int> data(100000, 1);
+        parallel_for(pool, data.begin(), data.end(), [](int& v)
+                     { v *= 3; });
+        TEST(std::all_of(data.begin(), data.end(), [](int v)
+                         { return v == 3; }));
+
+        std::vector<std::atomic_int> hits(1000);
+        parallel_for(pool, 0, 1000, [&hits](int i)
+                     { ++hits[i]; }, 7);
+        TEST(std::all_of(hits.begin(), hits.end(), [](const std::atomic_int& h)
+                         { return h.load() == 1; }));
+
+        int array[64] = {};
+        parallel_for(pool, array, [](int& v)
+                     { v = 5; });
+        TEST(std::accumulate(array, array + 64, 0) == 320);
+
+        int calls = 0;
+        parallel_for(pool, 5, 5, [&calls](int)
+                     { ++calls; });
+        TEST(calls == 0);
+    }
+
+    std::cout << "\n=== parallel_reduce测试 ===" << std::endl;
+    {
+        std::vector<long long> data(100001);
+        std::iota(data.begin(), data.end(), 0);
+        TEST(parallel_reduce(pool, data, 0LL) == 100000LL * 100001 / 2);
+        TEST(parallel_reduce(pool, data.begin(), data.begin(), 42LL) == 42);
+
+        // 只满足结合律的操作（字符串拼接）必须保持原顺序
+        std::vector<std::string> words;
+        for (int i = 0; i < 500; ++i) words.push_back(std::to_string(i % 10));
+        std::string serial = std::accumulate(words.begin(), words.end(), std::string(">"));
+        TEST(parallel_reduce(pool, words, std::string(">"), std::plus<>(), 3) == serial);
+
+        // 浮点求和结果可复现
+        std::vector<double> values(50000);
+        for (size_t i = 0; i < values.size(); ++i) values[i] = 1.0 / (i + 1);
+        double first = parallel_reduce(pool, values, 0.0);
+        bool stable = true;
+        for (int i = 0; i < 10; ++i) stable = stable && parallel_reduce(pool, values, 0.0) == first;
+        TEST(stable);
+    }
+
+    std::cout << "\n=== parallel_transform测试 ===" << std::endl;
+    {
+        std::vector<int> in(30000);
+        std::iota(in.begin(), in.end(), 0);
+        std::vector<long long> out(in.size());
+        auto end = parallel_transform(pool, in, out.begin(), [](int v)
+                                      { return (long long)v * v; });
+        TEST(end == out.end());
+        bool ok = true;
+        for (size_t i = 0; i < in.size(); ++i) ok = ok && out[i] == (long long)i * (long long)i;
+        TEST(ok);
+
+        // 原地变换
+        parallel_transform(pool, in.begin(), in.end(), in.begin(), [](int v)
+                           { return -v; });
+        TEST(in[12345] == -12345);
+    }
+
+    std::cout << "\n=== parallel_inclusive_scan测试 ===" << std::endl;
+    {
+        for (size_t n : {1u, 2u, 17u, 1000u, 65537u})
+        {
+            std::vector<long long> data(n);
+            for (size_t i = 0; i < n; ++i) data[i] = (long long)(i % 7) - 3;
+            std::vector<long long> expected(n);
+            std::partial_sum(data.begin(), data.end(), expected.begin());
+
+            std::vector<long long> out(n);
+            parallel_inclusive_scan(pool, data, out.begin());
+            TEST(out == expected);
+
+            parallel_inclusive_scan(pool, data.begin(), data.end(), data.begin(), std::plus<>(), 5); // 原地
+            TEST(data == expected);
+        }
+
+        std::vector<std::string> letters;
+        for (int i = 0; i < 200; ++i) letters.push_back(std::string(1, char('a' + i % 26)));
+        std::vector<std::string> expected(letters.size()), out(letters.size());
+        std::partial_sum(letters.begin(), letters.end(), expected.begin());
+        parallel_inclusive_scan(pool, letters.begin(), letters.end(), out.begin(), std::plus<>(), 4);
+        TEST(out == expected);
+    }
+
+    std::cout << "\n=== 异常传播测试 ===" << std::endl;
+    {
+        std::vector<int> data(10000);
+        std::iota(data.begin(), data.end(), 0);
+        bool threw = false;
+        try
+        {
+            parallel_for(pool, data, [](int v)
+                         {
+                             if (v == 4321) throw std::runtime_error("bad element"); });
+        }
+        catch (const std::runtime_error& e)
+        {
+            threw = std::string(e.what()) == "bad element";
+        }
+        TEST(threw);
+
+        // 异常后线程池仍可正常使用
+        TEST(parallel_reduce(pool, data, 0LL) == 9999LL * 10000 / 2);
+    }
+
+    std::cout << "\n=== 嵌套调用与停止后退化测试 ===" << std::endl;
+    {
+        // 在工作线程内嵌套调用：调用线程参与计算，不会因等待辅助任务而死锁
+        ThreadPool<false> small(2);
+        std::atomic_llong total{0};
+        parallel_for(small, 0, 8, [&](int)
+                     {
+                         std::vector<int> ones(1000, 1);
+                         total += parallel_reduce(small, ones, 0LL); }, 1);
+        TEST(total.load() == 8000);
+
+        ThreadPool<false> stopped(2);
+        stopped.stop();
+        std::vector<int> data(1000, 2);
+        TEST(parallel_reduce(stopped, data, 0) == 2000);
+
+        ThreadPool<true> dynamicPool(1, 4);
+        TEST(parallel_reduce(dynamicPool, data, 0) == 2000);
+    }
+
+    std::cout << "\nAll tests passed!" << std::endl;
+    return 0;
+}
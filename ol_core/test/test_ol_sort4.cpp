@@ -0,0 +1,911 @@
+#include "ol_chrono.h"
+#include "ol_sort.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cassert>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace ol;
+using namespace std;
+
+// 测试辅助宏
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            assert(false);                                                                   \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+// 生成随机整数
+vector<int> generate_random_ints(size_t size, int min_val, int max_val, unsigned seed = 2024)
+{
+    vector<int> result(size);
+    mt19937 gen(seed);
+    uniform_int_distribution<int> dist(min_val, max_val);
+    for (size_t i = 0; i < size; ++i) result[i] = dist(gen);
+    return result;
+}
+
+// 辅助函数：打印分隔线
+void print_separator(const string& title)
+{
+    cout << "\n============================================================" << '\n';
+    cout << title << '\n';
+    cout << "============================================================" << '\n';
+}
+
+// 按first比较，用于检查稳定性
+struct FirstLess
+{
+    bool operator()(const pair<int, int>& a, const pair<int, int>& b) const
+    {
+        return a.first < b.first;
+    }
+};
+
+// 遇到特定值时抛出异常的比较器
+struct ThrowingLess
+{
+    bool operator()(int a, int b) const
+    {
+        if (a == 12345 || b == 12345) throw runtime_error("comparator failure");
+        return a < b;
+    }
+};
+
+void test_parallel_sort()
+{
+    const size_t N = 300000;
+    const size_t THREADS = 4;
+
+    print_separator("1. 并行归并排序");
+    {
+        auto data = generate_random_ints(N, -1000000, 1000000);
+        vector<int> expected = data;
+        sort(expected.begin(), expected.end());
+
+        vector<int> vec = data;
+        ctimer timer;
+        parallel_merge_sort(vec, less<int>(), THREADS);
+        cout << "parallel_merge_sort (" << N << "元素, " << THREADS << "线程): " << timer.elapsed() << " 秒" << endl;
+        TEST(vec == expected);
+
+        // 降序 + 迭代器版本 + 默认线程数
+        vec = data;
+        parallel_merge_sort(vec.begin(), vec.end(), greater<int>());
+        TEST(is_sorted(vec.begin(), vec.end(), greater<int>()));
+
+        // deque容器
+        deque<int> dq(data.begin(), data.end());
+        parallel_merge_sort(dq, less<int>(), THREADS);
+        TEST(equal(dq.begin(), dq.end(), expected.begin()));
+
+        // 稳定性：大量重复键，second记录原始位置
+        auto keys = generate_random_ints(N, 0, 100);
+        vector<pair<int, int>> pairs(N);
+        for (size_t i = 0; i < N; ++i) pairs[i] = {keys[i], static_cast<int>(i)};
+        vector<pair<int, int>> stable_expected = pairs;
+        stable_sort(stable_expected.begin(), stable_expected.end(), FirstLess());
+        parallel_merge_sort(pairs, FirstLess(), THREADS);
+        TEST(pairs == stable_expected);
+
+        // 小数据退化为串行
+        vector<int> small = {5, 3, 9, 1, 7};
+        parallel_merge_sort(small, less<int>(), THREADS);
+        TEST((small == vector<int>{1, 3, 5, 7, 9}));
+
+        vector<int> empty;
+        parallel_merge_sort(empty);
+        TEST(empty.empty());
+    }
+
+    print_separator("2. 并行样本排序");
+    {
+        auto data = generate_random_ints(N, -1000000, 1000000);
+        vector<int> expected = data;
+        sort(expected.begin(), expected.end());
+
+        vector<int> vec = data;
+        ctimer timer;
+        parallel_sample_sort(vec, less<int>(), THREADS);
+        cout << "parallel_sample_sort (" << N << "元素, " << THREADS << "线程): " << timer.elapsed() << " 秒" << endl;
+        TEST(vec == expected);
+
+        vec = data;
+        parallel_sample_sort(vec.begin(), vec.end(), greater<int>(), THREADS);
+        TEST(is_sorted(vec.begin(), vec.end(), greater<int>()));
+
+        // 大量重复值：所有元素取自3个值
+        auto dup = generate_random_ints(N, 0, 2);
+        vector<int> dup_expected = dup;
+        sort(dup_expected.begin(), dup_expected.end());
+        parallel_sample_sort(dup, less<int>(), THREADS);
+        TEST(dup == dup_expected);
+
+        // 已有序与逆序输入
+        vector<int> sorted_input = expected;
+        parallel_sample_sort(sorted_input, less<int>(), THREADS);
+        TEST(sorted_input == expected);
+        vector<int> reversed(expected.rbegin(), expected.rend());
+        parallel_sample_sort(reversed, less<int>(), THREADS);
+        TEST(reversed == expected);
+
+        // 字符串
+        vector<string> strs;
+        for (int v : generate_random_ints(N / 10, 0, 1000000)) strs.push_back("key_" + to_string(v));
+        vector<string> strs_expected = strs;
+        sort(strs_expected.begin(), strs_expected.end());
+        parallel_sample_sort(strs, less<string>(), THREADS);
+        TEST(strs == strs_expected);
+    }
+
+    print_separator("3. 比较器异常传播");
+    {
+        auto data = generate_random_ints(N, 0, 100000);
+        data[N / 2] = 12345;
+
+        bool merge_threw = false;
+        try
+        {
+            vector<int> vec = data;
+            parallel_merge_sort(vec, ThrowingLess(), THREADS);
+        }
+        catch (const runtime_error&)
+        {
+            merge_threw = true;
+        }
+        TEST(merge_threw);
+
+        bool sample_threw = false;
+        try
+        {
+            vector<int> vec = data;
+            parallel_sample_sort(vec, ThrowingLess(), THREADS);
+        }
+        catch (const runtime_error&)
+        {
+            sample_threw = true;
+        }
+        TEST(sample_threw);
+    }
+}
+
+
+// 统计比较次数的比较器
+struct CountingLess
+{
+    size_t* count;
+    bool operator()(int a, int b) const
+    {
+        ++*count;
+        return a < b;
+    }
+};
+
+// 检查intro_sort结果与std::sort一致
+template <typename T, typename Compare = less<T>>
+bool intro_sort_matches(vector<T> data, const Compare& comp = Compare())
+{
+    vector<T> expected = data;
+    sort(expected.begin(), expected.end(), comp);
+    intro_sort(data, comp);
+    return data == expected;
+}
+
+void test_intro_sort()
+{
+    const size_t N = 1000000;
+
+    print_separator("4. 内省排序");
+    {
+        auto data = generate_random_ints(N, -1000000000, 1000000000);
+        vector<int> vec = data;
+        ctimer timer;
+        intro_sort(vec);
+        double intro_time = timer.elapsed();
+        vector<int> expected = data;
+        timer.start();
+        sort(expected.begin(), expected.end());
+        double stl_time = timer.elapsed();
+        cout << "intro_sort (" << N << "元素): " << intro_time << " 秒, std::sort: " << stl_time << " 秒" << endl;
+        TEST(vec == expected);
+
+        // 无分支分区（std::greater）与普通分区（自定义比较器/字符串）
+        TEST(intro_sort_matches(data, greater<int>()));
+        TEST(intro_sort_matches(data, [](int a, int b) { return a < b; }));
+        vector<double> doubles(data.begin(), data.begin() + 100000);
+        for (double& d : doubles) d /= 7.0;
+        TEST(intro_sort_matches(doubles));
+        vector<string> strs;
+        for (int v : generate_random_ints(50000, 0, 100000)) strs.push_back(to_string(v));
+        TEST(intro_sort_matches(strs));
+
+        // 迭代器版本与原生数组
+        int arr[] = {9, -3, 7, 0, 2, 2, -8, 5};
+        intro_sort(begin(arr), end(arr));
+        TEST(is_sorted(begin(arr), end(arr)));
+        deque<int> dq(data.begin(), data.begin() + 100000);
+        intro_sort(dq);
+        TEST(is_sorted(dq.begin(), dq.end()));
+    }
+
+    print_separator("5. 内省排序对抗性输入");
+    {
+        vector<vector<int>> patterns;
+        vector<int> v(N);
+        for (size_t i = 0; i < N; ++i) v[i] = static_cast<int>(i);
+        patterns.push_back(v); // 有序
+        reverse(v.begin(), v.end());
+        patterns.push_back(v); // 逆序
+        for (size_t i = 0; i < N; ++i) v[i] = static_cast<int>(i < N / 2 ? i : N - i);
+        patterns.push_back(v); // 管风琴
+        for (size_t i = 0; i < N; ++i) v[i] = static_cast<int>(i % 16);
+        patterns.push_back(v); // 锯齿
+        patterns.push_back(vector<int>(N, 42));         // 全部相等
+        patterns.push_back(generate_random_ints(N, 0, 3)); // 少量不同键值
+        for (size_t i = 0; i < N; ++i) v[i] = static_cast<int>(i);
+        for (size_t i = 0; i < N; i += 1000) swap(v[i], v[N - 1 - i]);
+        patterns.push_back(v); // 接近有序
+
+        double log2n = log2(static_cast<double>(N));
+        for (size_t p = 0; p < patterns.size(); ++p)
+        {
+            size_t comparisons = 0;
+            vector<int> vec = patterns[p];
+            ctimer timer;
+            intro_sort(vec, CountingLess{&comparisons});
+            cout << "模式" << p << ": " << timer.elapsed() << " 秒, 比较次数/(n*log2n) = "
+                 << comparisons / (N * log2n) << endl;
+            TEST(is_sorted(vec.begin(), vec.end()));
+            TEST(comparisons < 3 * N * log2n);
+            TEST(intro_sort_matches(patterns[p]));
+        }
+    }
+
+    print_separator("6. 内省排序随机小规模数据");
+    {
+        mt19937 gen(7);
+        bool all_match = true;
+        for (size_t size = 0; size < 600; ++size)
+        {
+            int max_val = static_cast<int>(gen() % 50) + 1;
+            auto data = generate_random_ints(size, 0, max_val, static_cast<unsigned>(size));
+            all_match = all_match && intro_sort_matches(data) && intro_sort_matches(data, greater<int>());
+        }
+        TEST(all_match);
+    }
+}
+
+
+// 生成随机64位无符号整数
+vector<uint64_t> generate_random_u64(size_t size, unsigned seed = 2024)
+{
+    vector<uint64_t> result(size);
+    mt19937_64 gen(seed);
+    for (size_t i = 0; i < size; ++i) result[i] = gen();
+    return result;
+}
+
+void test_radix256_sort()
+{
+    const size_t N = 1000000;
+
+    print_separator("7. 字节基数排序");
+    {
+        auto data = generate_random_u64(N);
+        vector<uint64_t> expected = data;
+        ctimer timer;
+        intro_sort(expected);
+        double intro_time = timer.elapsed();
+
+        vector<uint64_t> vec = data;
+        vector<uint64_t> scratch;
+        timer.start();
+        radix256_sort(vec, scratch);
+        double radix_time = timer.elapsed();
+        cout << "radix256_sort (" << N << "个64位键): " << radix_time << " 秒, intro_sort: " << intro_time << " 秒" << endl;
+        TEST(vec == expected);
+
+        // 缓冲区复用：第二次排序不再分配
+        const uint64_t* scratch_data = scratch.data();
+        vec = data;
+        radix256_sort(vec.begin(), vec.end(), scratch);
+        TEST(vec == expected);
+        TEST(scratch.data() == scratch_data);
+
+        // 降序
+        vec = data;
+        radix256_sort(vec, greater<uint64_t>());
+        TEST(is_sorted(vec.begin(), vec.end(), greater<uint64_t>()));
+
+        // 小范围键：高位字节全部相同的趟被跳过，结果依然正确
+        vector<uint64_t> small_range(N);
+        for (size_t i = 0; i < N; ++i) small_range[i] = data[i] % 1000;
+        expected = small_range;
+        sort(expected.begin(), expected.end());
+        radix256_sort(small_range, scratch);
+        TEST(small_range == expected);
+    }
+
+    print_separator("8. 字节基数排序：有符号整数与浮点数");
+    {
+        auto ints = generate_random_ints(N, numeric_limits<int>::min(), numeric_limits<int>::max());
+        ints[0] = numeric_limits<int>::min();
+        ints[1] = numeric_limits<int>::max();
+        ints[2] = 0;
+        ints[3] = -1;
+        vector<int> expected = ints;
+        sort(expected.begin(), expected.end());
+        radix256_sort(ints);
+        TEST(ints == expected);
+
+        vector<int8_t> bytes = {5, -128, 127, 0, -1, 3, -3};
+        radix256_sort(bytes);
+        TEST(is_sorted(bytes.begin(), bytes.end()));
+
+        vector<double> doubles(N);
+        for (size_t i = 0; i < N; ++i) doubles[i] = (static_cast<double>(ints[i]) / 1000.0) * (i % 3 == 0 ? 1e-300 : 1.0);
+        doubles[0] = numeric_limits<double>::infinity();
+        doubles[1] = -numeric_limits<double>::infinity();
+        doubles[2] = -0.0;
+        doubles[3] = numeric_limits<double>::denorm_min();
+        doubles[4] = -numeric_limits<double>::max();
+        vector<double> expected_d = doubles;
+        sort(expected_d.begin(), expected_d.end());
+        radix256_sort(doubles);
+        TEST(doubles == expected_d);
+
+        float floats[] = {3.5f, -0.25f, 0.0f, -7.0f, 1e-30f, -1e30f, 2.0f};
+        radix256_sort(floats, greater<float>());
+        TEST(is_sorted(begin(floats), end(floats), greater<float>()));
+
+        deque<long long> dq = {9, -9, 0, 1LL << 40, -(1LL << 40), 7};
+        radix256_sort(dq);
+        TEST(is_sorted(dq.begin(), dq.end()));
+    }
+
+    print_separator("9. 字节基数排序：按键排序记录");
+    {
+        // (key, payload)对：payload记录原始位置，用于检查稳定性
+        auto keys = generate_random_ints(N, -1000, 1000);
+        vector<pair<int, size_t>> records(N);
+        for (size_t i = 0; i < N; ++i) records[i] = {keys[i], i};
+        auto key_of = [](const pair<int, size_t>& r)
+        { return r.first; };
+
+        vector<pair<int, size_t>> expected = records;
+        stable_sort(expected.begin(), expected.end(), [](const pair<int, size_t>& a, const pair<int, size_t>& b)
+                    { return a.first < b.first; });
+        vector<pair<int, size_t>> sorted_records = records;
+        vector<pair<int, size_t>> scratch;
+        radix256_sort_by_key(sorted_records, key_of, scratch);
+        TEST(sorted_records == expected);
+
+        // 降序同样稳定
+        expected = records;
+        stable_sort(expected.begin(), expected.end(), [](const pair<int, size_t>& a, const pair<int, size_t>& b)
+                    { return a.first > b.first; });
+        sorted_records = records;
+        radix256_sort_by_key(sorted_records.begin(), sorted_records.end(), key_of, scratch, greater<int>());
+        TEST(sorted_records == expected);
+
+        // 浮点键
+        struct Item
+        {
+            double price = 0;
+            string name;
+        };
+        vector<Item> items = {{9.5, "c"}, {-1.0, "a"}, {3.25, "b"}, {-1.0, "a2"}};
+        radix256_sort_by_key(items, [](const Item& it)
+                             { return it.price; });
+        TEST(items[0].name == "a" && items[1].name == "a2" && items[2].name == "b" && items[3].name == "c");
+    }
+}
+
+// 只能移动、不能默认构造的元素，检查tim_sort对元素类型的要求
+struct MoveOnlyItem
+{
+    int key;
+    unique_ptr<int> payload;
+    MoveOnlyItem(int k, int p) : key(k), payload(new int(p)) {}
+};
+
+// 检查tim_sort结果与std::stable_sort一致（含稳定性）
+bool tim_sort_matches(const vector<pair<int, int>>& data)
+{
+    vector<pair<int, int>> expected = data, actual = data;
+    stable_sort(expected.begin(), expected.end(), FirstLess());
+    tim_sort(actual, FirstLess());
+    return actual == expected;
+}
+
+// 生成按first带大量重复值、second为输入顺序的数据
+vector<pair<int, int>> generate_keyed(const vector<int>& keys)
+{
+    vector<pair<int, int>> result(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) result[i] = {keys[i], static_cast<int>(i)};
+    return result;
+}
+
+void test_tim_sort()
+{
+    const size_t N = 1000000;
+
+    print_separator("10. Timsort自适应稳定排序");
+    {
+        auto data = generate_random_ints(N, -1000000000, 1000000000);
+        vector<int> vec = data;
+        ctimer timer;
+        tim_sort(vec);
+        double tim_time = timer.elapsed();
+        vector<int> expected = data;
+        timer.start();
+        stable_sort(expected.begin(), expected.end());
+        double stl_time = timer.elapsed();
+        cout << "tim_sort (" << N << "元素): " << tim_time << " 秒, std::stable_sort: " << stl_time << " 秒" << endl;
+        TEST(vec == expected);
+
+        // 稳定性：大量重复键值
+        TEST(tim_sort_matches(generate_keyed(generate_random_ints(N, 0, 1000))));
+
+        // 降序比较器、字符串、deque与原生数组
+        vec = data;
+        tim_sort(vec, greater<int>());
+        TEST(is_sorted(vec.begin(), vec.end(), greater<int>()));
+        vector<string> strs;
+        for (int v : generate_random_ints(50000, 0, 100000)) strs.push_back(to_string(v));
+        vector<string> expected_strs = strs;
+        sort(expected_strs.begin(), expected_strs.end());
+        tim_sort(strs);
+        TEST(strs == expected_strs);
+        deque<int> dq(data.begin(), data.begin() + 100000);
+        tim_sort(dq);
+        TEST(is_sorted(dq.begin(), dq.end()));
+        int arr[] = {9, -3, 7, 0, 2, 2, -8, 5};
+        tim_sort(begin(arr), end(arr));
+        TEST(is_sorted(begin(arr), end(arr)));
+
+        // 只能移动的元素
+        vector<MoveOnlyItem> items;
+        for (int v : generate_random_ints(10000, 0, 100)) items.emplace_back(v, static_cast<int>(items.size()));
+        tim_sort(items, [](const MoveOnlyItem& a, const MoveOnlyItem& b)
+                 { return a.key < b.key; });
+        bool ordered = true;
+        for (size_t i = 1; i < items.size(); ++i)
+        {
+            ordered = ordered && (items[i - 1].key < items[i].key ||
+                                  (items[i - 1].key == items[i].key && *items[i - 1].payload < *items[i].payload));
+        }
+        TEST(ordered);
+    }
+
+    print_separator("11. Timsort接近有序输入的比较次数");
+    {
+        vector<int> sorted_data(N);
+        for (size_t i = 0; i < N; ++i) sorted_data[i] = static_cast<int>(i);
+
+        size_t comparisons = 0;
+        vector<int> vec = sorted_data;
+        tim_sort(vec, CountingLess{&comparisons});
+        TEST(comparisons == N - 1); // 有序：一次扫描
+
+        comparisons = 0;
+        vec.assign(sorted_data.rbegin(), sorted_data.rend());
+        tim_sort(vec, CountingLess{&comparisons});
+        TEST(vec == sorted_data);
+        TEST(comparisons == N - 1); // 严格逆序：一次扫描加反转
+
+        double log2n = log2(static_cast<double>(N));
+        size_t merge_comparisons = 0;
+        vec = sorted_data;
+        merge_sort(vec, CountingLess{&merge_comparisons});
+
+        // 有序数据末尾追加少量乱序数据（时间序列的典型形态）
+        vector<int> appended = sorted_data;
+        auto tail = generate_random_ints(1000, 0, static_cast<int>(N));
+        appended.insert(appended.end(), tail.begin(), tail.end());
+        // 若干有序段拼接
+        vector<int> concatenated;
+        for (int seg = 0; seg < 8; ++seg)
+        {
+            for (size_t i = 0; i < N / 8; ++i) concatenated.push_back(static_cast<int>(i * 8 + (seg * 7) % 8));
+        }
+        // 少量随机位置交换
+        vector<int> swapped = sorted_data;
+        mt19937 gen(11);
+        for (int i = 0; i < 100; ++i) swap(swapped[gen() % N], swapped[gen() % N]);
+
+        vector<vector<int>> patterns = {appended, concatenated, swapped};
+        for (size_t p = 0; p < patterns.size(); ++p)
+        {
+            comparisons = 0;
+            vec = patterns[p];
+            ctimer timer;
+            tim_sort(vec, CountingLess{&comparisons});
+            double elapsed = timer.elapsed();
+            cout << "模式" << p << ": " << elapsed << " 秒, 比较次数/n = " << static_cast<double>(comparisons) / vec.size()
+                 << " (merge_sort有序输入: " << static_cast<double>(merge_comparisons) / N << ")" << endl;
+            vector<int> expected = patterns[p];
+            sort(expected.begin(), expected.end());
+            TEST(vec == expected);
+            TEST(comparisons < vec.size() * log2n / 4);
+        }
+    }
+
+    print_separator("12. Timsort随机小规模数据与飞奔合并");
+    {
+        mt19937 gen(13);
+        bool all_match = true;
+        for (size_t size = 0; size < 1500; size += 1 + size / 50)
+        {
+            int max_val = static_cast<int>(gen() % 50) + 1;
+            all_match = all_match && tim_sort_matches(generate_keyed(generate_random_ints(size, 0, max_val, static_cast<unsigned>(size))));
+        }
+        TEST(all_match);
+
+        // 交替出现的长有序块，触发飞奔模式与阈值自适应
+        for (int block : {1, 3, 7, 8, 20, 100, 5000})
+        {
+            vector<int> keys;
+            for (int i = 0; keys.size() < 200000; ++i)
+            {
+                int base = (i % 2 == 0) ? i * block : (i - 1) * block + block / 2;
+                for (int j = 0; j < block; ++j) keys.push_back(base + j % (block / 2 + 1));
+            }
+            all_match = all_match && tim_sort_matches(generate_keyed(keys));
+            reverse(keys.begin(), keys.end());
+            all_match = all_match && tim_sort_matches(generate_keyed(keys));
+        }
+        TEST(all_match);
+
+        // 多个随机长度的有序段拼接
+        for (unsigned seed = 0; seed < 50; ++seed)
+        {
+            mt19937 seg_gen(seed);
+            vector<int> keys;
+            while (keys.size() < 20000)
+            {
+                auto seg = generate_random_ints(seg_gen() % 3000 + 1, 0, 500, seg_gen());
+                if (seg_gen() % 2)
+                    sort(seg.begin(), seg.end());
+                else
+                    sort(seg.begin(), seg.end(), greater<int>());
+                keys.insert(keys.end(), seg.begin(), seg.end());
+            }
+            all_match = all_match && tim_sort_matches(generate_keyed(keys));
+        }
+        TEST(all_match);
+    }
+}
+
+// 检查nth_element结果：nth处的值正确，且两侧分别不大于/不小于它
+template <typename T, typename Compare = less<T>>
+bool nth_element_ok(vector<T> data, size_t n, const Compare& comp = Compare())
+{
+    vector<T> expected = data;
+    sort(expected.begin(), expected.end(), comp);
+    ol::nth_element(data.begin(), data.begin() + n, data.end(), comp);
+    for (size_t i = 0; i < n; ++i)
+        if (comp(data[n], data[i])) return false;
+    for (size_t i = n + 1; i < data.size(); ++i)
+        if (comp(data[i], data[n])) return false;
+    return !comp(data[n], expected[n]) && !comp(expected[n], data[n]);
+}
+
+// 检查partial_sort结果：前k个与完整排序一致，其余元素构成的多重集不变
+template <typename T, typename Compare = less<T>>
+bool partial_sort_ok(vector<T> data, size_t k, const Compare& comp = Compare())
+{
+    vector<T> expected = data;
+    sort(expected.begin(), expected.end(), comp);
+    ol::partial_sort(data, k, comp);
+    if (!equal(data.begin(), data.begin() + min(k, data.size()), expected.begin())) return false;
+    sort(data.begin(), data.end(), comp);
+    return data == expected;
+}
+
+void test_selection()
+{
+    const size_t N = 1000000;
+
+    print_separator("13. 部分排序与选择第n个元素");
+    {
+        auto data = generate_random_ints(N, -1000000000, 1000000000);
+
+        // 取前100名：堆选择
+        vector<int> vec = data;
+        ctimer timer;
+        ol::partial_sort(vec, 100);
+        double partial_time = timer.elapsed();
+        vector<int> full = data;
+        timer.start();
+        intro_sort(full);
+        double full_time = timer.elapsed();
+        cout << "partial_sort前100 (" << N << "元素): " << partial_time << " 秒, 完整intro_sort: " << full_time << " 秒" << endl;
+        TEST(equal(vec.begin(), vec.begin() + 100, full.begin()));
+
+        // 中位数
+        vec = data;
+        timer.start();
+        ol::nth_element(vec, N / 2);
+        cout << "nth_element中位数: " << timer.elapsed() << " 秒" << endl;
+        TEST(vec[N / 2] == full[N / 2]);
+
+        // 大k：选择后排序；比较器与迭代器版本
+        TEST(partial_sort_ok(vector<int>(data.begin(), data.begin() + 100000), 60000));
+        TEST(partial_sort_ok(vector<int>(data.begin(), data.begin() + 100000), 500, greater<int>()));
+        TEST(partial_sort_ok(vector<int>(data.begin(), data.begin() + 1000), 5000)); // k超过大小时完整排序
+        TEST(partial_sort_ok(vector<int>(data.begin(), data.begin() + 1000), 0));
+        vector<string> strs;
+        for (int v : generate_random_ints(20000, 0, 1000)) strs.push_back(to_string(v));
+        TEST(partial_sort_ok(strs, 50));
+        TEST(nth_element_ok(strs, 12345));
+        deque<int> dq(data.begin(), data.begin() + 10000);
+        ol::partial_sort(dq.begin(), dq.begin() + 10, dq.end());
+        TEST(is_sorted(dq.begin(), dq.begin() + 10));
+        TEST(*max_element(dq.begin(), dq.begin() + 10) <= *min_element(dq.begin() + 10, dq.end()));
+
+        bool threw = false;
+        try
+        {
+            ol::nth_element(vec, N);
+        }
+        catch (const invalid_argument&)
+        {
+            threw = true;
+        }
+        TEST(threw);
+
+        // 对抗性输入与小规模随机数据
+        vector<int> v(N);
+        for (size_t i = 0; i < N; ++i) v[i] = static_cast<int>(i < N / 2 ? i : N - i);
+        size_t comparisons = 0;
+        vector<int> organ = v;
+        ol::nth_element(organ.begin(), organ.begin() + N / 3, organ.end(), CountingLess{&comparisons});
+        cout << "管风琴序列nth_element比较次数/n = " << static_cast<double>(comparisons) / N << endl;
+        TEST(comparisons < 20 * N);
+        TEST(nth_element_ok(v, N / 3));
+        TEST(nth_element_ok(vector<int>(N, 7), N / 2));
+        TEST(nth_element_ok(generate_random_ints(N, 0, 3), N / 4));
+
+        mt19937 gen(17);
+        bool all_ok = true;
+        for (size_t size = 1; size < 400; ++size)
+        {
+            auto small = generate_random_ints(size, 0, static_cast<int>(gen() % 30) + 1, static_cast<unsigned>(size));
+            size_t n = gen() % size;
+            all_ok = all_ok && nth_element_ok(small, n) && nth_element_ok(small, n, greater<int>()) &&
+                     partial_sort_ok(small, n) && partial_sort_ok(small, gen() % (size + 2));
+        }
+        TEST(all_ok);
+    }
+
+    print_separator("14. 流式Top-K与跨线程合并");
+    {
+        auto data = generate_random_ints(N, -1000000000, 1000000000);
+        vector<int> full = data;
+        sort(full.begin(), full.end(), greater<int>());
+
+        ctimer timer;
+        vector<int> top = top_k(data, 100, greater<int>());
+        cout << "top_k前100 (" << N << "元素): " << timer.elapsed() << " 秒" << endl;
+        TEST(top == vector<int>(full.begin(), full.begin() + 100));
+        TEST(top_k(data.begin(), data.end(), 10) == top_k(data, 10));
+        TEST(top_k(data, 0).empty());
+        TEST(top_k(vector<int>{3, 1, 2}, 10) == (vector<int>{1, 2, 3}));
+
+        // 每个线程各自累加，最后合并
+        const size_t THREADS = 4;
+        vector<TopK<int, greater<int>>> partial(THREADS, TopK<int, greater<int>>(100));
+        vector<thread> threads;
+        for (size_t t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&, t]()
+                                 {
+                for (size_t i = t; i < N; i += THREADS) partial[t].push(data[i]); });
+        }
+        for (auto& th : threads) th.join();
+        TopK<int, greater<int>> merged(100);
+        merged.merge(partial[0]);
+        for (size_t t = 1; t < THREADS; ++t) merged.merge(std::move(partial[t]));
+        TEST(merged.size() == 100);
+        TEST(merged.threshold() == full[99]);
+        TEST(merged.sorted() == top);
+        TEST(merged.take_sorted() == top);
+        TEST(merged.empty());
+
+        // 保留记录而非数值；push返回值
+        TopK<pair<int, string>> smallest(2);
+        TEST(smallest.push({5, "e"}));
+        TEST(smallest.push({3, "c"}));
+        TEST(!smallest.push({9, "i"}));
+        TEST(smallest.push({1, "a"}));
+        vector<pair<int, string>> expected_pairs = {{1, "a"}, {3, "c"}};
+        TEST(smallest.sorted() == expected_pairs);
+        TopK<int> none(0);
+        TEST(!none.push(1));
+        TEST(none.empty());
+
+        // k为SIZE_MAX表示不限个数：构造时不按k预分配，保留全部元素
+        TopK<int> unbounded(numeric_limits<size_t>::max());
+        unbounded.push(data.begin(), data.begin() + 10000);
+        TEST(unbounded.size() == 10000);
+        vector<int> first10k(data.begin(), data.begin() + 10000);
+        sort(first10k.begin(), first10k.end());
+        TEST(unbounded.take_sorted() == first10k);
+        TEST(top_k(vector<int>{3, 1, 2}, numeric_limits<size_t>::max()) == (vector<int>{1, 2, 3}));
+    }
+}
+
+// ============================================================================
+// 15. 计数排序/桶排序复用工作区
+// ============================================================================
+void test_workspace_sort()
+{
+    print_separator("15. 计数排序/桶排序复用工作区");
+    {
+        // 滑动窗口：每个窗口都用同一个工作区排序，结果与std::sort一致
+        const size_t N = 1000000, WINDOW = 4096;
+        auto data = generate_random_ints(N, -5000, 5000);
+        SortWorkspace<int> ws;
+        ws.reserve(WINDOW, 10001);
+        const size_t* counts_data = ws.counts.data();
+
+        bool all_match = true;
+        vector<int> window(WINDOW), expected(WINDOW);
+        ctimer timer;
+        for (size_t i = 0; i + WINDOW <= N; i += WINDOW)
+        {
+            window.assign(data.begin() + i, data.begin() + i + WINDOW);
+            counting_sort(window, ws);
+            expected.assign(data.begin() + i, data.begin() + i + WINDOW);
+            sort(expected.begin(), expected.end());
+            if (window != expected) all_match = false;
+        }
+        cout << "counting_sort滑动窗口 (" << N / WINDOW << "个窗口): " << timer.elapsed() << " 秒" << endl;
+        TEST(all_match);
+        TEST(ws.counts.data() == counts_data); // 未重新分配
+
+        window.assign(data.begin(), data.begin() + WINDOW);
+        counting_sort(window.begin(), window.end(), ws, greater<int>());
+        TEST(is_sorted(window.begin(), window.end(), greater<int>()));
+        TEST(ws.counts.data() == counts_data);
+
+        // 值域过大
+        vector<int64_t> wide = {numeric_limits<int64_t>::min(), numeric_limits<int64_t>::max()};
+        SortWorkspace<int64_t> wide_ws;
+        bool threw = false;
+        try
+        {
+            counting_sort(wide, wide_ws);
+        }
+        catch (const length_error&)
+        {
+            threw = true;
+        }
+        TEST(threw);
+    }
+    {
+        // 桶排序：与不带工作区的版本结果完全一致，扁平缓冲区复用
+        auto ints = generate_random_ints(100000, -1000000, 1000000);
+        vector<double> doubles;
+        mt19937 gen(7);
+        uniform_real_distribution<double> dist(0.0, 1.0);
+        for (size_t i = 0; i < 100000; ++i) doubles.push_back(dist(gen));
+
+        SortWorkspace<int> int_ws;
+        SortWorkspace<double> double_ws;
+        for (int round = 0; round < 3; ++round)
+        {
+            vector<int> a = ints, b = ints;
+            bucket_sort(a, 64);
+            bucket_sort(b, int_ws, 64);
+            TEST(a == b);
+            TEST(is_sorted(b.begin(), b.end()));
+
+            a = ints, b = ints;
+            bucket_sort(a, 100, greater<int>());
+            bucket_sort(b.begin(), b.end(), int_ws, 100, greater<int>());
+            TEST(a == b);
+            TEST(is_sorted(b.begin(), b.end(), greater<int>())); // 降序比较器按相反的顺序编号桶
+
+            vector<double> c = doubles, d = doubles;
+            bucket_sort(c, 1000);
+            bucket_sort(d, double_ws, 1000);
+            TEST(c == d);
+            TEST(is_sorted(d.begin(), d.end()));
+
+            // 超出[min_val, max_val]的值归入首尾桶
+            c = doubles, d = doubles;
+            bucket_sort(c, 50, 0.25, 0.75);
+            bucket_sort(d.begin(), d.end(), double_ws, 50, 0.25, 0.75);
+            TEST(c == d);
+            TEST(is_sorted(d.begin(), d.end()));
+
+            c = doubles, d = doubles;
+            bucket_sort(c, 1000, 0.0, 1.0, greater<double>());
+            bucket_sort(d.begin(), d.end(), double_ws, 1000, 0.0, 1.0, greater<double>());
+            TEST(c == d);
+            TEST(is_sorted(d.begin(), d.end(), greater<double>()));
+        }
+        const int* buffer_data = int_ws.buffer.data();
+        vector<int> e = ints;
+        bucket_sort(e, int_ws, 64);
+        TEST(int_ws.buffer.data() == buffer_data);
+
+        bool threw = false;
+        try
+        {
+            bucket_sort(e, int_ws, 0);
+        }
+        catch (const invalid_argument&)
+        {
+            threw = true;
+        }
+        TEST(threw);
+    }
+}
+
+// ============================================================================
+// 16. MSD字符串基数排序：重复字符串与前缀字符串
+// ============================================================================
+void test_radix_sort_msd()
+{
+    print_separator("16. MSD字符串基数排序：重复与前缀字符串");
+    {
+        // 相等的字符串和已经读完的字符串不再继续按下一个字符递归
+        vector<string> words = {"a", "a", "ab", "", "a"};
+        radix_sort_msd(words);
+        TEST((words == vector<string>{"", "a", "a", "a", "ab"}));
+
+        vector<string> same(10000, string(200, 'x')); // 大量相同的长字符串
+        same.push_back(string(100, 'x'));
+        same.push_back("");
+        vector<string> expected = same;
+        sort(expected.begin(), expected.end());
+        radix_sort_msd(same);
+        TEST(same == expected);
+
+        // 随机前缀：每个字符串都是同一个字符串的前缀，且大量重复
+        mt19937 gen(16);
+        const string base = "prefix-sharing-string";
+        vector<string> prefixes;
+        for (int i = 0; i < 5000; ++i) prefixes.push_back(base.substr(0, gen() % (base.size() + 1)));
+        expected = prefixes;
+        sort(expected.begin(), expected.end());
+        radix_sort_msd(prefixes);
+        TEST(prefixes == expected);
+    }
+}
+
+int main()
+{
+    test_parallel_sort();
+    test_intro_sort();
+    test_radix256_sort();
+    test_tim_sort();
+    test_selection();
+    test_workspace_sort();
+    test_radix_sort_msd();
+
+    cout << "\nAll tests passed!" << endl;
+    return 0;
+}
@@ -5,8 +5,11 @@
 #include <iostream>
 #include <string.h>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #ifdef __unix__
+#include <sys/uio.h>
 #include <unistd.h>
 #endif // __unix__
 
@@ -14,40 +17,65 @@ namespace ol
 {
 
 #ifdef __unix__
+    /**
+     * @brief 网络收发缓冲区（读写下标 + 头部预留空间）
+     * @note
+     * - 布局：| 预留空间 | 可读数据 [m_readIdx, m_writeIdx) | 可写空间 |
+     * - 消费数据只移动读下标，不搬移剩余数据；只有追加数据且尾部空间不足时才整理（搬移到头部）或扩容，
+     *   因此每拆出一个报文的代价与缓冲区中积压的数据量无关
+     * - pickMessage(std::string_view&)返回指向缓冲区内部的视图，在下一次向缓冲区写入数据（append/recvFd）之前有效
+     */
     class Buffer
     {
+    public:
+        static constexpr size_t PREPEND_SIZE = 8;       ///< 头部预留空间的大小。
+        static constexpr size_t INITIAL_SIZE = 1024;    ///< 初始可写空间的大小。
+        static constexpr size_t EXTRA_BUF_SIZE = 65536; ///< recvFd()在栈上使用的额外缓冲区的大小。
+
     private:
-        std::string m_buf;    ///< 用于存放数据。
-        const uint16_t m_sep; ///< 报文的分隔符：0-无分隔符(固定长度、视频会议)；1-四字节的报头；2-"\r\n\r\n"分隔符（http协议）。
+        std::vector<char> m_buf; ///< 用于存放数据。
+        size_t m_readIdx;        ///< 可读数据的起始位置。
+        size_t m_writeIdx;       ///< 可读数据的结束位置（可写空间的起始位置）。
+        const uint16_t m_sep;    ///< 报文的分隔符：0-无分隔符(固定长度、视频会议)；1-四字节的报头；2-"\r\n\r\n"分隔符（http协议）。
 
     public:
-        Buffer(uint16_t sep = 1);
+        Buffer(uint16_t sep = 1, size_t initialSize = INITIAL_SIZE);
         ~Buffer();
 
-        void append(const char* data, size_t size);        // 把数据追加到m_buf中。
-        void appendWithSep(const char* data, size_t size); // 把数据追加到m_buf中，附加报文头部4字节（报文长度）。
-        inline void erase(size_t pos, size_t n)            // 从m_buf的pos开始，删除n个字节，pos从0开始。
+        void append(const char* data, size_t size);        // 把数据追加到缓冲区中。
+        void appendWithSep(const char* data, size_t size); // 把数据追加到缓冲区中，附加报文头部4字节（报文长度）。
+
+        void retrieve(size_t n); // 消费（丢弃）可读数据的前n个字节，只移动读下标。
+
+        // 返回可读数据的大小。
+        inline size_t size() const
         {
-            m_buf.erase(pos, n);
+            return m_writeIdx - m_readIdx;
         }
 
-        size_t size(); // 返回m_buf的大小。
-
-        const char* data(); // 返回m_buf的首地址。
+        // 返回可读数据的首地址。
+        inline const char* data() const
+        {
+            return m_buf.data() + m_readIdx;
+        }
 
-        void clear(); // 清空m_buf。
+        void clear(); // 清空缓冲区（不释放内存）。
 
         inline bool empty() const
         {
-            return m_buf.empty();
+            return m_readIdx == m_writeIdx;
         }
 
-        bool pickMessage(std::string& s); // 从m_buf中拆分出一个报文，存放在s中，如果m_buf中没有报文，返回false。
+        bool pickMessage(std::string_view& msg); // 从缓冲区中拆分出一个报文（不拷贝），如果缓冲区中没有完整的报文，返回false。
+        bool pickMessage(std::string& s);        // 从缓冲区中拆分出一个报文，拷贝到s中，如果缓冲区中没有完整的报文，返回false。
 
-        ssize_t recvFd(int fd); // 从fd读取数据到缓冲区（非阻塞模式）
+        ssize_t recvFd(int fd); // 从fd读取数据到缓冲区（非阻塞模式，readv()同时读入可写空间和栈上的额外缓冲区）
+
+    private:
+        void ensureWritable(size_t n); // 保证尾部至少有n字节可写空间：优先整理已消费的头部空间，不够再扩容。
     };
 #endif // __unix__
 
 } // namespace ol
 
-#endif // !OL_BUFFER_H
\ No newline at end of file
+#endif // !OL_BUFFER_H
@@ -42,6 +42,7 @@ namespace ol
         bool getInEpoll();     // 返回m_inepoll成员。
         uint32_t getEvents();  // 返回m_events成员。
         uint32_t getRevents(); // 返回m_revents成员。
+        bool isWriting();      // 是否已注册写事件。
 
         void useET();          // 采用边缘触发。
         void enableReading();  // 让epoll_wait()监视m_fd的读事件。
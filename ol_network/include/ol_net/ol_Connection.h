@@ -7,10 +7,15 @@
 #include "ol_net/ol_EventLoop.h"
 #include "ol_net/ol_InetAddr.h"
 #include "ol_net/ol_SocketFd.h"
+#include "ol_net/ol_WriteQueue.h"
 #include "ol_net/ol_net_fwd_decls.h"
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #ifdef __unix__
 #include <sys/syscall.h>
@@ -26,18 +31,35 @@ namespace ol
         using Ptr = std::shared_ptr<Connection>;
 
     private:
+        // 工作线程提交、等待IO线程发送的一个报文。
+        struct PendingSend
+        {
+            std::string owned;    ///< 移交所有权的报文体（shared为空时使用）。
+            SharedPayload shared; ///< 共享的报文体。
+        };
+
         EventLoop* m_eventLoop;          ///< Connection对应的事件循环，在构造函数中传入。
         SocketFdPtr m_cliFd;             ///< 与客户端通讯的Socket。
         ChannelPtr m_cliChnl;            ///< Connection对应的Channel，在构造函数中创建。
         Buffer m_inputBuf;               ///< 接收缓冲区
-        Buffer m_outputBuf;              ///< 发送缓冲区
+        WriteQueue m_outputQueue;        ///< 发送队列（报头与报文体分段排队，writev()发送）
         std::atomic_bool m_disconnected; ///< 客户端连接是否已断开，如果已断开，则设置为true。
         TimeStamp m_lastATime;           ///< 时间戳，创建Connection对象时为当前时间，每接收到一个报文，把时间戳更新为当前时间。
 
         std::function<void(ConnectionPtr)> m_closeCb;                   ///< 关闭fd_的回调函数，将回调TcpServer::closeConnection()。
         std::function<void(ConnectionPtr)> m_errorCb;                   ///< fd_发生了错误的回调函数，将回调TcpServer::errorConnection()。
-        std::function<void(ConnectionPtr, std::string&)> m_onMessageCb; ///< 处理报文的回调函数，将回调TcpServer::onMessage()。
+        std::function<void(ConnectionPtr, std::string_view)> m_onMessageCb; ///< 处理报文的回调函数，将回调TcpServer::onMessage()，报文是指向接收缓冲区的视图。
         std::function<void(ConnectionPtr)> m_sendCompleteCb;            ///< 发送数据完成后的回调函数，将回调TcpServer::sendComplete()。
+        std::function<void(ConnectionPtr, size_t)> m_highWaterMarkCb;   ///< 发送队列积压超过高水位的回调函数，将回调TcpServer::highWaterMark()。
+        std::function<void(ConnectionPtr)> m_lowWaterMarkCb;            ///< 发送队列从高水位回落到低水位的回调函数，将回调TcpServer::lowWaterMark()。
+        size_t m_highWaterMark;                                         ///< 高水位（字节）。
+        size_t m_lowWaterMark;                                          ///< 低水位（字节）。
+        bool m_aboveHighWaterMark;                                      ///< 发送队列是否越过了高水位且尚未回落到低水位。
+        bool m_inSendCompleteCb;                                        ///< 是否正在执行发送完成回调（回调中再次发送完成时推迟回调，防止递归）。
+
+        std::mutex m_pendingMutex;              ///< 保护m_pendingSends和m_flushQueued的互斥锁。
+        std::vector<PendingSend> m_pendingSends; ///< 工作线程提交、尚未交给发送队列的报文。
+        bool m_flushQueued;                      ///< 是否已向事件循环提交了_flushPending()任务（尚未执行）。
     public:
         Connection(EventLoop* eventLoop, SocketFdPtr cliFd);
         ~Connection();
@@ -48,8 +70,16 @@ namespace ol
 
         void setCloseCb(std::function<void(ConnectionPtr)> func);                   // 设置关闭m_fd的回调函数。
         void setErrorCb(std::function<void(ConnectionPtr)> func);                   // 设置m_fd发生了错误的回调函数。
-        void setOnMessageCb(std::function<void(ConnectionPtr, std::string&)> func); // 设置处理报文的回调函数。
-        void setSendCompleteCb(std::function<void(ConnectionPtr)> func);            // 发送数据完成后的回调函数。
+        void setOnMessageCb(std::function<void(ConnectionPtr, std::string_view)> func); // 设置处理报文的回调函数（报文视图只在回调期间有效）。
+        // 发送数据完成后的回调函数：直接写完时在send()返回前回调；回调中再次send()且直接写完时，
+        // 这次回调推迟到事件循环的下一轮执行，不会递归。
+        void setSendCompleteCb(std::function<void(ConnectionPtr)> func);
+
+        // 设置高水位回调：发送队列积压的字节数达到highWaterMark时回调一次（参数为积压的字节数），上层应暂停发送。
+        void setHighWaterMarkCb(std::function<void(ConnectionPtr, size_t)> func, size_t highWaterMark = 64 * 1024 * 1024);
+        // 设置低水位回调：越过高水位后，发送队列回落到lowWaterMark及以下时回调一次，上层可恢复发送。
+        void setLowWaterMarkCb(std::function<void(ConnectionPtr)> func, size_t lowWaterMark = 0);
+        size_t pendingBytes() const; // 返回发送队列中待发送的字节数（在IO线程中调用）。
 
         void closeCb(); // TCP连接关闭（断开）的回调函数，供Channel回调。
         void errorCb(); // TCP连接错误的回调函数，供Channel回调。
@@ -57,8 +87,16 @@ namespace ol
 
         void onMessage();                         // 处理对端发送过来的消息。
         void send(const char* data, size_t size); // 发送数据，不管在任何线程中，都是调用此函数发送数据。
+        void send(std::string&& payload);         // 发送数据，报文体的所有权移交给连接，不再拷贝。
+        void send(SharedPayload payload);         // 发送数据，报文体与其它连接/其它发送共享（如广播），不再拷贝。
     private:
-        void _sendInLoop(const char* data, size_t size); // 发送数据，如果当前线程是IO线程，直接调用此函数，如果是工作线程，将把此函数传给IO线程去执行。
+        void _sendInLoop(const char* data, size_t size); // 发送数据，如果当前线程是IO线程，直接调用此函数（拷贝报文到发送队列）。
+        void _sendInLoop(std::string&& payload);         // 发送数据，报文体移入发送队列，不再拷贝。
+        void _sendInLoop(SharedPayload payload);         // 发送数据，共享的报文体放入发送队列，不再拷贝。
+        void _queueSend(PendingSend&& pending);          // 工作线程发送数据：报文放入待发送列表，只有列表原本为空时才向事件循环提交任务。
+        void _flushPending();                            // 在IO线程中把待发送列表中的报文按顺序交给发送队列。
+        void _afterSend();                               // 写socket/排队之后：全部发送完成则回调，否则检查高水位并注册写事件。
+        void _sendComplete();                            // 回调发送完成，正在回调中时推迟到事件循环的下一轮。
 
     public:
         bool timeout(time_t now, int val); // 判断TCP连接是否超时（空闲太久）。
@@ -1,6 +1,7 @@
 #ifndef OL_EVENTLOOP_H
 #define OL_EVENTLOOP_H 1
 
+#include "ol_Task.h"
 #include "ol_net/ol_Channel.h"
 #include "ol_net/ol_Connection.h"
 #include "ol_net/ol_EpollChnl.h"
@@ -10,9 +11,9 @@
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <unistd.h>
 #include <unordered_map>
+#include <vector>
 
 #ifdef __unix__
 #include <sys/eventfd.h>
@@ -37,9 +38,11 @@ namespace ol
         int m_timeout;                                    ///< Connection对象超时的时间，单位：秒。
         EpollChnlPtr m_epChnl;                            ///< 每个事件循环只有一个EpollChnl。
         std::function<void(EventLoop*)> m_epollTimeoutCb; ///< epoll_wait()超时的回调函数。
-        pid_t m_threadId;                                 ///< 事件循环所在线程的id。
-        std::mutex m_taskQueueMutex;                      ///< 任务队列同步的互斥锁。
-        std::queue<std::function<void()>> m_taskQueue;    ///< 事件循环线程被eventfd唤醒后执行的任务队列。
+        std::atomic<pid_t> m_threadId;                    ///< 事件循环所在线程的id（其他线程会调用isInLoopThread()读取）。
+        std::mutex m_taskQueueMutex;                      ///< 保护m_taskQueue和m_wakeUpPending的互斥锁。
+        std::vector<Task> m_taskQueue;                    ///< 其它线程提交、等待事件循环线程执行的任务。
+        std::vector<Task> m_runningTasks;                 ///< 事件循环线程正在执行的一批任务（与m_taskQueue交换，在锁外执行，容量复用）。
+        bool m_wakeUpPending;                             ///< 是否已写过eventfd且事件循环尚未取走任务，为true时提交任务不再写eventfd。
         int m_wakeUpFd;                                   ///< 用于唤醒事件循环线程的eventfd。
         ChannelPtr m_wakeUpChnl;                          ///< eventfd的Channel。
         int m_timerFd;                                    ///< 定时器的fd。
@@ -59,9 +62,9 @@ namespace ol
         void updateChnl(Channel* ch); // 把channel添加/更新到红黑树上，channel中有fd，也有需要监视的事件。
         void removeChnl(Channel* ch); // 从红黑树上删除channel。
 
-        void pushToQueue(std::function<void()> func); // 把任务添加到队列中。
+        void pushToQueue(Task func);                  // 把任务添加到队列中，只有没有未处理的唤醒时才写eventfd。
         void wakeUp();                                // 用eventfd唤醒事件循环线程。
-        void handleWakeUp();                          // 事件循环线程被eventfd唤醒后执行的函数。
+        void handleWakeUp();                          // 事件循环线程被eventfd唤醒后执行的函数（整批取走任务，在锁外执行）。
 
         void handleTimer(); // 闹钟响时执行的函数。
 
@@ -0,0 +1,115 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_FdAwaiter.h
+ * 功能描述：等待EventLoop上fd就绪的协程可等待对象（C++20，需开启OL_ENABLE_COROUTINES），特性包括：
+ *          - co_await ol::readable(loop, fd) / ol::writable(loop, fd)：挂起协程直到fd可读/可写（或出错、对端关闭），
+ *            返回epoll报告的事件位
+ *          - 可指定恢复协程的执行器（如ThreadPool::executor()），不指定时在事件循环线程上直接恢复
+ *          - 一次性注册：就绪后立即从epoll树上摘除，Channel延迟到本轮事件处理结束后在事件循环线程上销毁
+ *          - 挂起期间不占用任何线程，少量线程即可同时等待成千上万个fd
+ * 作者：ol
+ * 适用标准：C++20及以上；C++17下本头文件为空
+ */
+/****************************************************************************************/
+
+#ifndef OL_FDAWAITER_H
+#define OL_FDAWAITER_H 1
+
+#include "ol_coroutine.h"
+
+#if defined(OL_COROUTINE_ENABLED) && defined(__unix__)
+
+#include "ol_Future.h"
+#include "ol_Task.h"
+#include "ol_net/ol_Channel.h"
+#include "ol_net/ol_EventLoop.h"
+#include <coroutine>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace ol
+{
+    // 等待fd就绪的可等待对象。
+    // fd不能已经注册在同一个事件循环上（如Connection的fd），否则epoll_ctl(ADD)会失败。
+    class FdAwaiter
+    {
+    private:
+        EventLoop& m_loop;      ///< fd注册所在的事件循环。
+        int m_fd;               ///< 等待的fd。
+        bool m_writing;         ///< true-等待可写，false-等待可读。
+        Executor m_executor;    ///< 恢复协程的执行器，为空时在事件循环线程上直接恢复。
+        ChannelPtr m_channel;   ///< 等待期间使用的Channel。
+        uint32_t m_revents = 0; ///< 就绪时epoll报告的事件。
+        bool m_dropped = false; ///< 执行器是否丢弃了恢复任务。
+
+    public:
+        FdAwaiter(EventLoop& loop, int fd, bool writing, Executor executor)
+            : m_loop(loop), m_fd(fd), m_writing(writing), m_executor(std::move(executor)) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_channel = std::make_unique<Channel>(&m_loop, m_fd);
+
+            // 所有事件回调都指向同一个一次性函数：读写就绪、对端关闭和错误都唤醒协程，由调用方检查返回的事件位。
+            auto fire = [this, handle, executor = m_executor]()
+            {
+                Channel* chnl = m_channel.get();
+                m_revents = chnl->getRevents();
+                chnl->remove();
+
+                // 此刻仍处在Channel::handleEvent()中，Channel（以及本回调）要等本轮事件处理结束后再销毁。
+                m_loop.pushToQueue([chnl = std::move(m_channel)]() {});
+
+                // 恢复后协程帧（包括本对象）可能随即销毁，之后不能再访问this。
+                if (executor)
+                    executor([resumer = base::CoResumer(handle, &m_dropped)]() mutable
+                             { resumer(); });
+                else
+                    handle.resume();
+            };
+            m_channel->setReadCb(fire);
+            m_channel->setWriteCb(fire);
+            m_channel->setCloseCb(fire);
+            m_channel->setErrorCb(fire);
+
+            // epoll注册必须在事件循环线程上进行。
+            Channel* chnl = m_channel.get();
+            bool writing = m_writing;
+            if (m_loop.isInLoopThread())
+            {
+                writing ? chnl->enableWriting() : chnl->enableReading();
+            }
+            else
+            {
+                m_loop.pushToQueue([chnl, writing]()
+                                   { writing ? chnl->enableWriting() : chnl->enableReading(); });
+            }
+        }
+
+        uint32_t await_resume() const
+        {
+            if (m_dropped) throw std::runtime_error("[ol::FdAwaiter] Resume task was dropped by the executor");
+            return m_revents;
+        }
+    };
+
+    // 等待fd可读，返回epoll报告的事件位（EPOLLIN/EPOLLRDHUP/EPOLLERR等）。
+    inline FdAwaiter readable(EventLoop& loop, int fd, Executor executor = Executor())
+    {
+        return FdAwaiter(loop, fd, false, std::move(executor));
+    }
+
+    // 等待fd可写，返回epoll报告的事件位。
+    inline FdAwaiter writable(EventLoop& loop, int fd, Executor executor = Executor())
+    {
+        return FdAwaiter(loop, fd, true, std::move(executor));
+    }
+} // namespace ol
+
+#endif // OL_COROUTINE_ENABLED && __unix__
+
+#endif // !OL_FDAWAITER_H
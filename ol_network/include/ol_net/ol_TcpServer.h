@@ -30,12 +30,17 @@ namespace ol
         std::function<void(ConnectionPtr)> m_newConnCb;                         ///< 回调上层业务类的handleNewConn()。
         std::function<void(ConnectionPtr)> m_closeCb;                           ///< 回调上层业务类的handleClose()。
         std::function<void(ConnectionPtr)> m_errorCb;                           ///< 回调上层业务类的handleError()。
-        std::function<void(ConnectionPtr, std::string& message)> m_onMessageCb; ///< 回调上层业务类的handleMessage()。
+        std::function<void(ConnectionPtr, std::string_view message)> m_onMessageCb; ///< 回调上层业务类的handleMessage()。
         std::function<void(ConnectionPtr)> m_sendCompleteCb;                    ///< 回调上层业务类的handleSendComplete()。
         std::function<void(EventLoop*)> m_timeoutCb;                            ///< 回调上层业务类的handleTimeOut()。
         std::function<void(int)> m_timerTimeoutCb;                              ///< 回调上层业务类的handleTimerTimeOut()。
+        std::function<void(ConnectionPtr, size_t)> m_highWaterMarkCb;           ///< 回调上层业务类的handleHighWaterMark()。
+        std::function<void(ConnectionPtr)> m_lowWaterMarkCb;                    ///< 回调上层业务类的handleLowWaterMark()。
+        size_t m_highWaterMark = 64 * 1024 * 1024;                              ///< 新连接的高水位（字节）。
+        size_t m_lowWaterMark = 0;                                              ///< 新连接的低水位（字节）。
     public:
-        TcpServer(const std::string& ip, const uint16_t port, size_t threadNum = 3, size_t MainMaxEvents = 100, size_t SubMaxEvents = 100, int epWaitTimeout = 10000, int timerTimetvl = 30, int timerTimeout = 80);
+        // ioCpus：从事件循环（IO线程）绑定的CPU列表，第i个IO线程固定到ioCpus[i % ioCpus.size()]，为空时不绑定。
+        TcpServer(const std::string& ip, const uint16_t port, size_t threadNum = 3, size_t MainMaxEvents = 100, size_t SubMaxEvents = 100, int epWaitTimeout = 10000, int timerTimetvl = 30, int timerTimeout = 80, const std::vector<int>& ioCpus = {});
         ~TcpServer();
 
         void start(int newConnTimeout = 10000); // 运行事件循环。
@@ -44,18 +49,22 @@ namespace ol
         void newConn(SocketFd::Ptr cliFd);                        // 处理新客户端连接请求。
         void closeConn(ConnectionPtr conn);                       // 关闭客户端的连接，在Connection类中回调此函数。
         void errorConn(ConnectionPtr conn);                       // 客户端的连接错误，在Connection类中回调此函数。
-        void onMessage(ConnectionPtr conn, std::string& message); // 处理客户端的请求报文，在Connection类中回调此函数。
+        void onMessage(ConnectionPtr conn, std::string_view message); // 处理客户端的请求报文，在Connection类中回调此函数。
         void sendComplete(ConnectionPtr conn);                    // 数据发送完成后，在Connection类中回调此函数。
         void epollTimeout(EventLoop* eventLoop);                  // epoll_wait()超时，在EventLoop类中回调此函数。
         void removeConn(int fd);                                  // 删除m_conns中的Connection对象，在EventLoop::handleTimer()中将回调此函数。
+        void highWaterMark(ConnectionPtr conn, size_t pending);   // 发送队列越过高水位，在Connection类中回调此函数。
+        void lowWaterMark(ConnectionPtr conn);                    // 发送队列回落到低水位，在Connection类中回调此函数。
 
         void setNewConnCb(std::function<void(ConnectionPtr)> func);
         void setCloseCb(std::function<void(ConnectionPtr)> func);
         void setErrorCb(std::function<void(ConnectionPtr)> func);
-        void setOnMessageCb(std::function<void(ConnectionPtr, std::string& message)> func);
+        void setOnMessageCb(std::function<void(ConnectionPtr, std::string_view message)> func);
         void setSendCompleteCb(std::function<void(ConnectionPtr)> func);
         void setTimeoutCb(std::function<void(EventLoop*)> func);
         void setTimerTimeoutCb(std::function<void(int)> func);
+        void setHighWaterMarkCb(std::function<void(ConnectionPtr, size_t)> func, size_t highWaterMark = 64 * 1024 * 1024); // 对之后建立的连接生效。
+        void setLowWaterMarkCb(std::function<void(ConnectionPtr)> func, size_t lowWaterMark = 0);                           // 对之后建立的连接生效。
     };
 #endif // __unix__
 
@@ -0,0 +1,103 @@
+/****************************************************************************************/
+/*
+ * 程序名：ol_WriteQueue.h
+ * 功能描述：Connection的发送队列，按报文排队若干数据段，用writev()一次系统调用发送多个段，特性包括：
+ *          - 报头/分隔符、小报文等拷贝进来的数据连续存放在一个Buffer中，相邻的拷贝段自动合并
+ *          - 移交所有权的报文体（std::string&&）和共享的报文体（SharedPayload，如广播给多个连接的同一报文）
+ *            作为独立的段排队，发送时直接引用，不再拷贝到缓冲区
+ *          - 部分发送后只推进段内偏移/缓冲区读下标，不搬移剩余数据
+ *          - 队列为空时可直接发送报文（writeMessage），只把内核没有接收的部分放入队列
+ * 作者：ol
+ * 适用标准：C++17及以上
+ */
+/****************************************************************************************/
+
+#ifndef OL_WRITEQUEUE_H
+#define OL_WRITEQUEUE_H 1
+
+#include "ol_net/ol_Buffer.h"
+#include <deque>
+#include <memory>
+#include <string>
+
+#ifdef __unix__
+#include <sys/uio.h>
+#endif // __unix__
+
+namespace ol
+{
+
+#ifdef __unix__
+    using SharedPayload = std::shared_ptr<const std::string>; ///< 多个连接/多次发送共享的只读报文体。
+
+    class WriteQueue
+    {
+    public:
+        static constexpr int MAX_IOVECS = 64; ///< 一次writev()最多发送的段数。
+
+    private:
+        // 发送队列中的一个数据段。
+        struct Segment
+        {
+            size_t copiedBytes;   ///< 大于0：该段是m_copied中按顺序存放的copiedBytes个字节；等于0：该段是报文体。
+            std::string owned;    ///< 移交所有权的报文体（shared为空时使用）。
+            SharedPayload shared; ///< 共享的报文体。
+            size_t offset;        ///< 报文体中已发送的字节数。
+
+            // 返回报文体。
+            inline const std::string& body() const
+            {
+                return shared ? *shared : owned;
+            }
+        };
+
+        Buffer m_copied;                ///< 拷贝进来的数据（报头、分隔符、小报文）。
+        std::deque<Segment> m_segments; ///< 按发送顺序排列的数据段。
+        size_t m_bytes;                 ///< 待发送的总字节数。
+        const uint16_t m_sep;           ///< 报文的分隔符：0-无分隔符；1-四字节的报头；2-"\r\n\r\n"分隔符（与Buffer相同）。
+
+    public:
+        WriteQueue(uint16_t sep = 1);
+        ~WriteQueue();
+
+        void append(const char* data, size_t size);        // 把数据拷贝到队列尾部（不加报头）。
+        void appendMessage(const char* data, size_t size); // 拷贝一个报文到队列尾部，按分隔符附加报头或"\r\n\r\n"。
+        void appendMessage(std::string&& payload);         // 移交一个报文体到队列尾部，报头单独拷贝，报文体不拷贝。
+        void appendMessage(SharedPayload payload);         // 共享一个报文体到队列尾部，报头单独拷贝，报文体不拷贝。
+
+        ssize_t writeFd(int fd); // 用writev()把队列头部的数据段写入fd，返回写入的字节数，失败返回-1。
+
+        // 发送一个报文：队列为空时先用writev()直接写入fd，只把未写入的部分放入队列；队列不为空时直接排队（保证顺序）。
+        // 返回直接写入的字节数，写入失败返回-1（此时整个报文已放入队列）。
+        ssize_t writeMessage(int fd, const char* data, size_t size);
+        ssize_t writeMessage(int fd, std::string&& payload);
+        ssize_t writeMessage(int fd, SharedPayload payload);
+
+        // 返回待发送的总字节数。
+        inline size_t size() const
+        {
+            return m_bytes;
+        }
+
+        inline bool empty() const
+        {
+            return m_bytes == 0;
+        }
+
+        void clear(); // 清空队列。
+
+    private:
+        void appendHeader(size_t size); // 按分隔符拷贝报头（四字节长度）。
+        void appendTrailer();           // 按分隔符拷贝报文尾（"\r\n\r\n"）。
+        void consume(size_t n);         // 从队列头部消费已发送的n个字节。
+
+        void appendBody(Segment&& seg);                                            // 把报文体段及其报头、报文尾排到队列尾部。
+        ssize_t writeBody(int fd, Segment&& seg);                                  // 发送报文体段：队列为空时先直接写入，未写入的部分排队。
+        ssize_t writeDirect(int fd, const char* data, size_t size, uint32_t& len); // 队列为空时用writev()直接写入报头、报文体和报文尾。
+        void appendTail(const char* data, size_t size, uint32_t len, size_t skip); // 把报文中前skip个字节之后的部分拷贝到队列。
+    };
+#endif // __unix__
+
+} // namespace ol
+
+#endif // !OL_WRITEQUEUE_H
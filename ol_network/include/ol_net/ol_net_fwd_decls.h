@@ -18,6 +18,8 @@ namespace ol
 #ifdef __unix__
     class Buffer;
 
+    class WriteQueue;
+
     class InetAddr;
 
     class SocketFd;
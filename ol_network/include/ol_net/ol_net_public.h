@@ -13,6 +13,7 @@
 #ifdef __unix__
 #include "ol_net/ol_net_fwd_decls.h"
 #include "ol_net/ol_Buffer.h"
+#include "ol_net/ol_WriteQueue.h"
 #include "ol_net/ol_InetAddr.h"
 #include "ol_net/ol_Channel.h"
 #include "ol_net/ol_SocketFd.h"
@@ -22,6 +23,7 @@
 #include "ol_net/ol_EpollFd.h"
 #include "ol_net/ol_EventLoop.h"
 #include "ol_net/ol_TcpServer.h"
+#include "ol_net/ol_FdAwaiter.h"
 #endif // __unix__
 
 #endif // !OL_NET_PUBLIC_H
\ No newline at end of file
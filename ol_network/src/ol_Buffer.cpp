@@ -1,4 +1,5 @@
 #include "ol_net/ol_Buffer.h"
+#include <algorithm>
 
 // #define DEBUG
 
@@ -6,7 +7,8 @@ namespace ol
 {
 
 #ifdef __unix__
-    Buffer::Buffer(uint16_t sep) : m_sep(sep)
+    Buffer::Buffer(uint16_t sep, size_t initialSize)
+        : m_buf(PREPEND_SIZE + initialSize), m_readIdx(PREPEND_SIZE), m_writeIdx(PREPEND_SIZE), m_sep(sep)
     {
     }
 
@@ -14,147 +16,180 @@ namespace ol
     {
     }
 
-    // 把数据追加到m_buf中。
+    // 把数据追加到缓冲区中。
     void Buffer::append(const char* data, size_t size)
     {
-        m_buf.append(data, size);
+        ensureWritable(size);
+        memcpy(m_buf.data() + m_writeIdx, data, size);
+        m_writeIdx += size;
     }
 
-    // 把数据追加到m_buf中，附加报文头部4字节（报文长度）。
+    // 把数据追加到缓冲区中，附加报文头部4字节（报文长度）。
     void Buffer::appendWithSep(const char* data, size_t size)
     {
         if (m_sep == 0) // 没有分隔符。
         {
-            m_buf.append(data, size); // 处理报文内容。
+            append(data, size); // 处理报文内容。
         }
         else if (m_sep == 1) // 四字节的报头。
         {
-            m_buf.append((char*)&size, 4); // 处理报文长度（头部）。
-            m_buf.append(data, size);      // 处理报文内容。
+            uint32_t len = static_cast<uint32_t>(size);
+            ensureWritable(4 + size);
+            append((char*)&len, 4); // 处理报文长度（头部）。
+            append(data, size);     // 处理报文内容。
         }
         else if (m_sep == 2) // "\r\n\r\n"分隔符：数据后追加分隔符
         {
-            m_buf.append(data, size);
-            m_buf.append("\r\n\r\n", 4); // 添加分隔符
+            ensureWritable(size + 4);
+            append(data, size);
+            append("\r\n\r\n", 4); // 添加分隔符
         }
     }
 
-    // 返回m_buf的大小。
-    size_t Buffer::size()
+    // 消费（丢弃）可读数据的前n个字节，只移动读下标。
+    void Buffer::retrieve(size_t n)
     {
-        return m_buf.size();
-    }
-
-    // 返回m_buf的首地址。
-    const char* Buffer::data()
-    {
-        return m_buf.data();
+        if (n < size())
+        {
+            m_readIdx += n;
+        }
+        else
+        {
+            clear(); // 数据已全部消费，读写下标回到起点，下次写入无需整理。
+        }
     }
 
-    // 清空m_buf。
+    // 清空缓冲区（不释放内存）。
     void Buffer::clear()
     {
-        m_buf.clear();
+        m_readIdx = m_writeIdx = PREPEND_SIZE;
     }
 
-    // 从m_buf中拆分出一个报文，存放在s中，如果m_buf中没有报文，返回false。
-    bool Buffer::pickMessage(std::string& s)
+    // 从缓冲区中拆分出一个报文（不拷贝），如果缓冲区中没有完整的报文，返回false。
+    bool Buffer::pickMessage(std::string_view& msg)
     {
-        if (m_buf.empty()) return false;
+        if (empty()) return false;
 
         if (m_sep == 0) // 无分隔符：整个缓冲区视为一个报文
         {
-            s = std::move(m_buf); // 移动数据，避免拷贝
-            m_buf.clear();
+            msg = std::string_view(data(), size());
+            m_readIdx = m_writeIdx; // 只移动读下标，视图指向的数据在下一次写入前保持有效
             return true;
         }
         else if (m_sep == 1) // 四字节报头：先读长度，再读数据
         {
-            if (m_buf.size() < 4) return false; // 不足4字节，无法获取长度
+            if (size() < 4) return false; // 不足4字节，无法获取长度
 
             // 读取长度（主机字节序）
-            size_t len;
-            memcpy(&len, m_buf.data(), 4);
+            uint32_t len;
+            memcpy(&len, data(), 4);
 
             // 检查总长度是否足够（4字节头部 + 数据长度）
-            if (m_buf.size() < 4 + len) return false;
+            if (size() < 4 + static_cast<size_t>(len)) return false;
 
-            // 提取数据
-            s = m_buf.substr(4, len);
-            // 移除已提取的部分（头部+数据）
-            m_buf.erase(0, 4 + len);
+            msg = std::string_view(data() + 4, len);
+            m_readIdx += 4 + len; // 移除已提取的部分（头部+数据）
             return true;
         }
         else if (m_sep == 2) // "\r\n\r\n"分隔符：查找分隔符位置
         {
-            const std::string sep = "\r\n\r\n";
-            size_t sep_pos = m_buf.find(sep);
-            if (sep_pos == std::string::npos) return false; // 未找到分隔符
+            const std::string_view sep = "\r\n\r\n";
+            const std::string_view readable(data(), size());
+            size_t sep_pos = readable.find(sep);
+            if (sep_pos == std::string_view::npos) return false; // 未找到分隔符
 
             // 提取分隔符前的数据（包含分隔符本身）
-            s = m_buf.substr(0, sep_pos + sep.size());
-            // 移除已提取的部分
-            m_buf.erase(0, sep_pos + sep.size());
+            msg = readable.substr(0, sep_pos + sep.size());
+            m_readIdx += msg.size();
             return true;
         }
 
         return false;
     }
 
-    // 从fd读取数据直接写入m_buf（无临时缓冲区）
-    ssize_t Buffer::recvFd(int fd)
+    // 从缓冲区中拆分出一个报文，拷贝到s中，如果缓冲区中没有完整的报文，返回false。
+    bool Buffer::pickMessage(std::string& s)
     {
-        constexpr size_t READ_CHUNK = 4096;
-        constexpr size_t EXPAND_THRESHOLD = READ_CHUNK / 4; // 扩容阈值
-        size_t first_size = m_buf.size();
-        size_t nread_total = 0;
+        std::string_view msg;
+        if (!pickMessage(msg)) return false;
 
-        m_buf.resize(first_size + READ_CHUNK); // 扩容后可用空间 += READ_CHUNK
+        s.assign(msg.data(), msg.size());
+        return true;
+    }
 
-        while (true)
-        {
-            size_t current_size = m_buf.size();                // 当前有效数据长度
-            const size_t real_size = first_size + nread_total; // 实际长度
-            size_t available = current_size - real_size;       // 剩余可用空间
+    // 保证尾部至少有n字节可写空间：优先整理已消费的头部空间，不够再扩容。
+    void Buffer::ensureWritable(size_t n)
+    {
+        if (m_buf.size() - m_writeIdx >= n) return;
 
-            // 1. 检查是否需要扩容：剩余空间不足EXPAND_THRESHOLD时，扩展READ_CHUNK
-            if (available < EXPAND_THRESHOLD)
-            {
-                m_buf.resize(current_size + READ_CHUNK); // 扩容后可用空间 += READ_CHUNK
-                current_size = m_buf.size();
-                available += READ_CHUNK;
+        const size_t readable = size();
+        const size_t consumed = m_readIdx - PREPEND_SIZE;
+
+        // 只有已消费的空间不少于可读数据时才整理，搬移的字节数被之前的消费摊销；否则按倍数扩容。
+        if (consumed >= readable && consumed + (m_buf.size() - m_writeIdx) >= n)
+        {
+            memmove(m_buf.data() + PREPEND_SIZE, data(), readable);
+            m_readIdx = PREPEND_SIZE;
+            m_writeIdx = PREPEND_SIZE + readable;
 #ifdef DEBUG
-                printf("m_buf.resize(%zu)\n", m_buf.size());
+            printf("Buffer compact: readable=%zu\n", readable);
 #endif
-            }
-
-            char* write_ptr = &m_buf[real_size]; // 写入地址
-
+        }
+        else
+        {
+            m_buf.resize(std::max(m_buf.size() * 2, m_writeIdx + n));
 #ifdef DEBUG
-            printf("recvFd-before(%d):real_size=%zu current_size=%zu, available=%zu\n",
-                   fd, real_size, current_size, available);
+            printf("m_buf.resize(%zu)\n", m_buf.size());
 #endif
+        }
+    }
 
-            // 2. 读取数据
-            ssize_t nread = ::read(fd, write_ptr, available);
+    // 从fd读取数据到缓冲区：readv()同时读入缓冲区的可写空间和栈上的额外缓冲区，一次系统调用即可读空socket
+    ssize_t Buffer::recvFd(int fd)
+    {
+        char extrabuf[EXTRA_BUF_SIZE]; // 可写空间不够时，多出的数据先读到栈上，再追加到缓冲区
+        size_t nread_total = 0;
+
+        while (true)
+        {
+            const size_t writable = m_buf.size() - m_writeIdx; // 剩余可用空间
+
+            struct iovec vec[2];
+            vec[0].iov_base = m_buf.data() + m_writeIdx;
+            vec[0].iov_len = writable;
+            vec[1].iov_base = extrabuf;
+            vec[1].iov_len = sizeof(extrabuf);
+            const int iovcnt = writable < sizeof(extrabuf) ? 2 : 1; // 可写空间足够大时不需要额外缓冲区
+            const size_t requested = iovcnt == 2 ? writable + sizeof(extrabuf) : writable;
+
+            ssize_t nread = ::readv(fd, vec, iovcnt);
 
 #ifdef DEBUG
-            printf("recvFd-after(%d):nread=%ld\n",
-                   fd, nread);
+            printf("recvFd(%d):readable=%zu, writable=%zu, nread=%ld\n", fd, size(), writable, nread);
 #endif
 
             if (nread > 0)
             {
+                if (static_cast<size_t>(nread) <= writable)
+                {
+                    m_writeIdx += nread;
+                }
+                else
+                {
+                    m_writeIdx = m_buf.size();
+                    append(extrabuf, nread - writable); // 额外缓冲区中的数据追加到缓冲区（必要时整理或扩容）
+                }
                 nread_total += nread; // 累计总读取量
+
+                // 读到的数据少于请求的大小，说明socket接收缓冲区已读空，省掉一次返回EAGAIN的系统调用。
+                if (static_cast<size_t>(nread) < requested) return nread_total;
             }
             else if (nread == 0)
             {
-                m_buf.resize(real_size);
                 return nread_total;
             }
             else // nread == -1
             {
-                m_buf.resize(real_size);
                 if (errno == EINTR)
                     continue;
                 else if (errno == EAGAIN || errno == EWOULDBLOCK)
@@ -166,4 +201,4 @@ namespace ol
     }
 #endif // __unix__
 
-} // namespace ol
\ No newline at end of file
+} // namespace ol
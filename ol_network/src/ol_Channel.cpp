@@ -67,6 +67,12 @@ namespace ol
         m_eventLoop->updateChnl(this);
     }
 
+    // 是否已注册写事件。
+    bool Channel::isWriting()
+    {
+        return m_events & EPOLLOUT;
+    }
+
     // 取消写事件。
     void Channel::disableWriting()
     {
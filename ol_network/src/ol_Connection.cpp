@@ -7,7 +7,8 @@ namespace ol
 
 #ifdef __unix__
     Connection::Connection(EventLoop* eventLoop, SocketFd::Ptr cliFd)
-        : m_eventLoop(eventLoop), m_cliFd(std::move(cliFd)), m_disconnected(false), m_cliChnl(std::make_unique<Channel>(m_eventLoop, m_cliFd->getFd()))
+        : m_eventLoop(eventLoop), m_cliFd(std::move(cliFd)), m_disconnected(false), m_cliChnl(std::make_unique<Channel>(m_eventLoop, m_cliFd->getFd())),
+          m_highWaterMark(64 * 1024 * 1024), m_lowWaterMark(0), m_aboveHighWaterMark(false), m_inSendCompleteCb(false), m_flushQueued(false)
     {
         // 为新客户端连接准备读事件，并添加到epoll中。
         m_cliChnl->setReadCb(std::bind(&Connection::onMessage, this));
@@ -56,7 +57,7 @@ namespace ol
     }
 
     // 设置处理报文的回调函数。
-    void Connection::setOnMessageCb(std::function<void(ConnectionPtr, std::string&)> func)
+    void Connection::setOnMessageCb(std::function<void(ConnectionPtr, std::string_view)> func)
     {
         m_onMessageCb = func;
     }
@@ -67,6 +68,26 @@ namespace ol
         m_sendCompleteCb = func;
     }
 
+    // 设置高水位回调。
+    void Connection::setHighWaterMarkCb(std::function<void(ConnectionPtr, size_t)> func, size_t highWaterMark)
+    {
+        m_highWaterMarkCb = func;
+        m_highWaterMark = highWaterMark;
+    }
+
+    // 设置低水位回调。
+    void Connection::setLowWaterMarkCb(std::function<void(ConnectionPtr)> func, size_t lowWaterMark)
+    {
+        m_lowWaterMarkCb = func;
+        m_lowWaterMark = lowWaterMark;
+    }
+
+    // 返回发送队列中待发送的字节数（在IO线程中调用）。
+    size_t Connection::pendingBytes() const
+    {
+        return m_outputQueue.size();
+    }
+
     // TCP连接关闭（断开）的回调函数，供Channel回调。
     void Connection::closeCb()
     {
@@ -90,20 +111,21 @@ namespace ol
         printf("Connection::writeCb(%ld).\n", syscall(SYS_gettid));
 #endif // DEBUG
 
-        // 尝试把m_outputBuf中的数据全部发送出去。
-        int writen = ::send(getFd(), m_outputBuf.data(), m_outputBuf.size(), 0);
+        // 尝试把m_outputQueue中的数据发送出去：一次writev()发送多个报文的报头和报文体，已发送的字节从队列中消费。
+        m_outputQueue.writeFd(getFd());
 
-        if (writen > 0)
+        // 越过高水位后回落到低水位，通知上层恢复发送。
+        if (m_aboveHighWaterMark && m_outputQueue.size() <= m_lowWaterMark)
         {
-            // 从m_outputBuf中删除已成功发送的字节数。
-            m_outputBuf.erase(0, writen);
+            m_aboveHighWaterMark = false;
+            if (m_lowWaterMarkCb) m_lowWaterMarkCb(shared_from_this());
         }
 
-        // 如果发送缓冲区中没有数据了，表示数据已发送完成，不再关注写事件。
-        if (m_outputBuf.empty())
+        // 如果发送队列中没有数据了，表示数据已发送完成，不再关注写事件。
+        if (m_outputQueue.empty())
         {
             m_cliChnl->disableWriting();
-            m_sendCompleteCb(shared_from_this());
+            _sendComplete();
         }
     }
 
@@ -135,8 +157,8 @@ namespace ol
             return;
         }
 
-        // 读取成功，从m_inputBuf中拆分完整报文并处理
-        std::string message;
+        // 读取成功，从m_inputBuf中拆分完整报文并处理（报文是指向m_inputBuf的视图，不拷贝）
+        std::string_view message;
         while (m_inputBuf.pickMessage(message))
         {
             m_lastATime = TimeStamp::now(); // 更新最后活动时间
@@ -169,19 +191,138 @@ namespace ol
         }
         else
         {
-// 如果当前线程不是IO线程，调用EventLoop::queueinloop()，把_sendInLoop()交给事件循环线程去执行。
+// 如果当前线程不是IO线程，把报文放入待发送列表，交给事件循环线程去发送。
 #ifdef DEBUG
             printf("send() 不在事件循环的线程中。\n");
 #endif
-            m_eventLoop->pushToQueue(std::bind(&Connection::_sendInLoop, this, data, size));
+            // 调用者的缓冲区在返回后可能失效，这里拷贝一次，到IO线程后报文体直接移入发送队列。
+            _queueSend(PendingSend{std::string(data, size), nullptr});
+        }
+    }
+
+    // 发送数据，报文体的所有权移交给连接，不再拷贝。
+    void Connection::send(std::string&& payload)
+    {
+        if (m_disconnected == true) return;
+
+        if (m_eventLoop->isInLoopThread())
+            _sendInLoop(std::move(payload));
+        else
+            _queueSend(PendingSend{std::move(payload), nullptr});
+    }
+
+    // 发送数据，报文体与其它连接/其它发送共享（如广播），不再拷贝。
+    void Connection::send(SharedPayload payload)
+    {
+        if (m_disconnected == true || !payload) return;
+
+        if (m_eventLoop->isInLoopThread())
+            _sendInLoop(std::move(payload));
+        else
+            _queueSend(PendingSend{std::string(), std::move(payload)});
+    }
+
+    // 工作线程发送数据：报文放入待发送列表，只有列表原本为空时才向事件循环提交任务。
+    // 事件循环执行任务之前提交的报文都由同一个任务发送，只需要一次唤醒。
+    void Connection::_queueSend(PendingSend&& pending)
+    {
+        bool needFlush = false;
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            m_pendingSends.push_back(std::move(pending));
+            if (!m_flushQueued)
+            {
+                m_flushQueued = true;
+                needFlush = true;
+            }
+        }
+
+        // 任务持有Connection的shared_ptr，保证执行时Connection仍然有效（即使TcpServer已经移除了它）。
+        if (needFlush)
+            m_eventLoop->pushToQueue([self = shared_from_this()]()
+                                     { self->_flushPending(); });
+    }
+
+    // 在IO线程中把待发送列表中的报文按顺序交给发送队列。
+    void Connection::_flushPending()
+    {
+        std::vector<PendingSend> pendings;
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            pendings.swap(m_pendingSends);
+            m_flushQueued = false;
+        }
+
+        if (m_disconnected == true) return; // 连接已断开，丢弃未发送的报文。
+
+        for (PendingSend& pending : pendings)
+        {
+            if (pending.shared)
+                _sendInLoop(std::move(pending.shared));
+            else
+                _sendInLoop(std::move(pending.owned));
         }
     }
 
     // 发送数据，如果当前线程是IO线程，直接调用此函数，如果是工作线程，将把此函数传给IO线程去执行。
     void Connection::_sendInLoop(const char* data, size_t size)
     {
-        m_outputBuf.appendWithSep(data, size); // 把需要发送的数据保存到Connection的发送缓冲区中。
-        m_cliChnl->enableWriting();            // 注册写事件。
+        // 发送队列为空时直接写socket，只把内核没有接收的部分拷贝到发送队列；否则排在队列后面。
+        m_outputQueue.writeMessage(getFd(), data, size);
+        _afterSend();
+    }
+
+    // 发送数据，报文体移入发送队列，不再拷贝。
+    void Connection::_sendInLoop(std::string&& payload)
+    {
+        m_outputQueue.writeMessage(getFd(), std::move(payload)); // 未写完的报文体作为独立的段排队，由writev()续发。
+        _afterSend();
+    }
+
+    // 发送数据，共享的报文体放入发送队列，不再拷贝。
+    void Connection::_sendInLoop(SharedPayload payload)
+    {
+        m_outputQueue.writeMessage(getFd(), std::move(payload)); // 未写完时发送队列持有一份引用。
+        _afterSend();
+    }
+
+    // 写socket/排队之后：全部发送完成则回调，否则检查高水位并注册写事件。
+    void Connection::_afterSend()
+    {
+        // 直接发送完成：不需要注册写事件，省掉两次epoll_ctl()和一次写事件。
+        if (m_outputQueue.empty())
+        {
+            _sendComplete();
+            return;
+        }
+
+        if (!m_aboveHighWaterMark && m_outputQueue.size() >= m_highWaterMark)
+        {
+            m_aboveHighWaterMark = true;
+            if (m_highWaterMarkCb) m_highWaterMarkCb(shared_from_this(), m_outputQueue.size());
+        }
+
+        // 写事件已注册时（队列中原本就有数据）不重复调用epoll_ctl()。
+        if (!m_cliChnl->isWriting()) m_cliChnl->enableWriting();
+    }
+
+    // 回调发送完成，正在回调中时推迟到事件循环的下一轮。
+    void Connection::_sendComplete()
+    {
+        if (!m_sendCompleteCb) return;
+
+        // 回调中再次send()并直接写完：如果同步回调，处理函数每次都发送时会无限递归，
+        // 推迟到下一轮后每轮只回调一次，与经过写事件回调的情况相同。
+        if (m_inSendCompleteCb)
+        {
+            m_eventLoop->pushToQueue([self = shared_from_this()]()
+                                     { if (!self->m_disconnected) self->_sendComplete(); });
+            return;
+        }
+
+        m_inSendCompleteCb = true;
+        m_sendCompleteCb(shared_from_this());
+        m_inSendCompleteCb = false;
     }
 
     // 判断TCP连接是否超时（空闲太久）。
@@ -20,7 +20,7 @@ namespace ol
     EventLoop::EventLoop(bool mainEventLoop, size_t MaxEvents, int timetvl, int timeout)
         : m_mainEventLoop(mainEventLoop), m_stop(false),
           m_timetvl(timetvl), m_timeout(timeout),
-          m_epChnl(std::make_unique<EpollChnl>(MaxEvents)),
+          m_epChnl(std::make_unique<EpollChnl>(MaxEvents)), m_wakeUpPending(false),
           m_wakeUpFd(eventfd(0, EFD_NONBLOCK)), m_wakeUpChnl(std::make_unique<Channel>(this, m_wakeUpFd)),
           m_timerFd(createTimerFd(m_timetvl)), m_timerChnl(std::make_unique<Channel>(this, m_timerFd)), m_threadId(0)
     {
@@ -93,16 +93,19 @@ namespace ol
         m_epChnl->removeChnl(ch);
     }
 
-    // 把任务添加到队列中。
-    void EventLoop::pushToQueue(std::function<void()> func)
+    // 把任务添加到队列中，只有没有未处理的唤醒时才写eventfd。
+    void EventLoop::pushToQueue(Task func)
     {
+        bool needWakeUp;
         {
             std::lock_guard<std::mutex> lock(m_taskQueueMutex); // 给任务队列加锁。
-            m_taskQueue.push(func);                             // 任务入队。
+            m_taskQueue.push_back(std::move(func));             // 任务入队。
+            needWakeUp = !m_wakeUpPending;
+            m_wakeUpPending = true;
         }
 
-        // 唤醒事件循环。
-        wakeUp();
+        // 唤醒事件循环：已经写过eventfd且事件循环还没有取走任务时，这个任务会被同一批取走，省掉一次write()。
+        if (needWakeUp) wakeUp();
     }
 
     // 用eventfd唤醒事件循环线程。
@@ -112,7 +115,7 @@ namespace ol
         write(m_wakeUpFd, &val, sizeof(val));
     }
 
-    // 事件循环线程被eventfd唤醒后执行的函数。
+    // 事件循环线程被eventfd唤醒后执行的函数（整批取走任务，在锁外执行）。
     void EventLoop::handleWakeUp()
     {
 #ifdef DEBUG
@@ -121,15 +124,19 @@ namespace ol
         uint64_t val;
         read(m_wakeUpFd, &val, sizeof(val)); // 从eventfd中读取出数据，如果不读取，eventfd的读事件会一直触发。
 
-        std::function<void()> func;
-        std::lock_guard<std::mutex> lock(m_taskQueueMutex); // 给任务队列加锁。
+        // 加锁只交换两个vector，之后提交的任务会重新写eventfd，在下一次唤醒时执行。
+        {
+            std::lock_guard<std::mutex> lock(m_taskQueueMutex); // 给任务队列加锁。
+            m_runningTasks.swap(m_taskQueue);
+            m_wakeUpPending = false;
+        }
 
-        while (m_taskQueue.size() > 0)
+        // 在锁外按提交顺序执行任务，任务执行期间其它线程可以继续提交任务（包括任务中再调用pushToQueue()）。
+        for (Task& func : m_runningTasks)
         {
-            func = std::move(m_taskQueue.front()); // 出队一个元素。
-            m_taskQueue.pop();
             func(); // 执行任务。
         }
+        m_runningTasks.clear(); // 保留容量，下次交换后不再分配内存。
     }
 
     // 闹钟响时执行的函数。
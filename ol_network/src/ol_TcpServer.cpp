@@ -6,9 +6,9 @@ namespace ol
 {
 
 #ifdef __unix__
-    TcpServer::TcpServer(const std::string& ip, const uint16_t port, size_t threadNum, size_t MainMaxEvents, size_t SubMaxEvents, int epWaitTimeout, int timerTimetvl, int timerTimeout)
+    TcpServer::TcpServer(const std::string& ip, const uint16_t port, size_t threadNum, size_t MainMaxEvents, size_t SubMaxEvents, int epWaitTimeout, int timerTimetvl, int timerTimeout, const std::vector<int>& ioCpus)
         : m_threadNum(threadNum), m_mainEventLoop(std::make_unique<EventLoop>(true, MainMaxEvents)),
-          m_acceptor(m_mainEventLoop.get(), ip, port), m_threadPool(m_threadNum, 0)
+          m_acceptor(m_mainEventLoop.get(), ip, port), m_threadPool(m_threadNum, 0, false, WorkerPlacement::pinned(ioCpus))
     {
         m_mainEventLoop->setEpollTimeoutCb(std::bind(&TcpServer::epollTimeout, this, std::placeholders::_1));
 
@@ -22,7 +22,7 @@ namespace ol
             m_subEventLoops[i] = std::make_unique<EventLoop>(false, SubMaxEvents, timerTimetvl, timerTimeout);          // 创建从事件循环，存入m_subEventLoops容器中。
             m_subEventLoops[i]->setEpollTimeoutCb(std::bind(&TcpServer::epollTimeout, this, std::placeholders::_1));    // 设置timeout超时的回调函数。
             m_subEventLoops[i]->setRemoveTimeoutConnCb(std::bind(&TcpServer::removeConn, this, std::placeholders::_1)); // 设置清理空闲TCP连接的回调函数。
-            m_threadPool.addTask(std::bind(&EventLoop::run, m_subEventLoops[i].get(), epWaitTimeout));                  // 在线程池中运行从事件循环。
+            m_threadPool.addTask(std::bind(&EventLoop::run, m_subEventLoops[i].get(), epWaitTimeout));                  // 在线程池中运行从事件循环（每个工作线程常驻一个事件循环，绑核后事件循环即固定在该核上）。
         }
     }
 
@@ -70,6 +70,8 @@ namespace ol
         conn->setErrorCb(std::bind(&TcpServer::errorConn, this, std::placeholders::_1));
         conn->setOnMessageCb(std::bind(&TcpServer::onMessage, this, std::placeholders::_1, std::placeholders::_2));
         conn->setSendCompleteCb(std::bind(&TcpServer::sendComplete, this, std::placeholders::_1));
+        conn->setHighWaterMarkCb(std::bind(&TcpServer::highWaterMark, this, std::placeholders::_1, std::placeholders::_2), m_highWaterMark);
+        conn->setLowWaterMarkCb(std::bind(&TcpServer::lowWaterMark, this, std::placeholders::_1), m_lowWaterMark);
 
 #ifdef DEBUG
         printf("TcpServer::newConn(fd=%d,ip=%s,port=%d)\n", conn->getFd(), conn->getIp(), conn->getPort());
@@ -108,7 +110,7 @@ namespace ol
     }
 
     // 处理客户端的请求报文，在Connection类中回调此函数。
-    void TcpServer::onMessage(ConnectionPtr conn, std::string& message)
+    void TcpServer::onMessage(ConnectionPtr conn, std::string_view message)
     {
         if (m_onMessageCb) m_onMessageCb(conn, message); // 回调上层业务类的handleMessage()。
     }
@@ -136,6 +138,18 @@ namespace ol
         if (m_timerTimeoutCb) m_timerTimeoutCb(fd);
     }
 
+    // 发送队列越过高水位，在Connection类中回调此函数。
+    void TcpServer::highWaterMark(ConnectionPtr conn, size_t pending)
+    {
+        if (m_highWaterMarkCb) m_highWaterMarkCb(conn, pending); // 回调上层业务类的handleHighWaterMark()。
+    }
+
+    // 发送队列回落到低水位，在Connection类中回调此函数。
+    void TcpServer::lowWaterMark(ConnectionPtr conn)
+    {
+        if (m_lowWaterMarkCb) m_lowWaterMarkCb(conn); // 回调上层业务类的handleLowWaterMark()。
+    }
+
     void TcpServer::setNewConnCb(std::function<void(ConnectionPtr)> func)
     {
         m_newConnCb = func;
@@ -151,7 +165,7 @@ namespace ol
         m_errorCb = func;
     }
 
-    void TcpServer::setOnMessageCb(std::function<void(ConnectionPtr, std::string& message)> func)
+    void TcpServer::setOnMessageCb(std::function<void(ConnectionPtr, std::string_view message)> func)
     {
         m_onMessageCb = func;
     }
@@ -170,6 +184,18 @@ namespace ol
     {
         m_timerTimeoutCb = func;
     }
+
+    void TcpServer::setHighWaterMarkCb(std::function<void(ConnectionPtr, size_t)> func, size_t highWaterMark)
+    {
+        m_highWaterMarkCb = func;
+        m_highWaterMark = highWaterMark;
+    }
+
+    void TcpServer::setLowWaterMarkCb(std::function<void(ConnectionPtr)> func, size_t lowWaterMark)
+    {
+        m_lowWaterMarkCb = func;
+        m_lowWaterMark = lowWaterMark;
+    }
 #endif // __unix__
 
 } // namespace ol
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "ol_net/ol_WriteQueue.h"
+#include <algorithm>
+
+// #define DEBUG
+
+namespace ol
+{
+
+#ifdef __unix__
+    WriteQueue::WriteQueue(uint16_t sep) : m_copied(0), m_bytes(0), m_sep(sep)
+    {
+    }
+
+    WriteQueue::~WriteQueue()
+    {
+    }
+
+    // 把数据拷贝到队列尾部（不加报头）。
+    void WriteQueue::append(const char* data, size_t size)
+    {
+        if (size == 0) return;
+
+        m_copied.append(data, size);
+
+        // 与队列尾部的拷贝段相邻，直接合并。
+        if (!m_segments.empty() && m_segments.back().copiedBytes > 0)
+            m_segments.back().copiedBytes += size;
+        else
+            m_segments.push_back(Segment{size, std::string(), nullptr, 0});
+
+        m_bytes += size;
+    }
+
+    // 拷贝一个报文到队列尾部，按分隔符附加报头或"\r\n\r\n"。
+    void WriteQueue::appendMessage(const char* data, size_t size)
+    {
+        appendHeader(size);
+        append(data, size);
+        appendTrailer();
+    }
+
+    // 移交一个报文体到队列尾部，报头单独拷贝，报文体不拷贝。
+    void WriteQueue::appendMessage(std::string&& payload)
+    {
+        appendBody(Segment{0, std::move(payload), nullptr, 0});
+    }
+
+    // 共享一个报文体到队列尾部，报头单独拷贝，报文体不拷贝。
+    void WriteQueue::appendMessage(SharedPayload payload)
+    {
+        appendBody(Segment{0, std::string(), std::move(payload), 0});
+    }
+
+    // 把报文体段及其报头、报文尾排到队列尾部。
+    void WriteQueue::appendBody(Segment&& seg)
+    {
+        const size_t size = seg.body().size();
+        appendHeader(size);
+        if (size > 0)
+        {
+            m_bytes += size;
+            m_segments.push_back(std::move(seg));
+        }
+        appendTrailer();
+    }
+
+    // 按分隔符拷贝报头（四字节长度）。
+    void WriteQueue::appendHeader(size_t size)
+    {
+        if (m_sep == 1)
+        {
+            uint32_t len = static_cast<uint32_t>(size);
+            append((char*)&len, 4);
+        }
+    }
+
+    // 按分隔符拷贝报文尾（"\r\n\r\n"）。
+    void WriteQueue::appendTrailer()
+    {
+        if (m_sep == 2) append("\r\n\r\n", 4);
+    }
+
+    // 用writev()把队列头部的数据段写入fd，返回写入的字节数，失败返回-1。
+    ssize_t WriteQueue::writeFd(int fd)
+    {
+        if (empty()) return 0;
+
+        struct iovec iov[MAX_IOVECS];
+        int iovcnt = 0;
+        const char* copied = m_copied.data(); // 拷贝段在m_copied中按顺序连续存放
+        for (const Segment& seg : m_segments)
+        {
+            if (iovcnt == MAX_IOVECS) break;
+
+            if (seg.copiedBytes > 0)
+            {
+                iov[iovcnt].iov_base = const_cast<char*>(copied);
+                iov[iovcnt].iov_len = seg.copiedBytes;
+                copied += seg.copiedBytes;
+            }
+            else
+            {
+                iov[iovcnt].iov_base = const_cast<char*>(seg.body().data() + seg.offset);
+                iov[iovcnt].iov_len = seg.body().size() - seg.offset;
+            }
+            ++iovcnt;
+        }
+
+        ssize_t writen;
+        do
+        {
+            writen = ::writev(fd, iov, iovcnt);
+        } while (writen < 0 && errno == EINTR);
+
+#ifdef DEBUG
+        printf("WriteQueue::writeFd(%d): iovcnt=%d, writen=%ld, pending=%zu\n", fd, iovcnt, writen, m_bytes);
+#endif
+
+        if (writen > 0) consume(writen);
+        return writen;
+    }
+
+    // 发送一个报文：队列为空时先用writev()直接写入fd，只把未写入的部分放入队列；队列不为空时直接排队（保证顺序）。
+    ssize_t WriteQueue::writeMessage(int fd, const char* data, size_t size)
+    {
+        if (!empty())
+        {
+            appendMessage(data, size);
+            return 0;
+        }
+
+        uint32_t len;
+        ssize_t writen = writeDirect(fd, data, size, len);
+        appendTail(data, size, len, writen > 0 ? writen : 0); // 调用者的缓冲区在返回后可能失效，未写入的部分拷贝到队列。
+        return writen;
+    }
+
+    ssize_t WriteQueue::writeMessage(int fd, std::string&& payload)
+    {
+        return writeBody(fd, Segment{0, std::move(payload), nullptr, 0});
+    }
+
+    ssize_t WriteQueue::writeMessage(int fd, SharedPayload payload)
+    {
+        return writeBody(fd, Segment{0, std::string(), std::move(payload), 0});
+    }
+
+    // 发送报文体段：队列为空时先直接写入，未写入的部分排队。
+    ssize_t WriteQueue::writeBody(int fd, Segment&& seg)
+    {
+        if (!empty())
+        {
+            appendBody(std::move(seg));
+            return 0;
+        }
+
+        const std::string& body = seg.body();
+        uint32_t len;
+        ssize_t writen = writeDirect(fd, body.data(), body.size(), len);
+        const size_t skip = writen > 0 ? writen : 0;
+        const size_t headerLen = m_sep == 1 ? 4 : 0;
+        const size_t bodySent = skip > headerLen ? skip - headerLen : 0;
+
+        if (bodySent < body.size())
+        {
+            // 报文体没有写完：剩余的报头拷贝到队列，报文体移入队列，从已写入的位置继续发送。
+            if (skip < headerLen) append((const char*)&len + skip, headerLen - skip);
+            m_bytes += body.size() - bodySent;
+            seg.offset = bodySent;
+            m_segments.push_back(std::move(seg));
+            appendTrailer();
+        }
+        else
+        {
+            appendTail(body.data(), body.size(), len, skip); // 只可能剩下报文尾
+        }
+        return writen;
+    }
+
+    // 队列为空时用writev()直接写入报头、报文体和报文尾。
+    ssize_t WriteQueue::writeDirect(int fd, const char* data, size_t size, uint32_t& len)
+    {
+        len = static_cast<uint32_t>(size);
+
+        struct iovec iov[3];
+        int iovcnt = 0;
+        if (m_sep == 1)
+        {
+            iov[iovcnt].iov_base = &len;
+            iov[iovcnt++].iov_len = 4;
+        }
+        if (size > 0)
+        {
+            iov[iovcnt].iov_base = const_cast<char*>(data);
+            iov[iovcnt++].iov_len = size;
+        }
+        if (m_sep == 2)
+        {
+            iov[iovcnt].iov_base = const_cast<char*>("\r\n\r\n");
+            iov[iovcnt++].iov_len = 4;
+        }
+        if (iovcnt == 0) return 0;
+
+        ssize_t writen;
+        do
+        {
+            writen = ::writev(fd, iov, iovcnt);
+        } while (writen < 0 && errno == EINTR);
+
+#ifdef DEBUG
+        printf("WriteQueue::writeDirect(%d): size=%zu, writen=%ld\n", fd, size, writen);
+#endif
+
+        return writen;
+    }
+
+    // 把报文中前skip个字节之后的部分拷贝到队列。
+    void WriteQueue::appendTail(const char* data, size_t size, uint32_t len, size_t skip)
+    {
+        const size_t headerLen = m_sep == 1 ? 4 : 0;
+        if (skip < headerLen)
+        {
+            append((const char*)&len + skip, headerLen - skip);
+            skip = headerLen;
+        }
+
+        skip -= headerLen;
+        if (skip < size)
+        {
+            append(data + skip, size - skip);
+            skip = size;
+        }
+
+        skip -= size;
+        if (m_sep == 2 && skip < 4) append("\r\n\r\n" + skip, 4 - skip);
+    }
+
+    // 从队列头部消费已发送的n个字节。
+    void WriteQueue::consume(size_t n)
+    {
+        m_bytes -= n;
+        while (n > 0)
+        {
+            Segment& seg = m_segments.front();
+            if (seg.copiedBytes > 0)
+            {
+                const size_t take = std::min(n, seg.copiedBytes);
+                m_copied.retrieve(take);
+                seg.copiedBytes -= take;
+                n -= take;
+                if (seg.copiedBytes == 0) m_segments.pop_front();
+            }
+            else
+            {
+                const size_t take = std::min(n, seg.body().size() - seg.offset);
+                seg.offset += take;
+                n -= take;
+                if (seg.offset == seg.body().size()) m_segments.pop_front();
+            }
+        }
+    }
+
+    // 清空队列。
+    void WriteQueue::clear()
+    {
+        m_copied.clear();
+        m_segments.clear();
+        m_bytes = 0;
+    }
+#endif // __unix__
+
+} // namespace ol
@@ -29,7 +29,7 @@ namespace ol
         void handleNewConn(Connection::Ptr conn);                       // 处理新客户端连接请求，在TcpServer类中回调此函数。
         void handleClose(Connection::Ptr conn);                         // 关闭客户端的连接，在TcpServer类中回调此函数。
         void handleError(Connection::Ptr conn);                         // 客户端的连接错误，在TcpServer类中回调此函数。
-        void handleMessage(Connection::Ptr conn, std::string& message); // 处理客户端的请求报文，在TcpServer类中回调此函数。
+        void handleMessage(Connection::Ptr conn, std::string_view message); // 处理客户端的请求报文，在TcpServer类中回调此函数。
         void handleSendComplete(Connection::Ptr conn);                  // 数据发送完成后，在TcpServer类中回调此函数。
         void handleTimeOut(EventLoop* eventLoop);                       // epoll_wait()超时，在TcpServer类中回调此函数。
 
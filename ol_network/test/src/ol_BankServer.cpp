@@ -78,7 +78,7 @@ namespace ol
     }
 
     // 处理客户端的请求报文，在TcpServer类中回调此函数。
-    void BankServer::handleMessage(Connection::Ptr conn, std::string& message)
+    void BankServer::handleMessage(Connection::Ptr conn, std::string_view message)
     {
 #ifdef DEBUG
         printf("BankServer::handleMessage(%ld).\n", syscall(SYS_gettid));
@@ -87,12 +87,13 @@ namespace ol
         if (m_threadPool.getWorkerNum() == 0)
         {
             // 如果没有工作线程，表示在IO线程中计算
-            onMessage(conn, message);
+            std::string msg(message);
+            onMessage(conn, msg);
         }
         else
         {
-            // 把业务添加到线程池的任务队列中。
-            m_threadPool.addTask(std::bind(&BankServer::onMessage, this, conn, message));
+            // 把业务添加到线程池的任务队列中（报文视图只在回调期间有效，交给工作线程前拷贝一份）。
+            m_threadPool.addTask(std::bind(&BankServer::onMessage, this, conn, std::string(message)));
         }
     }
 
@@ -185,7 +186,7 @@ namespace ol
             }
         }
 
-        conn->send(replaymessage.data(), replaymessage.size()); // 把数据发送出去。
+        conn->send(std::move(replaymessage)); // 把数据发送出去（报文移交给连接，不再拷贝）。
     }
 #endif // __unix__
 
@@ -80,7 +80,7 @@ namespace ol
     }
 
     // 处理客户端的请求报文，在TcpServer类中回调此函数。
-    void EchoServer::handleMessage(Connection::Ptr conn, std::string& message)
+    void EchoServer::handleMessage(Connection::Ptr conn, std::string_view message)
     {
 #ifdef DEBUG
         printf("EchoServer::handleMessage(%ld).\n", syscall(SYS_gettid));
@@ -89,12 +89,13 @@ namespace ol
         if (m_threadPool.getWorkerNum() == 0)
         {
             // 如果没有工作线程，表示在IO线程中计算
-            onMessage(conn, message);
+            std::string msg(message);
+            onMessage(conn, msg);
         }
         else
         {
-            // 把业务添加到线程池的任务队列中。
-            m_threadPool.addTask(std::bind(&EchoServer::onMessage, this, conn, message));
+            // 把业务添加到线程池的任务队列中（报文视图只在回调期间有效，交给工作线程前拷贝一份）。
+            m_threadPool.addTask(std::bind(&EchoServer::onMessage, this, conn, std::string(message)));
         }
     }
 
@@ -127,7 +128,7 @@ namespace ol
         // 在这里，将经过若干步骤的运算。
         message = "reply:" + message; // 回显业务。
 
-        conn->send(message.data(), message.size()); // 把数据发送出去。
+        conn->send(std::move(message)); // 把数据发送出去（报文移交给连接，不再拷贝）。
     }
 #endif // __unix__
 
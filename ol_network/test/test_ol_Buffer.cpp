@@ -0,0 +1,395 @@
+/****************************************************************************************/
+/*
+ * 程序名：test_ol_Buffer.cpp
+ * 功能描述：测试ol::Buffer收发缓冲区：报文拆分（三种分隔符）、零拷贝视图、读写下标与整理、从fd读取（readv），
+ *          以及ol::WriteQueue发送队列：拷贝段合并、移交所有权的报文体、writev()部分发送、队列为空时直接发送
+ */
+/****************************************************************************************/
+
+#if !defined(__unix__)
+#error "仅支持Linux平台，不支持当前系统！"
+#endif
+
+#include "ol_chrono.h"
+#include "ol_net/ol_Buffer.h"
+#include "ol_net/ol_WriteQueue.h"
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <sys/socket.h>
+#include <vector>
+
+using namespace ol;
+using namespace std;
+
+// 不受NDEBUG影响的检查：Release构建下同样生效，失败时打印位置和条件并终止进程
+#define CHECK(condition)                                                                               \
+    do                                                                                                 \
+    {                                                                                                  \
+        if (!(condition))                                                                              \
+        {                                                                                              \
+            std::cerr << "Check failed at " << __FILE__ << ":" << __LINE__ << ": " #condition << "\n"; \
+            std::abort();                                                                              \
+        }                                                                                              \
+    } while (0)
+
+// 测试三种分隔符的报文拆分
+void test_pick_message()
+{
+    cout << "=== 测试报文拆分 ===" << "\n";
+
+    // 四字节报头：报文可以跨多次追加到达
+    Buffer buf(1);
+    buf.appendWithSep("hello", 5);
+    buf.appendWithSep("", 0);
+    string frame;
+    {
+        Buffer tmp(1);
+        tmp.appendWithSep("world!", 6);
+        frame.assign(tmp.data(), tmp.size());
+    }
+    buf.append(frame.data(), 3); // 报头不完整
+
+    string_view msg;
+    bool ok = buf.pickMessage(msg);
+    CHECK(ok && msg == "hello");
+    ok = buf.pickMessage(msg);
+    CHECK(ok && msg.empty());
+    ok = buf.pickMessage(msg);
+    CHECK(!ok);
+    buf.append(frame.data() + 3, 4); // 报头完整，数据不完整
+    ok = buf.pickMessage(msg);
+    CHECK(!ok);
+    buf.append(frame.data() + 7, frame.size() - 7);
+    string s;
+    ok = buf.pickMessage(s);
+    CHECK(ok && s == "world!");
+    CHECK(buf.empty());
+    cout << "四字节报头 [OK]" << "\n";
+
+    // "\r\n\r\n"分隔符：报文包含分隔符本身
+    Buffer http(2);
+    http.append("GET / HTTP/1.1\r\n\r\nGET /a", 24);
+    ok = http.pickMessage(msg);
+    CHECK(ok && msg == "GET / HTTP/1.1\r\n\r\n");
+    ok = http.pickMessage(msg);
+    CHECK(!ok);
+    http.append(" HTTP/1.1\r\n\r\n", 13);
+    ok = http.pickMessage(msg);
+    CHECK(ok && msg == "GET /a HTTP/1.1\r\n\r\n");
+    http.appendWithSep("body", 4);
+    ok = http.pickMessage(msg);
+    CHECK(ok && msg == "body\r\n\r\n");
+    cout << "\\r\\n\\r\\n分隔符 [OK]" << "\n";
+
+    // 无分隔符：全部可读数据为一个报文
+    Buffer raw(0);
+    raw.append("abc", 3);
+    raw.appendWithSep("def", 3);
+    ok = raw.pickMessage(msg);
+    CHECK(ok && msg == "abcdef");
+    CHECK(raw.empty());
+    ok = raw.pickMessage(msg);
+    CHECK(!ok);
+    cout << "无分隔符 [OK]" << "\n";
+}
+
+// 测试读写下标：消费只移动读下标，追加时整理或扩容，数据保持正确
+void test_retrieve_and_compact()
+{
+    cout << "=== 测试读写下标与整理 ===" << "\n";
+
+    Buffer buf(1, 64);
+    string expected;
+    size_t consumed = 0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        string chunk = to_string(i) + ",";
+        buf.append(chunk.data(), chunk.size());
+        expected += chunk;
+
+        // 每次消费一部分，缓冲区中始终积压一些数据
+        if (i % 3 == 0)
+        {
+            size_t n = buf.size() / 2;
+            CHECK(string(buf.data(), n) == expected.substr(consumed, n));
+            buf.retrieve(n);
+            consumed += n;
+        }
+    }
+    CHECK(buf.size() == expected.size() - consumed);
+    CHECK(string(buf.data(), buf.size()) == expected.substr(consumed));
+
+    buf.retrieve(buf.size() + 100); // 超过可读数据时等同于clear()
+    CHECK(buf.empty());
+    buf.append("x", 1);
+    CHECK(buf.size() == 1 && buf.data()[0] == 'x');
+    buf.clear();
+    CHECK(buf.empty() && buf.size() == 0);
+    cout << "追加/消费/整理 [OK]" << "\n";
+}
+
+// 测试积压大量报文时的拆分代价与积压量无关
+void test_pipelined_messages()
+{
+    cout << "=== 测试流水线报文拆分 ===" << "\n";
+
+    const int N = 200000;
+    Buffer buf(1);
+    for (int i = 0; i < N; ++i)
+    {
+        string body = "message-" + to_string(i);
+        buf.appendWithSep(body.data(), body.size());
+    }
+
+    ctimer timer;
+    string_view msg;
+    int count = 0;
+    bool all_match = true;
+    while (buf.pickMessage(msg))
+    {
+        if (msg != "message-" + to_string(count)) all_match = false;
+        ++count;
+    }
+    cout << "拆分" << N << "个积压报文: " << timer.elapsed() << " 秒" << "\n";
+    CHECK(count == N && all_match);
+    CHECK(buf.empty());
+    cout << "流水线报文 [OK]" << "\n";
+}
+
+// 测试从socket读取数据（非阻塞），包括一次读取的数据超过初始容量
+void test_recv_fd()
+{
+    cout << "=== 测试从fd读取数据 ===" << "\n";
+
+    int fds[2];
+    int ret = socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds);
+    CHECK(ret == 0);
+
+    // 发送端：若干个带四字节报头的报文
+    Buffer out(1);
+    vector<string> bodies;
+    for (int i = 0; i < 2000; ++i)
+    {
+        bodies.push_back(string(i % 97, 'a' + i % 26) + to_string(i));
+        out.appendWithSep(bodies.back().data(), bodies.back().size());
+    }
+
+    Buffer in(1, 16);
+    size_t next = 0;
+    bool all_match = true;
+    while (!out.empty() || next < bodies.size())
+    {
+        if (!out.empty())
+        {
+            ssize_t n = ::send(fds[0], out.data(), out.size(), 0);
+            if (n > 0) out.retrieve(n);
+        }
+
+        ssize_t nread = in.recvFd(fds[1]);
+        CHECK(nread >= 0);
+
+        string_view msg;
+        while (in.pickMessage(msg))
+        {
+            if (next >= bodies.size() || msg != bodies[next]) all_match = false;
+            ++next;
+        }
+    }
+    CHECK(all_match && next == bodies.size());
+    CHECK(in.empty());
+
+    // 对端关闭：读到0字节
+    close(fds[0]);
+    ssize_t nread = in.recvFd(fds[1]);
+    CHECK(nread == 0);
+    close(fds[1]);
+    cout << "recvFd [OK]" << "\n";
+}
+
+// 测试一次readv()读入超过缓冲区可写空间的数据（多出的部分经栈上的额外缓冲区追加）
+void test_recv_fd_burst()
+{
+    cout << "=== 测试readv()读入大块数据 ===" << "\n";
+
+    int fds[2];
+    int ret = socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds);
+    CHECK(ret == 0);
+    int sndbuf = 1 << 20;
+    setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+
+    string payload(100000, '\0');
+    for (size_t i = 0; i < payload.size(); ++i) payload[i] = static_cast<char>('a' + i % 26);
+    size_t sent = 0;
+    string received;
+    Buffer in(0, 16);
+    while (received.size() < payload.size())
+    {
+        if (sent < payload.size())
+        {
+            ssize_t n = ::send(fds[0], payload.data() + sent, payload.size() - sent, 0);
+            if (n > 0) sent += n;
+        }
+        ssize_t nread = in.recvFd(fds[1]);
+        CHECK(nread >= 0);
+        string_view msg;
+        if (in.pickMessage(msg)) received.append(msg.data(), msg.size());
+    }
+    CHECK(received == payload);
+    close(fds[0]);
+    close(fds[1]);
+    cout << "readv额外缓冲区 [OK]" << "\n";
+}
+
+// 测试发送队列：拷贝段与移交所有权的报文体交替排队，writev()部分发送后按顺序续发
+void test_write_queue()
+{
+    cout << "=== 测试发送队列 ===" << "\n";
+
+    int fds[2];
+    int ret = socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds);
+    CHECK(ret == 0);
+
+    WriteQueue out(1);
+    vector<string> bodies;
+    size_t total = 0;
+    for (int i = 0; i < 3000; ++i)
+    {
+        string body = string(i % 5 == 0 ? 3000 : i % 50, 'A' + i % 26) + to_string(i);
+        bodies.push_back(body);
+        total += 4 + body.size();
+        if (i % 2 == 0)
+            out.appendMessage(body.data(), body.size()); // 拷贝
+        else
+            out.appendMessage(std::move(body)); // 移交所有权
+    }
+    out.appendMessage(string()); // 空报文只有报头
+    bodies.push_back("");
+    total += 4;
+    CHECK(out.size() == total);
+
+    // 对端只在发送端写不动时才读，迫使writev()多次部分发送
+    Buffer in(1);
+    size_t next = 0;
+    bool all_match = true;
+    while (!out.empty() || next < bodies.size())
+    {
+        while (!out.empty() && out.writeFd(fds[0]) > 0)
+        {
+        }
+        ssize_t nread = in.recvFd(fds[1]);
+        CHECK(nread >= 0);
+        string_view msg;
+        while (in.pickMessage(msg))
+        {
+            if (next >= bodies.size() || msg != bodies[next]) all_match = false;
+            ++next;
+        }
+    }
+    CHECK(all_match && next == bodies.size());
+    CHECK(out.size() == 0 && in.empty());
+
+    // "\r\n\r\n"分隔符与清空
+    WriteQueue http(2);
+    http.appendMessage(string("GET / HTTP/1.1"));
+    http.appendMessage("ping", 4);
+    ssize_t n = http.writeFd(fds[0]);
+    CHECK(n == 26);
+    Buffer hin(2);
+    hin.recvFd(fds[1]);
+    string_view msg;
+    bool ok = hin.pickMessage(msg);
+    CHECK(ok && msg == "GET / HTTP/1.1\r\n\r\n");
+    ok = hin.pickMessage(msg);
+    CHECK(ok && msg == "ping\r\n\r\n");
+    http.appendMessage("x", 1);
+    http.clear();
+    n = http.writeFd(fds[0]);
+    CHECK(http.empty() && n == 0);
+
+    close(fds[0]);
+    close(fds[1]);
+    cout << "WriteQueue [OK]" << "\n";
+}
+
+// 测试队列为空时直接发送：写完不入队；写不完时只把剩余部分入队（报头/报文体/报文尾的任意位置截断）
+void test_write_message()
+{
+    cout << "=== 测试直接发送报文 ===" << "\n";
+
+    for (uint16_t sep : {1, 2})
+    {
+        int fds[2];
+        int ret = socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds);
+        CHECK(ret == 0);
+        int sndbuf = 4096;
+        setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+
+        WriteQueue out(sep);
+        ssize_t n = out.writeMessage(fds[0], "hi", 2);
+        CHECK(n == 6 && out.empty()); // 直接写完
+
+        // 对端不读，直到写不动；拷贝、移交所有权、共享报文体交替
+        vector<string> bodies = {"hi"};
+        SharedPayload shared = make_shared<const string>(3000, 'S');
+        for (int i = 0; i < 200; ++i)
+        {
+            string body(1000 + i * 37, 'a' + i % 26);
+            if (i % 3 == 0)
+            {
+                bodies.push_back(body);
+                out.writeMessage(fds[0], body.data(), body.size());
+            }
+            else if (i % 3 == 1)
+            {
+                bodies.push_back(body);
+                out.writeMessage(fds[0], std::move(body));
+            }
+            else
+            {
+                bodies.push_back(*shared);
+                out.writeMessage(fds[0], shared); // 同一个报文体排队多次
+            }
+        }
+        CHECK(!out.empty() && shared.use_count() > 1); // 队列持有共享报文体的引用
+
+        Buffer in(sep);
+        size_t next = 0;
+        bool all_match = true;
+        while (!out.empty() || next < bodies.size())
+        {
+            out.writeFd(fds[0]);
+            ssize_t nread = in.recvFd(fds[1]);
+            CHECK(nread >= 0);
+            string_view msg;
+            while (in.pickMessage(msg))
+            {
+                if (sep == 2) msg.remove_suffix(4);
+                if (next >= bodies.size() || msg != bodies[next]) all_match = false;
+                ++next;
+            }
+        }
+        CHECK(all_match && next == bodies.size());
+        CHECK(shared.use_count() == 1); // 发送完成后释放引用
+        close(fds[0]);
+        close(fds[1]);
+    }
+    cout << "writeMessage [OK]" << "\n";
+}
+
+int main()
+{
+    test_pick_message();
+    test_retrieve_and_compact();
+    test_pipelined_messages();
+    test_recv_fd();
+    test_recv_fd_burst();
+    test_write_queue();
+    test_write_message();
+
+    cout << "=== 所有ol::Buffer测试通过！ ===" << "\n";
+    return 0;
+}
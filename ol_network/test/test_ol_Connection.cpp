@@ -0,0 +1,346 @@
+/****************************************************************************************/
+/*
+ * 程序名：test_ol_Connection.cpp
+ * 功能描述：测试ol::Connection的发送路径：发送队列为空时直接写socket、部分写入后排队续发、高/低水位回调、
+ *          工作线程发送（移交/共享报文体、合并唤醒、任务持有连接的生命周期）、发送完成回调的重入
+ */
+/****************************************************************************************/
+
+#if !defined(__unix__)
+#error "仅支持Linux平台，不支持当前系统！"
+#endif
+
+#include "ol_net/ol_Connection.h"
+#include "ol_net/ol_EventLoop.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+
+using namespace ol;
+using namespace std;
+
+// 不受NDEBUG影响的检查：Release构建下同样生效，失败时打印位置和条件并终止进程
+#define CHECK(condition)                                                                               \
+    do                                                                                                 \
+    {                                                                                                  \
+        if (!(condition))                                                                              \
+        {                                                                                              \
+            std::cerr << "Check failed at " << __FILE__ << ":" << __LINE__ << ": " #condition << "\n"; \
+            std::abort();                                                                              \
+        }                                                                                              \
+    } while (0)
+
+// 在事件循环线程中执行func，等待执行完成。
+template <typename Func>
+void runInLoop(EventLoop& loop, Func func)
+{
+    promise<void> done;
+    future<void> fut = done.get_future();
+    loop.pushToQueue([&]()
+                     { func(); done.set_value(); });
+    fut.wait();
+}
+
+// 从fd读取n个字节（fd为非阻塞，用poll等待）。
+string readExactly(int fd, size_t n)
+{
+    string data;
+    char buf[65536];
+    while (data.size() < n)
+    {
+        struct pollfd pfd = {fd, POLLIN, 0};
+        poll(&pfd, 1, 1000);
+        ssize_t nread = ::read(fd, buf, min(sizeof(buf), n - data.size()));
+        if (nread > 0) data.append(buf, nread);
+    }
+    return data;
+}
+
+// 拆分带四字节报头的报文。
+vector<string> splitFrames(const string& data)
+{
+    vector<string> frames;
+    size_t pos = 0;
+    while (pos + 4 <= data.size())
+    {
+        uint32_t len;
+        memcpy(&len, data.data() + pos, 4);
+        frames.push_back(data.substr(pos + 4, len));
+        pos += 4 + len;
+    }
+    return frames;
+}
+
+// 运行在独立事件循环线程上的连接，对端fd留给测试读写。
+struct TestConn
+{
+    EventLoop loop{false};         ///< 连接所在的事件循环。
+    thread loopThread;             ///< 运行事件循环的线程。
+    int peer;                      ///< 对端fd。
+    ConnectionPtr conn;            ///< 被测试的连接。
+    atomic<int> sendComplete{0};   ///< 发送完成回调的次数。
+    atomic<int> highWaterMark{0};  ///< 高水位回调的次数。
+    atomic<int> lowWaterMark{0};   ///< 低水位回调的次数。
+    atomic<size_t> highPending{0}; ///< 高水位回调时积压的字节数。
+
+    explicit TestConn(int sndbuf = 0)
+    {
+        int fds[2];
+        int ret = socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds);
+        CHECK(ret == 0);
+        if (sndbuf > 0) setsockopt(fds[0], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+        peer = fds[1];
+
+        conn = make_shared<Connection>(&loop, make_unique<SocketFd>(fds[0]));
+        conn->setCloseCb([](ConnectionPtr) {});
+        conn->setErrorCb([](ConnectionPtr) {});
+        conn->setOnMessageCb([](ConnectionPtr, string_view) {});
+        conn->setSendCompleteCb([this](ConnectionPtr)
+                                { ++sendComplete; });
+
+        loopThread = thread([this]()
+                            { loop.run(100); });
+    }
+
+    // 先停止事件循环，再销毁连接。
+    ~TestConn()
+    {
+        loop.stop();
+        loopThread.join();
+        close(peer);
+    }
+};
+
+// 测试发送队列为空时直接写socket，发送完成回调在send()返回前执行。
+void test_direct_write()
+{
+    cout << "=== 测试直接写socket ===" << "\n";
+
+    TestConn tc;
+    size_t pending = 1;
+    int completed = 0;
+    runInLoop(tc.loop, [&]()
+              {
+        tc.conn->send("hello", 5);
+        pending = tc.conn->pendingBytes();
+        completed = tc.sendComplete; });
+    CHECK(pending == 0 && completed == 1); // 没有经过写事件
+    vector<string> frames = splitFrames(readExactly(tc.peer, 9));
+    CHECK(frames == vector<string>{"hello"});
+
+    // 同一轮中连续发送：都直接写入，报文顺序不变
+    vector<string> msgs;
+    size_t total = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        msgs.push_back("msg" + to_string(i));
+        total += 4 + msgs.back().size();
+    }
+    runInLoop(tc.loop, [&]()
+              {
+        for (const string& msg : msgs) tc.conn->send(msg.data(), msg.size()); });
+    frames = splitFrames(readExactly(tc.peer, total));
+    CHECK(frames == msgs);
+    CHECK(tc.sendComplete == 101);
+    cout << "直接写socket [OK]" << "\n";
+}
+
+// 测试socket写不动时只排队未写入的部分，高水位/低水位回调各触发一次，数据完整有序。
+void test_water_mark()
+{
+    cout << "=== 测试排队续发与高/低水位 ===" << "\n";
+
+    TestConn tc(4096);
+    const size_t HIGH = 64 * 1024, LOW = 8 * 1024;
+    tc.conn->setHighWaterMarkCb([&](ConnectionPtr, size_t pending)
+                                { ++tc.highWaterMark; tc.highPending = pending; }, HIGH);
+    tc.conn->setLowWaterMarkCb([&](ConnectionPtr)
+                               { ++tc.lowWaterMark; }, LOW);
+
+    // 对端不读，发送端很快写不动，剩余数据进入发送队列
+    vector<string> bodies;
+    size_t total = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        bodies.push_back(string(10000, 'a' + i % 26) + to_string(i));
+        total += 4 + bodies.back().size();
+    }
+    size_t pending = 0;
+    runInLoop(tc.loop, [&]()
+              {
+        for (const string& body : bodies) tc.conn->send(body.data(), body.size());
+        pending = tc.conn->pendingBytes(); });
+    CHECK(pending >= HIGH);
+    CHECK(tc.highWaterMark == 1 && tc.highPending >= HIGH); // 越过高水位只回调一次
+    const int completed = tc.sendComplete; // 在socket写满之前直接写完的报文
+    CHECK(tc.lowWaterMark == 0 && completed < 100);
+
+    // 对端读出全部数据，写事件把队列发完：回落到低水位、发送完成
+    vector<string> frames = splitFrames(readExactly(tc.peer, total));
+    CHECK(frames == bodies);
+    for (int i = 0; i < 100 && tc.sendComplete == completed; ++i) this_thread::sleep_for(chrono::milliseconds(10));
+    CHECK(tc.lowWaterMark == 1 && tc.sendComplete == completed + 1);
+    runInLoop(tc.loop, [&]()
+              { pending = tc.conn->pendingBytes(); });
+    CHECK(pending == 0);
+    cout << "排队续发与高/低水位 [OK]" << "\n";
+}
+
+// 测试多个工作线程交替用拷贝、移交所有权、共享报文体三种方式发送，数据完整且每个线程内的顺序不变。
+void test_cross_thread_send()
+{
+    cout << "=== 测试工作线程发送 ===" << "\n";
+
+    TestConn tc;
+    const int THREADS = 4, COUNT = 2000;
+    SharedPayload shared = make_shared<const string>(500, 'S');
+    size_t total = 0;
+    for (int t = 0; t < THREADS; ++t)
+        for (int i = 0; i < COUNT; ++i)
+            total += 4 + (i % 3 == 2 ? shared->size() : ("t" + to_string(t) + ":" + to_string(i)).size());
+
+    vector<thread> workers;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        workers.emplace_back([&, t]()
+                             {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                string msg = "t" + to_string(t) + ":" + to_string(i);
+                if (i % 3 == 0)
+                    tc.conn->send(msg.data(), msg.size());
+                else if (i % 3 == 1)
+                    tc.conn->send(std::move(msg));
+                else
+                    tc.conn->send(shared);
+            } });
+    }
+
+    vector<string> frames = splitFrames(readExactly(tc.peer, total));
+    for (thread& worker : workers) worker.join();
+
+    // 每个线程的报文按发送顺序到达：共享报文体出现在每个线程的第i % 3 == 2个位置，由前后的报文确定
+    vector<int> next(THREADS, 0);
+    int sharedCount = 0;
+    bool ordered = true;
+    for (const string& frame : frames)
+    {
+        if (frame == *shared)
+        {
+            ++sharedCount;
+            continue;
+        }
+        int t = frame[1] - '0';
+        int i = stoi(frame.substr(3));
+        if (i != next[t]) ordered = false;
+        next[t] = i + (i % 3 == 1 ? 2 : 1); // 跳过共享报文体
+    }
+    CHECK(ordered);
+    CHECK(sharedCount == THREADS * (COUNT / 3));
+    CHECK(frames.size() == size_t(THREADS * COUNT));
+    runInLoop(tc.loop, []() {});
+    CHECK(shared.use_count() == 1); // 发送完成后连接不再持有共享报文体
+    cout << "工作线程发送 [OK]" << "\n";
+}
+
+// 测试工作线程提交的发送在事件循环执行之前合并为一个任务，任务持有连接，调用者释放连接后数据仍然发出。
+void test_send_lifetime()
+{
+    cout << "=== 测试发送任务持有连接 ===" << "\n";
+
+    TestConn tc;
+
+    // 同一事件循环上的另一个连接，在处理报文时阻塞事件循环（任务队列之外）
+    int fds[2];
+    int ret = socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds);
+    CHECK(ret == 0);
+    promise<void> release;
+    shared_future<void> released = release.get_future().share();
+    promise<void> blocked;
+    ConnectionPtr blocker;
+    runInLoop(tc.loop, [&]()
+              {
+        blocker = make_shared<Connection>(&tc.loop, make_unique<SocketFd>(fds[0]));
+        blocker->setCloseCb([](ConnectionPtr) {});
+        blocker->setErrorCb([](ConnectionPtr) {});
+        blocker->setSendCompleteCb([](ConnectionPtr) {});
+        blocker->setOnMessageCb([&](ConnectionPtr, string_view)
+                                { blocked.set_value(); released.wait(); }); });
+    const char frame[] = {1, 0, 0, 0, 'x'};
+    ssize_t nwrite = ::write(fds[1], frame, sizeof(frame));
+    CHECK(nwrite == sizeof(frame));
+    blocked.get_future().wait();
+
+    weak_ptr<Connection> weak = tc.conn;
+    vector<string> msgs;
+    size_t total = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        msgs.push_back("late" + to_string(i));
+        total += 4 + msgs.back().size();
+        tc.conn->send(string(msgs.back()));
+    }
+    tc.conn.reset();         // 调用者不再持有连接
+    CHECK(!weak.expired()); // 排队的发送任务持有连接
+
+    release.set_value();
+    vector<string> frames = splitFrames(readExactly(tc.peer, total));
+    CHECK(frames == msgs);
+    runInLoop(tc.loop, []() {});
+    CHECK(weak.expired()); // 任务执行完毕后释放连接
+    CHECK(tc.sendComplete == 100);
+    runInLoop(tc.loop, [&]()
+              { blocker.reset(); });
+    close(fds[1]);
+    cout << "发送任务持有连接 [OK]" << "\n";
+}
+
+// 测试发送完成回调中再次发送：直接写完时回调推迟到下一轮，不会递归，全部报文按顺序送达。
+void test_send_complete_reentry()
+{
+    cout << "=== 测试发送完成回调中再次发送 ===" << "\n";
+
+    TestConn tc;
+    const int COUNT = 200000;
+    atomic<int> completed{0};
+    int depth = 0, maxDepth = 0; // 只在事件循环线程中访问
+    runInLoop(tc.loop, [&]()
+              {
+        tc.conn->setSendCompleteCb([&](ConnectionPtr conn)
+                                   {
+            ++depth;
+            maxDepth = max(maxDepth, depth);
+            if (++completed < COUNT) conn->send("x", 1);
+            --depth; });
+        tc.conn->send("x", 1); });
+
+    string data = readExactly(tc.peer, size_t(COUNT) * 5);
+    for (int i = 0; i < 500 && completed < COUNT; ++i) this_thread::sleep_for(chrono::milliseconds(10));
+    int depthSeen = 0;
+    runInLoop(tc.loop, [&]()
+              { depthSeen = maxDepth; });
+    CHECK(completed == COUNT);
+    CHECK(depthSeen == 1); // 回调没有嵌套
+    vector<string> frames = splitFrames(data);
+    CHECK(frames == vector<string>(COUNT, "x"));
+    cout << "发送完成回调中再次发送 [OK]" << "\n";
+}
+
+int main()
+{
+    test_direct_write();
+    test_water_mark();
+    test_cross_thread_send();
+    test_send_lifetime();
+    test_send_complete_reentry();
+
+    cout << "=== 所有ol::Connection测试通过！ ===" << "\n";
+    return 0;
+}
@@ -0,0 +1,144 @@
+/****************************************************************************************/
+/*
+ * 程序名：test_ol_EventLoop.cpp
+ * 功能描述：测试ol::EventLoop的跨线程任务队列：多线程提交的任务全部执行且各线程内顺序不变、
+ *          任务在锁外执行（执行期间其它线程可以提交任务，任务中也可以再提交任务）
+ */
+/****************************************************************************************/
+
+#if !defined(__unix__)
+#error "仅支持Linux平台，不支持当前系统！"
+#endif
+
+#include "ol_net/ol_EventLoop.h"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace ol;
+using namespace std;
+
+// 不受NDEBUG影响的检查：Release构建下同样生效，失败时打印位置和条件并终止进程
+#define CHECK(condition)                                                                               \
+    do                                                                                                 \
+    {                                                                                                  \
+        if (!(condition))                                                                              \
+        {                                                                                              \
+            std::cerr << "Check failed at " << __FILE__ << ":" << __LINE__ << ": " #condition << "\n"; \
+            std::abort();                                                                              \
+        }                                                                                              \
+    } while (0)
+
+// 运行在独立线程上的事件循环。
+struct TestLoop
+{
+    EventLoop loop{false}; ///< 被测试的事件循环。
+    thread loopThread;     ///< 运行事件循环的线程。
+
+    TestLoop()
+    {
+        loopThread = thread([this]()
+                            { loop.run(100); });
+    }
+
+    ~TestLoop()
+    {
+        loop.stop();
+        loopThread.join();
+    }
+};
+
+// 在事件循环线程中执行一个空任务并等待，之前提交的任务都已执行完。
+void drain(EventLoop& loop)
+{
+    promise<void> done;
+    future<void> fut = done.get_future();
+    loop.pushToQueue([&]()
+                     { done.set_value(); });
+    fut.wait();
+}
+
+// 测试多个线程并发提交任务：全部在事件循环线程中执行，每个线程提交的任务按提交顺序执行。
+void test_many_producers()
+{
+    cout << "=== 测试多线程提交任务 ===" << "\n";
+
+    TestLoop tl;
+    const int THREADS = 8, COUNT = 20000;
+    vector<int> next(THREADS, 0); // 只在事件循环线程中访问
+    atomic<int> executed{0};
+    atomic<bool> ordered{true};
+    atomic<bool> inLoop{true};
+
+    vector<thread> producers;
+    for (int t = 0; t < THREADS; ++t)
+    {
+        producers.emplace_back([&, t]()
+                               {
+            for (int i = 0; i < COUNT; ++i)
+            {
+                tl.loop.pushToQueue([&, t, i]()
+                                    {
+                    if (!tl.loop.isInLoopThread()) inLoop = false;
+                    if (next[t] != i) ordered = false;
+                    next[t] = i + 1;
+                    ++executed; });
+            } });
+    }
+    for (thread& producer : producers) producer.join();
+    drain(tl.loop);
+
+    CHECK(executed == THREADS * COUNT);
+    CHECK(ordered && inLoop);
+    cout << "多线程提交任务 [OK]" << "\n";
+}
+
+// 测试任务在锁外执行：任务阻塞期间其它线程提交任务不会被阻塞，任务中提交的任务在之后执行。
+void test_run_outside_lock()
+{
+    cout << "=== 测试任务在锁外执行 ===" << "\n";
+
+    TestLoop tl;
+    promise<void> started, release;
+    shared_future<void> released = release.get_future().share();
+    tl.loop.pushToQueue([&]()
+                        { started.set_value(); released.wait(); });
+    started.get_future().wait();
+
+    // 事件循环正在执行任务，这里提交任务必须立即返回
+    auto begin = chrono::steady_clock::now();
+    vector<int> order;
+    for (int i = 0; i < 1000; ++i)
+        tl.loop.pushToQueue([&, i]()
+                            { order.push_back(i); });
+    CHECK(chrono::steady_clock::now() - begin < chrono::seconds(1));
+    release.set_value();
+
+    // 任务中再提交任务：排在已提交的任务之后执行
+    promise<void> nested;
+    future<void> nestedDone = nested.get_future();
+    tl.loop.pushToQueue([&]()
+                        { tl.loop.pushToQueue([&]()
+                                              { order.push_back(-1); nested.set_value(); }); });
+    nestedDone.wait();
+
+    CHECK(order.size() == 1001 && order.back() == -1);
+    bool ordered = true;
+    for (int i = 0; i < 1000; ++i)
+        if (order[i] != i) ordered = false;
+    CHECK(ordered);
+    cout << "任务在锁外执行 [OK]" << "\n";
+}
+
+int main()
+{
+    test_many_producers();
+    test_run_outside_lock();
+
+    cout << "=== 所有ol::EventLoop测试通过！ ===" << "\n";
+    return 0;
+}
@@ -0,0 +1,154 @@
+/****************************************************************************************/
+/*
+ * 程序名：test_ol_FdAwaiter.cpp
+ * 功能描述：测试协程等待EventLoop上fd就绪（ol::readable/ol::writable），需开启OL_ENABLE_COROUTINES
+ */
+/****************************************************************************************/
+
+#if !defined(__unix__)
+#error "仅支持Linux平台，不支持当前系统！"
+#endif
+
+#include "ol_net/ol_FdAwaiter.h"
+#include <cstdlib>
+#include <iostream>
+
+#ifdef OL_COROUTINE_ENABLED
+#include "ol_ThreadPool.h"
+#include "ol_net/ol_EventLoop.h"
+#include <atomic>
+#include <chrono>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// 测试辅助宏（失败时终止进程，Release构建下同样生效）
+#define TEST(condition)                                                                      \
+    do                                                                                       \
+    {                                                                                        \
+        if (!(condition))                                                                    \
+        {                                                                                    \
+            std::cerr << "Test failed at line " << __LINE__ << ": " #condition << std::endl; \
+            std::abort();                                                                    \
+        }                                                                                    \
+        else                                                                                 \
+        {                                                                                    \
+            std::cout << "Test passed: " #condition << std::endl;                            \
+        }                                                                                    \
+    } while (0)
+
+using namespace ol;
+using namespace std;
+
+// 等待管道可读后读出一个字节，返回读到的值（未报告可读事件或读取失败时返回-1）。
+CoTask<int> readOne(EventLoop& loop, ThreadPool<false>& pool, int fd)
+{
+    uint32_t events = co_await readable(loop, fd, pool.executor());
+    if (!(events & EPOLLIN)) co_return -1;
+    char c = 0;
+    ssize_t n = read(fd, &c, 1);
+    co_return n == 1 ? c : -1;
+}
+
+// 等待管道可写后写入一个字节。
+CoTask<bool> writeOne(EventLoop& loop, int fd, char c)
+{
+    co_await writable(loop, fd);
+    co_return write(fd, &c, 1) == 1;
+}
+
+// 测试单个fd的读写就绪
+void test_single_pipe(EventLoop& loop, ThreadPool<false>& pool)
+{
+    cout << "=== 测试单个管道读写就绪 ===" << "\n";
+
+    int fds[2];
+    int ret = pipe2(fds, O_NONBLOCK);
+    TEST(ret == 0);
+
+    Future<int> reader = spawn(pool, readOne(loop, pool, fds[0]));
+    this_thread::sleep_for(chrono::milliseconds(50));
+    TEST(!reader.isReady()); // 尚无数据，协程挂起且不占用工作线程
+
+    bool written = spawn(pool, writeOne(loop, fds[1], 'x')).get();
+    TEST(written);
+    int value = reader.get();
+    TEST(value == 'x');
+
+    close(fds[0]);
+    close(fds[1]);
+    cout << "单个管道测试通过" << "\n";
+}
+
+// 测试少量线程同时等待大量fd
+void test_many_pipes(EventLoop& loop, ThreadPool<false>& pool)
+{
+    cout << "=== 测试大量fd同时等待 ===" << "\n";
+
+    const int N = 256;
+    vector<int> readFds(N), writeFds(N);
+    vector<Future<int>> readers;
+    bool created = true;
+    for (int i = 0; i < N; ++i)
+    {
+        int fds[2];
+        if (pipe2(fds, O_NONBLOCK) != 0) created = false;
+        readFds[i] = fds[0];
+        writeFds[i] = fds[1];
+        readers.push_back(spawn(pool, readOne(loop, pool, fds[0])));
+    }
+    TEST(created);
+
+    this_thread::sleep_for(chrono::milliseconds(50));
+    bool allWritten = true;
+    for (int i = 0; i < N; ++i)
+    {
+        char c = static_cast<char>(i % 100);
+        if (write(writeFds[i], &c, 1) != 1) allWritten = false;
+    }
+    TEST(allWritten);
+
+    long long sum = 0, expected = 0;
+    for (int i = 0; i < N; ++i)
+    {
+        sum += readers[i].get();
+        expected += i % 100;
+    }
+    TEST(sum == expected);
+
+    for (int i = 0; i < N; ++i)
+    {
+        close(readFds[i]);
+        close(writeFds[i]);
+    }
+    cout << "2个工作线程同时等待" << N << "个fd测试通过" << "\n";
+}
+
+int main()
+{
+    EventLoop loop(false);
+    thread loopThread([&loop]()
+                      { loop.run(1000); });
+    ThreadPool<false> pool(2);
+
+    test_single_pipe(loop, pool);
+    test_many_pipes(loop, pool);
+
+    loop.stop();
+    loopThread.join();
+
+    cout << "\n所有测试通过！" << "\n";
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::cout << "Coroutine support disabled (configure with -DOL_ENABLE_COROUTINES=ON), skipped." << "\n";
+    return 0;
+}
+
+#endif // OL_COROUTINE_ENABLED